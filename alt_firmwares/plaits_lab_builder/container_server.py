@@ -53,6 +53,10 @@ BUILD_CONTRACT_VERSION = os.environ.get("PLAITS_BUILD_CONTRACT", "2")
 # source, which meant the header reported the image's default — "1" — while the
 # Worker had long since moved on, so anyone reading it was told the wrong thing.
 MANUAL_CONTRACT_FALLBACK = os.environ.get("PLAITS_MANUAL_CONTRACT", "1")
+# Six-op builds render with the per-algorithm fused renderers only when the image
+# asks for them: the samples are the same, the flash cost is not yet measured on
+# the target (plaits/build_config.h).
+FUSED_FM_ALGORITHMS = os.environ.get("PLAITS_FUSED_FM_ALGORITHMS", "0") == "1"
 TOOLCHAIN_ID = "gcc-arm-none-eabi-4.8-2013q4"
 TOOLCHAIN_BIN = os.environ.get("PLAITS_TOOLCHAIN_BIN", "/usr/local/arm-4.8.3/bin")
 # The Worker has already normalized and structurally bounded the recipe before
@@ -683,7 +687,8 @@ def build_firmware(payload: Any) -> tuple[Path, FirmwareOutput, dict[str, str]]:
     config_path = build_dir / "engine_config.h"
     speech_config_path = build_dir / "speech_config.h"
     recipe_path = build_dir / "recipe.json"
-    config_text = render_config(validated_recipe)
+    config_text = render_config(
+        validated_recipe, fused_fm_algorithms=FUSED_FM_ALGORITHMS)
     config_path.write_text(config_text, encoding="utf-8")
     speech_config_path.write_text(
         render_speech_config(validated_recipe.speech_banks), encoding="utf-8")
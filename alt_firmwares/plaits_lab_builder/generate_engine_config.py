@@ -18,6 +18,7 @@ from pathlib import Path
 from typing import Any
 
 from speech_banks import validate_speech_banks
+from user_data_layout import lay_out_fm_bank
 
 
 REPO_ROOT = Path(__file__).resolve().parents[2]
@@ -26,6 +27,7 @@ CATALOG_PATH = Path(__file__).resolve().parents[1] / "plaits_lab_catalog/catalog
 PUBLIC_CATALOG_PATH = Path(__file__).resolve().parents[1] / "plaits_lab_catalog/public_catalog.json"
 CHORD_CATALOG_PATH = Path(__file__).resolve().parents[1] / "plaits_lab_chord_tables/catalog.json"
 RANDOMIZER_PROFILES_PATH = Path(__file__).resolve().parents[1] / "plaits_lab_sdk/randomizer_profiles.json"
+ENGINE_MEMORY_PATH = Path(__file__).resolve().parents[1] / "plaits_lab_catalog/engine_memory.json"
 
 
 @dataclass(frozen=True)
@@ -516,6 +518,76 @@ def validate_bank_shape(public_slots: list[str | None], schema_version: int) ->
                          f"{SPARSE_BANK_MIN_SCHEMA_VERSION}")
 
 
+# The STM32F373's 32 KB of RAM, less the stack reserve the post-link gate keeps
+# (container_server.RAM_BUDGET_BYTES and RAM_STACK_RESERVE_BYTES).
+TARGET_RAM_BYTES = 32 * 1024
+TARGET_STACK_RESERVE_BYTES = 1024
+# .data + .bss of a linked firmware other than the engine arena (shared_buffer
+# in plaits.cc) and the engines. Taken from the gate recipe's production build
+# at rev-ccf67eac9661 (48 B data, 20,668 B BSS, with the three Speech engines
+# resident), less the 16 kB arena and those engines' objects as
+# engine_memory.json records them. Those are host sizes, no smaller than the
+# target's, which errs low; that build's registry entries are counted again
+# below, which errs high. The post-link gate stays the final word. Re-measure it
+# with arm-none-eabi-size when the firmware's static RAM moves.
+TARGET_FIXED_RAM_BYTES = 48 + 20668 - 16384 - (536 + 424 + 304)
+# What each engine adds to the voice on the target: its one-byte EngineSlot and
+# its EngineRegistry entry (object, size, constructor and destructor pointers,
+# PostProcessingSettings).
+TARGET_ENGINE_SLOT_BYTES = 1 + 4 * 4 + 12
+
+
+def load_engine_memory() -> tuple[dict[str, dict[str, int]], int]:
+    """(per-engine footprints, arena bytes).
+
+    engine_memory.json is written by `make engine-memory-table`
+    (plaits/test/engine_memory_report.cc): sizeof each engine class and the
+    arena bytes its Init() allocates. Firmware builds construct only the
+    selected engine, in one block sized for the largest of the palette, so the
+    engines' RAM is the largest object, not the sum. The sizes come from a host
+    build with 8-byte pointers; the target's are 4, so they are used as an upper
+    bound."""
+    value = json.loads(ENGINE_MEMORY_PATH.read_text(encoding="utf-8"))
+    if value.get("schemaVersion") != 1:
+        raise ValueError("unsupported engine memory table schema")
+    return value["engines"], value["arenaBytes"]
+
+
+ENGINE_MEMORY, ENGINE_ARENA_BYTES = load_engine_memory()
+
+
+def engine_ram_bytes(public_slots: list[str | None]) -> int:
+    """The RAM a palette's firmware needs on the STM32F373: the fixed .data and
+    .bss, the arena, the overlay block (the largest engine object, aligned to 8
+    bytes as EngineOverlayStorage is) and each engine's registry entry."""
+    engine_ids = [engine_id for engine_id in public_slots if engine_id]
+    largest = max(ENGINE_MEMORY[engine_id]["object"] for engine_id in engine_ids)
+    return (TARGET_FIXED_RAM_BYTES + ENGINE_ARENA_BYTES + (largest + 7) // 8 * 8
+            + TARGET_ENGINE_SLOT_BYTES * len(engine_ids))
+
+
+def validate_engine_memory(public_slots: list[str | None]) -> None:
+    """Rejects a palette that would not fit the module's RAM, before anything
+    is cross-compiled: every engine's Init() allocations must fit the shared
+    arena, and the firmware (engine_ram_bytes) the RAM left above the stack."""
+    for engine_id in sorted({engine_id for engine_id in public_slots if engine_id}):
+        footprint = ENGINE_MEMORY.get(engine_id)
+        if footprint is None:
+            raise ValueError(
+                f"no memory footprint is recorded for engine {engine_id}: "
+                "refresh it with `make -f plaits/test/makefile engine-memory-table`")
+        if footprint["arena"] > ENGINE_ARENA_BYTES:
+            raise ValueError(
+                f"engine {engine_id} needs {footprint['arena']} bytes of working "
+                f"memory; Plaits has {ENGINE_ARENA_BYTES}")
+    over = (engine_ram_bytes(public_slots) + TARGET_STACK_RESERVE_BYTES
+            - TARGET_RAM_BYTES)
+    if over > 0:
+        raise ValueError(
+            f"this palette needs more RAM than Plaits has by {over} bytes: "
+            "remove its largest engine")
+
+
 def validate_recipe(value: Any) -> BuildRecipe:
     if not isinstance(value, dict):
         raise ValueError("recipe must be a JSON object")
@@ -543,6 +615,7 @@ def validate_recipe(value: Any) -> BuildRecipe:
             f"32-slot recipes require schemaVersion {FOUR_BANK_MIN_SCHEMA_VERSION} or newer")
     public_slots = normalize_slots(slots, schema_version)
     validate_bank_shape(public_slots, schema_version)
+    validate_engine_memory(public_slots)
     user_data_banks: list[tuple[int, bytes]] = []   # v6 index-keyed
     slot_banks: list[tuple[int, bytes]] = []        # v12 slot-keyed
     speech_banks: dict[str, Any] | None = None
@@ -910,7 +983,8 @@ def cpp_bool(value: bool) -> str:
     return "true" if value else "false"
 
 
-def render_config(recipe: BuildRecipe) -> str:
+def render_config(recipe: BuildRecipe, lay_out_fm_banks: bool = False,
+                  fused_fm_algorithms: bool = False) -> str:
     public_slots = recipe.public_slots
     # Public order is green, red, amber (+ optional orange). Three-bank builds
     # retain Plaits' legacy amber/green/red registry rotation. Four-bank builds
@@ -961,7 +1035,8 @@ def render_config(recipe: BuildRecipe) -> str:
 
     includes = "\n".join(f'#include "{item.header}"' for item in unique)
     continuation = " " + "\\" + "\n  "
-    members = continuation.join(f"{item.class_name} {item.member};" for item in unique)
+    members = continuation.join(
+        f"PLAITS_ENGINE_MEMBER({item.class_name}, {item.member})" for item in unique)
     registrations = continuation.join(
         "(registry).RegisterInstance(&{member}, {enveloped}, {out_gain}, {aux_gain});".format(
             member=item.member,
@@ -1101,10 +1176,17 @@ def render_config(recipe: BuildRecipe) -> str:
     # would be undone.
     size_by_index = {index: len(data) for index, data in override_arrays_all}
 
+    # A bank that cannot be replaced may instead be baked in fm::Patch records
+    # (user_data_layout.py), which SixOpEngine plays in place rather than
+    # unpacking into RAM on every model switch. It costs 28 bytes of flash per
+    # voice, so it is asked for (--lay-out-fm-banks), not the default. A
+    # swappable bank always stays packed: a transfer writes packed voices into
+    # the same flash. The size table keeps the packed length either way; the
+    # engine takes a laid-out bank's count from its header.
     def _bank_bytes(data: bytes) -> bytes:
         """The bytes actually emitted for a baked bank array."""
         if not swappable:
-            return bytes(data)
+            return lay_out_fm_bank(data) if lay_out_fm_banks else bytes(data)
         padded = bytearray(data) + bytes(PACKED_BANK_SIZE - len(data))
         # Clear the count/tag bytes so a BAKED bank can never be misread as a
         # TRANSFERRED one by UserData::ptr. They are the tail of voice 32's name
@@ -1216,6 +1298,13 @@ def render_config(recipe: BuildRecipe) -> str:
         else "amber, green, red"
     )
 
+    # The six-op engines may render each patch with its algorithm's fused
+    # renderer (build_config.h, PLAITS_BUILD_FUSED_FM_ALGORITHMS): the same
+    # samples for more flash. It is a build option, not a recipe preference, so
+    # it is asked for (--fused-fm-algorithms) and a config without it is unchanged.
+    fused_fm_gate = (
+        "#define PLAITS_BUILD_FUSED_FM_ALGORITHMS 1\n" if fused_fm_algorithms else "")
+
     return f"""// Generated by alt_firmwares/plaits_lab_builder/generate_engine_config.py.
 // Public recipe order: green, red, amber, optional orange. Registry order: {registry_order}.
 #ifndef PLAITS_DSP_ENGINE_CONFIG_H_
@@ -1225,7 +1314,7 @@ def render_config(recipe: BuildRecipe) -> str:
 // erase the optional frequency-offset interface from ordinary builds.
 #define PLAITS_BUILD_LINEAR_TZFM {recipe.linear_tzfm}
 #define PLAITS_BUILD_FAST_FM {recipe.fast_fm}
-
+{fused_fm_gate}
 {includes}
 #include "plaits/resources.h"
 #include "plaits/user_data_region.h"
@@ -1275,6 +1364,7 @@ def render_config(recipe: BuildRecipe) -> str:
 #define PLAITS_ROVED_PANEL {recipe.roved_panel}
 #define PLAITS_BUILD_OPTIONS_PROFILE_ID 0x{recipe.options_profile_id:06x}u
 
+#define PLAITS_ENGINE_OVERLAY 1
 #define PLAITS_ENGINE_MEMBERS \\
   {members}
 
@@ -1308,12 +1398,23 @@ def main() -> None:
     parser = argparse.ArgumentParser()
     parser.add_argument("recipe", type=Path)
     parser.add_argument("output", type=Path)
+    parser.add_argument(
+        "--lay-out-fm-banks", action="store_true",
+        help="bake custom FM banks of a locked build as fm::Patch records, "
+             "read in place instead of unpacked on model switch")
+    parser.add_argument(
+        "--fused-fm-algorithms", action="store_true",
+        help="render six-op patches with the per-algorithm fused renderers "
+             "(same samples, more flash)")
     args = parser.parse_args()
 
     recipe = json.loads(args.recipe.read_text(encoding="utf-8"))
     validated_recipe = validate_recipe(recipe)
     args.output.parent.mkdir(parents=True, exist_ok=True)
-    args.output.write_text(render_config(validated_recipe), encoding="utf-8")
+    args.output.write_text(
+        render_config(validated_recipe, lay_out_fm_banks=args.lay_out_fm_banks,
+                      fused_fm_algorithms=args.fused_fm_algorithms),
+        encoding="utf-8")
 
 
 if __name__ == "__main__":
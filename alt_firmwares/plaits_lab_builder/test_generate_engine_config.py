@@ -5,6 +5,7 @@ import re
 import unittest
 from itertools import product
 from pathlib import Path
+from unittest import mock
 
 from generate_engine_config import (
     ATTENUVERTER_MODE_MIN_SCHEMA_VERSION,
@@ -12,8 +13,13 @@ from generate_engine_config import (
     DEFAULT_CHORD_TABLES,
     DEFAULT_CONFIGURATION,
     DEFAULT_SCALE_BANK,
+    ENGINE_ARENA_BYTES,
+    ENGINE_MEMORY,
+    TARGET_RAM_BYTES,
+    TARGET_STACK_RESERVE_BYTES,
     MAX_RECIPE_SCHEMA_VERSION,
     MIN_RECIPE_SCHEMA_VERSION,
+    engine_ram_bytes,
     render_config,
     validate_recipe,
 )
@@ -519,9 +525,9 @@ class GenerateEngineConfigTest(unittest.TestCase):
         ]
         config = render_config(validate_recipe(recipe))
         for declaration in (
-            "VirtualAnalogDualEngine virtual_analog_dual_engine_;",
-            "VirtualAnalogCrossfadeEngine virtual_analog_crossfade_engine_;",
-            "VirtualAnalogEngine virtual_analog_engine_;",
+            "PLAITS_ENGINE_MEMBER(VirtualAnalogDualEngine, virtual_analog_dual_engine_)",
+            "PLAITS_ENGINE_MEMBER(VirtualAnalogCrossfadeEngine, virtual_analog_crossfade_engine_)",
+            "PLAITS_ENGINE_MEMBER(VirtualAnalogEngine, virtual_analog_engine_)",
         ):
             self.assertIn(declaration, config)
         self.assertEqual(config.count("RegisterInstance(&virtual_analog_dual_engine_"), 1)
@@ -531,9 +537,9 @@ class GenerateEngineConfigTest(unittest.TestCase):
     def test_dx_banks_and_mixed_lab_engines_are_encoded_per_slot(self) -> None:
         config = render_config(validate_recipe(self.load("mixed_recipe.json")))
         self.assertIn("{ 0, -1, 1, -1, 2,", config)
-        self.assertIn("GlissonEngine glisson_engine_;", config)
-        self.assertIn("PulsarEngine pulsar_engine_;", config)
-        self.assertEqual(config.count("SixOpEngine six_op_engine_;"), 1)
+        self.assertIn("PLAITS_ENGINE_MEMBER(GlissonEngine, glisson_engine_)", config)
+        self.assertIn("PLAITS_ENGINE_MEMBER(PulsarEngine, pulsar_engine_)", config)
+        self.assertEqual(config.count("PLAITS_ENGINE_MEMBER(SixOpEngine, six_op_engine_)"), 1)
         self.assertEqual(config.count("RegisterInstance(&six_op_engine_"), 3)
 
     def bank_document(self, first_byte: int = 0) -> dict:
@@ -908,6 +914,43 @@ class GenerateEngineConfigTest(unittest.TestCase):
             "static const size_t kResolvedUserDataBankSize[4] = { 4096, 4096, 4096, 4096 };",
             config)
 
+    def test_laid_out_bank_is_baked_as_patch_records(self) -> None:
+        # Opting in bakes a locked bank in fm::Patch records (header 0xd7,
+        # version 1, 156-byte records, 4 voices) for SixOpEngine to read in
+        # place. The size table keeps the packed length.
+        slots = ["dx7-bank-a"] + ["virtual-analog"] * 23
+        recipe = validate_recipe(self.v13_recipe(
+            slots, [{"slot": 0, "bank": self.short_bank_document(4, first_byte=9)}]))
+        config = render_config(recipe, lay_out_fm_banks=True)
+        self.assertIn(
+            "static const uint8_t kUserDataBankOverride_3[628] = { 215, 1, 156, 4, 9, 0,",
+            config)
+        self.assertIn(
+            "static const size_t kResolvedUserDataBankSize[4] = { 4096, 4096, 4096, 512 };",
+            config)
+        # Without the option the output is unchanged.
+        self.assertIn(
+            "static const uint8_t kUserDataBankOverride_3[512] = { 9, 0,",
+            render_config(recipe))
+
+    def test_fused_fm_algorithms_gate_is_opt_in(self) -> None:
+        # The gate sits with the other feature gates, ahead of the engine
+        # includes that read it; without the option the output is unchanged.
+        recipe = validate_recipe(self.v13_recipe(
+            ["dx7-bank-a"] + ["virtual-analog"] * 23, []))
+        config = render_config(recipe, fused_fm_algorithms=True)
+        gate = config.index("#define PLAITS_BUILD_FUSED_FM_ALGORITHMS 1\n")
+        self.assertLess(config.index("#define PLAITS_BUILD_FAST_FM"), gate)
+        self.assertLess(gate, config.index("#include"))
+        self.assertNotIn("PLAITS_BUILD_FUSED_FM_ALGORITHMS", render_config(recipe))
+
+    def test_swappable_bank_stays_packed_when_laid_out(self) -> None:
+        slots = ["dx7-bank-a"] + ["virtual-analog"] * 23
+        recipe = self.replaceable_recipe(
+            slots, [{"slot": 0, "bank": self.short_bank_document(4, first_byte=9)}])
+        config = render_config(validate_recipe(recipe), lay_out_fm_banks=True)
+        self.assertIn("const uint8_t kUserDataBankOverride_3[4096] = { 9, 0,", config)
+
     def test_short_bank_rejected_below_v13(self) -> None:
         slots = ["dx7-bank-a"] + ["virtual-analog"] * 23
         recipe = self.v12_recipe(
@@ -953,7 +996,7 @@ class GenerateEngineConfigTest(unittest.TestCase):
             "SpectralSpiralEngine",
         ]
         for class_name in class_names:
-            self.assertEqual(config.count(f"{class_name} "), 1)
+            self.assertEqual(config.count(f"PLAITS_ENGINE_MEMBER({class_name}, "), 1)
 
     def test_unknown_engine_is_rejected(self) -> None:
         recipe = self.load("default_recipe.json")
@@ -961,6 +1004,45 @@ class GenerateEngineConfigTest(unittest.TestCase):
         with self.assertRaisesRegex(ValueError, "unapproved"):
             validate_recipe(recipe)
 
+    def test_every_catalog_engine_has_a_memory_footprint(self) -> None:
+        self.assertEqual(set(ENGINE_MEMORY), set(CATALOG))
+        self.assertTrue(all(item["arena"] <= ENGINE_ARENA_BYTES
+                            for item in ENGINE_MEMORY.values()))
+
+    def test_engine_over_the_arena_is_rejected(self) -> None:
+        recipe = self.load("default_recipe.json")
+        recipe["slots"][0] = "virtual-analog"
+        footprint = {"object": 184, "arena": ENGINE_ARENA_BYTES + 1}
+        with mock.patch.dict(ENGINE_MEMORY, {"virtual-analog": footprint}):
+            with self.assertRaisesRegex(ValueError, "working memory"):
+                validate_recipe(recipe)
+
+    def test_shipped_recipes_fit_the_module_ram(self) -> None:
+        for name in ("default_recipe.json", "mixed_recipe.json"):
+            recipe = validate_recipe(self.load(name))
+            self.assertLessEqual(
+                engine_ram_bytes(recipe.public_slots) + TARGET_STACK_RESERVE_BYTES,
+                TARGET_RAM_BYTES, name)
+
+    def test_engine_object_over_the_module_ram_is_rejected(self) -> None:
+        # The overlay block is sized for the largest engine, rounded up to 8
+        # bytes: one that leaves no room for the rest of the firmware and the
+        # stack is refused.
+        recipe = self.load("default_recipe.json")
+        recipe["slots"][0] = "virtual-analog"
+        slots = validate_recipe(recipe).public_slots
+        with mock.patch.dict(ENGINE_MEMORY, {"virtual-analog": {"object": 8192, "arena": 0}}):
+            rest = engine_ram_bytes(slots) - 8192
+        room = TARGET_RAM_BYTES - TARGET_STACK_RESERVE_BYTES - rest
+        largest = room // 8 * 8
+        with mock.patch.dict(ENGINE_MEMORY, {"virtual-analog": {"object": largest, "arena": 0}}):
+            validate_recipe(recipe)
+        too_large = {"object": largest + 64, "arena": 0}
+        with mock.patch.dict(ENGINE_MEMORY, {"virtual-analog": too_large}):
+            with self.assertRaisesRegex(
+                    ValueError, f"more RAM than Plaits has by {largest + 64 - room} bytes"):
+                validate_recipe(recipe)
+
     def test_recipe_slot_count_must_be_24_or_32(self) -> None:
         recipe = self.load("default_recipe.json")
         recipe["slots"].pop()
@@ -0,0 +1,71 @@
+from __future__ import annotations
+
+import unittest
+
+from generate_engine_config import load_factory_bank_bytes
+from user_data_layout import (
+    HEADER_SIZE, MAGIC, PATCH_RECORD_SIZE, VERSION, lay_out_fm_bank,
+    pack_fm_bank, pack_patch, read_fm_bank, unpack_patch)
+
+
+class UserDataLayoutTest(unittest.TestCase):
+    def test_header_and_size(self) -> None:
+        packed = load_factory_bank_bytes()[0]
+        data = lay_out_fm_bank(packed)
+        self.assertEqual(data[:HEADER_SIZE], bytes((MAGIC, VERSION, PATCH_RECORD_SIZE, 32)))
+        self.assertEqual(len(data), HEADER_SIZE + 32 * PATCH_RECORD_SIZE)
+
+    def test_short_bank_declares_its_count(self) -> None:
+        packed = load_factory_bank_bytes()[1][:3 * 128]
+        data = lay_out_fm_bank(packed)
+        self.assertEqual(data[3], 3)
+        self.assertEqual(len(read_fm_bank(data)), 3)
+
+    def test_factory_banks_round_trip(self) -> None:
+        # Unpack clamps out-of-range fields, so packed -> laid out -> packed is
+        # not the identity on raw SysEx; laid out -> packed -> laid out is, and
+        # the repacked voices unpack to the very records the firmware reads.
+        for index, packed in load_factory_bank_bytes().items():
+            data = lay_out_fm_bank(packed)
+            self.assertEqual(lay_out_fm_bank(pack_fm_bank(data)), data, index)
+            for i, record in enumerate(read_fm_bank(data)):
+                self.assertEqual(record, unpack_patch(packed[i * 128:(i + 1) * 128]))
+                self.assertEqual(unpack_patch(pack_patch(record)), record)
+
+    def test_clamps_like_patch_unpack(self) -> None:
+        record = unpack_patch(bytes([0x7F] * 128))
+        self.assertEqual(record[0], 99)                # op 1 envelope rate
+        self.assertEqual(record[20], 14)               # op 1 detune
+        self.assertEqual(record[6 * 21 + 8], 0x1F)     # algorithm
+        self.assertEqual(record[6 * 21 + 16], 5)       # LFO waveform
+        self.assertEqual(record[6 * 21 + 18], 48)      # transpose
+        self.assertEqual(record[-1], 0x3F)             # active operators
+
+    def test_packed_bank_is_not_read_as_laid_out(self) -> None:
+        # Packed voices are 7-bit, so no packed bank starts with the magic.
+        for packed in load_factory_bank_bytes().values():
+            self.assertIsNone(read_fm_bank(packed))
+
+    def test_other_versions_and_record_sizes_are_refused(self) -> None:
+        data = bytearray(lay_out_fm_bank(load_factory_bank_bytes()[2]))
+        data[1] = VERSION + 1
+        self.assertIsNone(read_fm_bank(bytes(data)))
+        data[1] = VERSION
+        data[2] = PATCH_RECORD_SIZE - 1
+        self.assertIsNone(read_fm_bank(bytes(data)))
+        data[2] = PATCH_RECORD_SIZE
+        data[3] = 0
+        self.assertIsNone(read_fm_bank(bytes(data)))
+
+    def test_truncated_bank_is_rejected(self) -> None:
+        data = lay_out_fm_bank(load_factory_bank_bytes()[0])
+        with self.assertRaises(ValueError):
+            read_fm_bank(data[:-1])
+
+    def test_partial_voice_is_rejected(self) -> None:
+        with self.assertRaises(ValueError):
+            lay_out_fm_bank(bytes(130))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,140 @@
+"""FM banks laid out for reading in place (plaits/user_data_region.h).
+
+A packed DX7 bank is 128 bytes per voice, and SixOpEngine unpacks every voice
+into a RAM fm::Patch (156 bytes) whenever the model is switched to it. A bank
+baked in the fm::Patch layout itself, behind a short versioned header, is read
+straight from flash instead:
+
+    0      0xd7         magic (never a 7-bit packed byte)
+    1      version      1
+    2      record size  156
+    3      count        1..255 records
+    4...   the records, each exactly what fm::Patch::Unpack makes of a voice
+
+`unpack_patch` mirrors fm::Patch::Unpack byte for byte, and `pack_patch` is its
+inverse for any record Unpack can produce, so a laid-out bank converts back to
+the packed bytes a TIMBRE transfer carries. A laid-out bank is never a
+swappable region: a transfer always writes packed data.
+"""
+
+from __future__ import annotations
+
+MAGIC = 0xD7
+VERSION = 1
+HEADER_SIZE = 4
+PACKED_PATCH_SIZE = 128
+PATCH_RECORD_SIZE = 156  # sizeof(fm::Patch)
+NUM_OPERATORS = 6
+OPERATOR_RECORD_SIZE = 21  # sizeof(fm::Patch::Operator)
+PACKED_OPERATOR_SIZE = 17
+
+
+def unpack_patch(packed: bytes) -> bytes:
+    """One packed voice as the fm::Patch record Patch::Unpack would make."""
+    if len(packed) != PACKED_PATCH_SIZE:
+        raise ValueError("a packed voice is 128 bytes")
+    d = packed
+    record = bytearray()
+    for i in range(NUM_OPERATORS):
+        o = d[i * PACKED_OPERATOR_SIZE:(i + 1) * PACKED_OPERATOR_SIZE]
+        record += bytes(min(o[j] & 0x7F, 99) for j in range(4))      # rate
+        record += bytes(min(o[4 + j] & 0x7F, 99) for j in range(4))  # level
+        record += bytes((
+            min(o[8] & 0x7F, 99),    # break_point
+            min(o[9] & 0x7F, 99),    # left_depth
+            min(o[10] & 0x7F, 99),   # right_depth
+            o[11] & 0x3,             # left_curve
+            (o[11] >> 2) & 0x3,      # right_curve
+            o[12] & 0x7,             # rate_scaling
+            o[13] & 0x3,             # amp_mod_sensitivity
+            (o[13] >> 2) & 0x7,      # velocity_sensitivity
+            min(o[14] & 0x7F, 99),   # level
+            o[15] & 0x1,             # mode
+            (o[15] >> 1) & 0x1F,     # coarse
+            min(o[16] & 0x7F, 99),   # fine
+            min((o[12] >> 3) & 0xF, 14),  # detune
+        ))
+    record += bytes(min(d[102 + j] & 0x7F, 99) for j in range(4))
+    record += bytes(min(d[106 + j] & 0x7F, 99) for j in range(4))
+    record += bytes((
+        d[110] & 0x1F,           # algorithm
+        d[111] & 0x7,            # feedback
+        (d[111] >> 3) & 0x1,     # reset_phase
+        min(d[112] & 0x7F, 99),  # modulations.rate
+        min(d[113] & 0x7F, 99),  # modulations.delay
+        min(d[114] & 0x7F, 99),  # modulations.pitch_mod_depth
+        min(d[115] & 0x7F, 99),  # modulations.amp_mod_depth
+        d[116] & 0x1,            # modulations.reset_phase
+        min((d[116] >> 1) & 0x7, 5),  # modulations.waveform
+        d[116] >> 4,             # modulations.pitch_mod_sensitivity
+        min(d[117] & 0x7F, 48),  # transpose
+    ))
+    record += bytes(d[118 + i] & 0x7F for i in range(10))
+    record.append(0x3F)  # active_operators
+    assert len(record) == PATCH_RECORD_SIZE
+    return bytes(record)
+
+
+def pack_patch(record: bytes) -> bytes:
+    """The packed voice an fm::Patch record unpacks from."""
+    if len(record) != PATCH_RECORD_SIZE:
+        raise ValueError("an fm::Patch record is 156 bytes")
+    r = record
+    packed = bytearray()
+    for i in range(NUM_OPERATORS):
+        o = r[i * OPERATOR_RECORD_SIZE:(i + 1) * OPERATOR_RECORD_SIZE]
+        packed += o[0:11]
+        packed += bytes((
+            o[11] | (o[12] << 2),
+            o[13] | (o[20] << 3),
+            o[14] | (o[15] << 2),
+            o[16],
+            o[17] | (o[18] << 1),
+            o[19],
+        ))
+    p = r[NUM_OPERATORS * OPERATOR_RECORD_SIZE:]
+    packed += p[0:8]
+    packed += bytes((
+        p[8],
+        p[9] | (p[10] << 3),
+        p[11], p[12], p[13], p[14],
+        p[15] | (p[16] << 1) | (p[17] << 4),
+        p[18],
+    ))
+    packed += p[19:29]
+    assert len(packed) == PACKED_PATCH_SIZE
+    return bytes(packed)
+
+
+def lay_out_fm_bank(packed: bytes) -> bytes:
+    """A packed bank (1..32 voices of 128 bytes) in the laid-out format."""
+    count, remainder = divmod(len(packed), PACKED_PATCH_SIZE)
+    if remainder or not 1 <= count <= 255:
+        raise ValueError("a packed bank is a whole number of 128-byte voices")
+    data = bytearray((MAGIC, VERSION, PATCH_RECORD_SIZE, count))
+    for i in range(count):
+        data += unpack_patch(packed[i * PACKED_PATCH_SIZE:(i + 1) * PACKED_PATCH_SIZE])
+    return bytes(data)
+
+
+def read_fm_bank(data: bytes) -> list[bytes] | None:
+    """The fm::Patch records of a laid-out bank, or None if `data` is not one
+    this firmware reads — the same test as UserDataLayout::records."""
+    if len(data) < HEADER_SIZE or data[0] != MAGIC or data[1] != VERSION \
+            or data[2] != PATCH_RECORD_SIZE or data[3] == 0:
+        return None
+    count = data[3]
+    if len(data) < HEADER_SIZE + count * PATCH_RECORD_SIZE:
+        raise ValueError("a laid-out bank is shorter than its declared count")
+    return [
+        data[HEADER_SIZE + i * PATCH_RECORD_SIZE:HEADER_SIZE + (i + 1) * PATCH_RECORD_SIZE]
+        for i in range(count)
+    ]
+
+
+def pack_fm_bank(data: bytes) -> bytes:
+    """A laid-out bank converted back to packed voices."""
+    records = read_fm_bank(data)
+    if records is None:
+        raise ValueError("not a laid-out FM bank")
+    return b"".join(pack_patch(record) for record in records)
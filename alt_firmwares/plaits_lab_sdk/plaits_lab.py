@@ -2204,7 +2204,7 @@ def render_stock_bench_config(engine_ids: tuple[str, ...] = STOCK_BENCH_ENGINES,
     )
     continuation = " " + "\\" + "\n  "
     members = continuation.join(
-        f'{item["source"]["className"]} {item["source"]["member"]};' for item in selected
+        f'PLAITS_ENGINE_MEMBER({item["source"]["className"]}, {item["source"]["member"]})' for item in selected
     )
     registrations = continuation.join(
         "(registry).RegisterInstance(&{member}, {enveloped}, {out_gain}, {aux_gain});".format(
@@ -2242,6 +2242,7 @@ def render_stock_bench_config(engine_ids: tuple[str, ...] = STOCK_BENCH_ENGINES,
 #define PLAITS_HAS_SPEECH_ENGINE 0
 #define PLAITS_HAS_CHIPTUNE_ENGINE 0
 #define PLAITS_HAS_USER_DATA_BANK 0
+#define PLAITS_ENGINE_OVERLAY 1
 #define PLAITS_ENGINE_MEMBERS \\
   {members}
 #define PLAITS_REGISTER_ENGINES(registry) do {{ \\
@@ -2302,7 +2303,7 @@ def render_local_hardware_config(
     includes = "\n".join(f'#include "{item["source"]["header"]}"' for item in unique)
     continuation = " " + "\\" + "\n  "
     members = continuation.join(
-        f'{item["source"]["className"]} {item["source"]["member"]};'
+        f'PLAITS_ENGINE_MEMBER({item["source"]["className"]}, {item["source"]["member"]})'
         for item in unique
     )
     registrations = continuation.join(
@@ -2338,6 +2339,7 @@ def render_local_hardware_config(
 #define PLAITS_HAS_SPEECH_ENGINE {1 if speech_mask else 0}
 #define PLAITS_HAS_CHIPTUNE_ENGINE {1 if chiptune_mask else 0}
 #define PLAITS_HAS_USER_DATA_BANK {1 if any(value >= 0 for value in user_data) else 0}
+#define PLAITS_ENGINE_OVERLAY 1
 #define PLAITS_ENGINE_MEMBERS \\
   {members}
 #define PLAITS_REGISTER_ENGINES(registry) do {{ \\
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""Per-engine CPU budget table: the calibrated estimate next to the host ratios.
+
+For every catalog engine (or every slot of a recipe) this runs estimate.py on
+the emulated Cortex-M4 and prints, as a share of the 1500-cycle-per-sample
+budget, the average at the heaviest sweep position, the 99th-percentile block
+and the single heaviest block -- the deadline is per block, so an engine whose
+average fits can still overrun on one. Next to it go the host numbers from
+plaits/test/cpu_bench (`--host <file>`, its plain `<id> <mono_ns> <stereo_ns>`
+output): mono cost relative to the stock reference engine, and stereo/mono.
+Disagreement between the two sides is the interesting part -- a host ratio
+cannot see flash wait states, which is the whole reason the emulated estimate
+exists.
+
+One command from the repository root, host bench included:
+
+    make -f plaits/test/makefile cpu-budget [RECIPE=<recipe.json>]
+
+With a recipe, only its slots are measured, stereo where the recipe builds the
+stereo render path, and the exit status is 2 if any slot is expected to exceed
+the budget -- so a recipe can be rejected for CPU before anything is flashed.
+"""
+
+from __future__ import annotations
+
+import argparse
+import concurrent.futures
+import json
+import os
+import subprocess
+import sys
+from pathlib import Path
+
+QEMU_DIR = Path(__file__).resolve().parent
+SDK_DIR = QEMU_DIR.parent
+REPO_ROOT = QEMU_DIR.parents[2]
+CATALOG_PATH = REPO_ROOT / "alt_firmwares/plaits_lab_catalog/catalog.json"
+ESTIMATE_PATH = QEMU_DIR / "estimate.py"
+
+sys.path.insert(0, str(SDK_DIR))
+from plaits_lab import CPU_REFERENCE_ENGINE  # noqa: E402
+from cost_model import CostModel  # noqa: E402
+from estimate import BLOCK_SIZE  # noqa: E402
+
+# Same thresholds as audit_catalog.py: a midpoint at or above 85%, or a band
+# crossing 100%, wants the hardware probe; a midpoint at or above 100% fails.
+# A single block over budget only asks for the probe: the heaviest block is
+# often the first one after Reset, which the module pays once per model change.
+HARDWARE_THRESHOLD = 0.85
+
+
+def catalog_ids() -> list[str]:
+    catalog = json.loads(CATALOG_PATH.read_text(encoding="utf-8"))
+    return [engine["id"] for engine in catalog["engines"]]
+
+
+def recipe_workloads(path: Path) -> list[tuple[str, bool]]:
+    """(engine id, stereo) for every filled slot of a builder recipe."""
+    recipe = json.loads(path.read_text(encoding="utf-8"))
+    ids = []
+    for slot in recipe.get("slots", []):
+        if isinstance(slot, str):
+            ids.append(slot)
+        elif isinstance(slot, dict) and isinstance(slot.get("engine"), str):
+            ids.append(slot["engine"])
+    # Schema 10+ lists the stereo engines; older recipes build every engine in
+    # stereo when the aux output is stereo (see generate_engine_config.py).
+    if "stereoEngines" in recipe:
+        stereo = set(recipe["stereoEngines"])
+    else:
+        options = recipe.get("initialOptions", {})
+        stereo = set(ids) if options.get("auxOutput") == "stereo" else set()
+    return [(engine_id, engine_id in stereo) for engine_id in dict.fromkeys(ids)]
+
+
+def load_host_bench(path: Path) -> dict[str, tuple[float, float]]:
+    """cpu_bench lines: <id> <mono_ns> <stereo_ns>. CRASHED/TIMEOUT rows are
+    left out; the table shows them without host columns."""
+    costs = {}
+    for line in path.read_text(encoding="utf-8").splitlines():
+        fields = line.split()
+        if len(fields) != 3:
+            continue
+        try:
+            costs[fields[0]] = (float(fields[1]), float(fields[2]))
+        except ValueError:
+            continue
+    return costs
+
+
+def estimate_command(engine_id: str, stereo: bool, args: argparse.Namespace) -> list[str]:
+    command = [
+        sys.executable, str(ESTIMATE_PATH), "--builtin", engine_id,
+        "--sweep", args.sweep, "--trigger", args.trigger, "--json", "--quiet",
+        "--image", args.image,
+        "--blocks-a", str(args.blocks_a), "--blocks-b", str(args.blocks_b),
+    ]
+    if stereo:
+        command.append("--stereo")
+    return command
+
+
+def measure(engine_id: str, stereo: bool, args: argparse.Namespace) -> dict:
+    result = subprocess.run(
+        estimate_command(engine_id, stereo, args), cwd=REPO_ROOT, text=True,
+        capture_output=True, check=False,
+        env=dict(os.environ, PYTHONDONTWRITEBYTECODE="1"),
+    )
+    if result.returncode:
+        detail = (result.stderr or result.stdout)[-4000:]
+        raise RuntimeError(detail.strip() or f"estimate exited {result.returncode}")
+    try:
+        return json.loads(result.stdout.strip().splitlines()[-1])
+    except (IndexError, json.JSONDecodeError) as error:
+        raise RuntimeError(f"estimate returned no JSON: {result.stdout[-1000:]}") from error
+
+
+def block_usage(model: CostModel, payload: dict, key: str) -> float | None:
+    """Usage midpoint of the heaviest per-block statistic across the sweep."""
+    values = [r["blocks"][key] for r in payload["results"] if r.get("blocks")]
+    if not values:
+        return None
+    return model.estimate(max(values) / BLOCK_SIZE)["usage"]
+
+
+def risk(payload: dict) -> str:
+    estimate = payload["estimate"]
+    worst_block = payload.get("worst_block")
+    block = worst_block["estimate"] if worst_block else estimate
+    if estimate["usage"] >= 1.0:
+        return "FAIL"
+    if (estimate["usage"] >= HARDWARE_THRESHOLD or estimate["usage_high"] >= 1.0
+            or block["usage_high"] >= 1.0):
+        return "HARDWARE"
+    return "OK"
+
+
+def percent(value: float | None) -> str:
+    return "-" if value is None else f"{100 * value:.0f}%"
+
+
+def print_table(rows: list[dict], host: dict[str, tuple[float, float]]) -> None:
+    model = CostModel()
+    reference = host.get(CPU_REFERENCE_ENGINE, (0.0, 0.0))[0]
+    print(f"\n{'risk':9} {'model':28} {'mean':>6} {'band':>10} {'p99':>6} {'worst':>6}"
+          f"  {'host ns':>9} {'x ' + CPU_REFERENCE_ENGINE:>12} {'st/mono':>8}")
+    for row in rows:
+        payload = row["payload"]
+        estimate = payload["estimate"]
+        band = f"{100*estimate['usage_low']:.0f}-{100*estimate['usage_high']:.0f}%"
+        worst_block = payload.get("worst_block")
+        name = row["id"] + (" (st)" if row["stereo"] else "")
+        line = (f"{risk(payload):9} {name:28} {percent(estimate['usage']):>6} {band:>10} "
+                f"{percent(block_usage(model, payload, 'p99')):>6} "
+                f"{percent(worst_block['estimate']['usage'] if worst_block else None):>6}")
+        if row["id"] in host:
+            mono, stereo = host[row["id"]]
+            ratio = f"{mono / reference:.2f}x" if reference > 0 else "-"
+            line += f"  {mono:9.1f} {ratio:>12} {stereo / mono:8.2f}"
+        print(line)
+    print("\nmean: the A/B render-loop average at the heaviest sweep position; p99/worst:"
+          "\nsingle blocks anywhere in the sweep. All % are midpoints of the calibrated band.")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--engine", action="append", default=[],
+                        help="measure only this catalog id (repeatable)")
+    parser.add_argument("--recipe", type=Path,
+                        help="measure the slots of a builder recipe and fail if one cannot fit")
+    parser.add_argument("--host", type=Path,
+                        help="plaits/test cpu_bench output to show next to the estimate")
+    parser.add_argument("--stereo", action="store_true",
+                        help="measure every engine on its stereo render path")
+    parser.add_argument("--sweep", choices=("quick", "extreme"), default="quick")
+    parser.add_argument("--trigger", choices=("unpatched", "patched-idle", "periodic", "both"),
+                        default="both")
+    parser.add_argument("--jobs", type=int, default=2)
+    parser.add_argument("--image", default="plaits-lab-builder:local")
+    parser.add_argument("--blocks-a", type=int, default=200)
+    parser.add_argument("--blocks-b", type=int, default=400)
+    parser.add_argument("--json", type=Path, help="also write every estimate to this file")
+    args = parser.parse_args()
+    if args.jobs < 1:
+        parser.error("--jobs must be at least 1")
+    if args.blocks_b <= args.blocks_a:
+        parser.error("--blocks-b must be greater than --blocks-a")
+
+    available = catalog_ids()
+    if args.recipe:
+        workloads = recipe_workloads(args.recipe)
+    else:
+        workloads = [(engine_id, args.stereo) for engine_id in (args.engine or available)]
+    unknown = sorted({engine_id for engine_id, _ in workloads} - set(available))
+    if unknown:
+        parser.error(f"unknown catalog ids: {', '.join(unknown)}")
+    host = load_host_bench(args.host) if args.host else {}
+
+    print(f"{len(workloads)} engines, {args.sweep} sweep, trigger {args.trigger}, "
+          f"{args.jobs} workers", flush=True)
+    rows = []
+    errors = {}
+    with concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as executor:
+        futures = {executor.submit(measure, engine_id, stereo, args): (engine_id, stereo)
+                   for engine_id, stereo in workloads}
+        for future in concurrent.futures.as_completed(futures):
+            engine_id, stereo = futures[future]
+            try:
+                payload = future.result()
+            except Exception as error:  # noqa: BLE001 - report every engine
+                errors[engine_id] = str(error)
+                print(f"ERROR     {engine_id}: {str(error).splitlines()[-1]}", flush=True)
+                continue
+            rows.append({"id": engine_id, "stereo": stereo, "payload": payload})
+            print(f"{risk(payload):9} {engine_id}", flush=True)
+
+    order = {workload: index for index, workload in enumerate(workloads)}
+    rows.sort(key=lambda row: order[(row["id"], row["stereo"])])
+    print_table(rows, host)
+    if args.json:
+        args.json.write_text(json.dumps(
+            {"host": host, "results": rows, "errors": errors},
+            indent=2, sort_keys=True) + "\n", encoding="utf-8")
+    if not any(row["payload"].get("worst_block") for row in rows) and rows:
+        print("\nno per-block counts: rebuild qemu/cycles_plugin.so from cycles_plugin.c")
+
+    failures = [row["id"] for row in rows if risk(row["payload"]) == "FAIL"]
+    if failures:
+        print(f"\nexpected to exceed the CPU budget: {', '.join(failures)}")
+    return 1 if errors else 2 if failures else 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -60,6 +60,21 @@ static uint64_t n_read_flash;
 static uint64_t n_read_ram;
 static uint64_t n_write;
 
+/* Block boundaries. Built with PLAITS_QEMU_BLOCK_MARKS, the harness executes a
+   SEV hint before its render loop and after every Engine::Render -- a
+   single-core board has no one to signal, and engine code never emits it. The
+   instructions between two marks are one audio block, so besides the A/B
+   average the SDK gets the block the deadline actually has to absorb. The
+   marks themselves are not counted, keeping the totals identical to an
+   unmarked build. */
+#define MAX_BLOCKS 65536
+static uint64_t n_marks;
+static uint64_t last_mark_insn;
+static uint64_t block_insn[MAX_BLOCKS];
+static uint64_t n_blocks;
+static uint64_t block_insn_max;
+static uint64_t block_insn_max_index;
+
 static void vcpu_insn_exec(unsigned int cpu_index, void *udata)
 {
     n_insn++;
@@ -91,6 +106,26 @@ static void vcpu_branch_exec(unsigned int cpu_index, void *udata)
     n_branch++;
 }
 
+static void vcpu_mark_exec(unsigned int cpu_index, void *udata)
+{
+    if (n_marks++ && n_blocks < MAX_BLOCKS) {
+        uint64_t insns = n_insn - last_mark_insn;
+        if (insns > block_insn_max) {
+            block_insn_max = insns;
+            block_insn_max_index = n_blocks;
+        }
+        block_insn[n_blocks++] = insns;
+    }
+    last_mark_insn = n_insn;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
 static void vcpu_mem(unsigned int cpu_index, qemu_plugin_meminfo_t info,
                      uint64_t vaddr, void *udata)
 {
@@ -112,11 +147,17 @@ static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
         uint64_t slot = vaddr >> PC_SHIFT;
         void *insn_bucket = slot < PC_BUCKETS ? &pc_insn[slot] : NULL;
         void *vcmp_bucket = slot < PC_BUCKETS ? &pc_vcmp[slot] : NULL;
-        qemu_plugin_register_vcpu_insn_exec_cb(insn, vcpu_insn_exec,
-                                               QEMU_PLUGIN_CB_NO_REGS, insn_bucket);
         /* Classify at TRANSLATION time -- once per instruction, not per
            execution -- so the extra counters cost nothing at run time. */
         char *disas = qemu_plugin_insn_disas(insn);
+        if (disas && strncmp(disas, "sev", 3) == 0) {
+            qemu_plugin_register_vcpu_insn_exec_cb(insn, vcpu_mark_exec,
+                                                   QEMU_PLUGIN_CB_NO_REGS, NULL);
+            g_free(disas);
+            continue;
+        }
+        qemu_plugin_register_vcpu_insn_exec_cb(insn, vcpu_insn_exec,
+                                               QEMU_PLUGIN_CB_NO_REGS, insn_bucket);
         if (disas) {
             if (strncmp(disas, "vdiv", 4) == 0) {
                 qemu_plugin_register_vcpu_insn_exec_cb(insn, vcpu_div_exec,
@@ -154,6 +195,18 @@ static void plugin_exit(qemu_plugin_id_t id, void *p)
             "PLAITS_QEMU_COUNTS insns=%" PRIu64 " flash_reads=%" PRIu64
             " ram_reads=%" PRIu64 " writes=%" PRIu64 " divs=%" PRIu64 " sqrts=%" PRIu64 " vcmps=%" PRIu64 " branches=%" PRIu64 "\n",
             n_insn, n_read_flash, n_read_ram, n_write, n_div, n_sqrt, n_vcmp, n_branch);
+    if (n_blocks) {
+        uint64_t total = 0;
+        for (uint64_t i = 0; i < n_blocks; ++i) {
+            total += block_insn[i];
+        }
+        qsort(block_insn, n_blocks, sizeof(block_insn[0]), compare_u64);
+        fprintf(stderr,
+                "PLAITS_QEMU_BLOCKS blocks=%" PRIu64 " insns=%" PRIu64
+                " p99=%" PRIu64 " max=%" PRIu64 " max_index=%" PRIu64 "\n",
+                n_blocks, total, block_insn[n_blocks * 99 / 100],
+                block_insn_max, block_insn_max_index);
+    }
     for (uint64_t i = 0; i < PC_BUCKETS; ++i) {
         if (pc_insn[i] || pc_vcmp[i]) {
             fprintf(stderr, "PLAITS_QEMU_PC 0x%" PRIx64 " %" PRIu64 " %" PRIu64 "\n",
@@ -140,8 +140,28 @@ COUNTS_RE = re.compile(
 
 PC_RE = re.compile(r"PLAITS_QEMU_PC 0x([0-9a-f]+) (\d+) (\d+)")
 
+# Per-block counts from the harness's block marks. Absent when the plugin was
+# built before it learned about them; everything else still works.
+BLOCKS_RE = re.compile(
+    r"PLAITS_QEMU_BLOCKS blocks=(\d+) insns=(\d+) p99=(\d+) max=(\d+)"
+    r" max_index=(\d+)"
+)
+
+
+def block_stats(stderr: str) -> dict | None:
+    """Instructions per block: mean, 99th percentile and worst, all blocks of
+    the run included -- the first one after Reset too, since the module has to
+    render that one as well."""
+    match = BLOCKS_RE.search(stderr)
+    if not match:
+        return None
+    blocks, total, p99, worst, worst_index = (int(g) for g in match.groups())
+    return {"blocks": blocks, "mean": total / blocks, "p99": float(p99),
+            "worst": float(worst), "worst_index": worst_index}
 
-def run_qemu(elf: Path, plugin: Path) -> tuple[tuple[int, ...], dict[int, tuple[int, int]]]:
+
+def run_qemu(elf: Path, plugin: Path) -> tuple[tuple[int, ...], dict[int, tuple[int, int]],
+                                               dict | None]:
     result = subprocess.run(
         ["qemu-system-arm", "-M", "mps2-an386", "-cpu", "cortex-m4",
          "-nographic", "-no-reboot",
@@ -157,7 +177,7 @@ def run_qemu(elf: Path, plugin: Path) -> tuple[tuple[int, ...], dict[int, tuple[
         )
     pcs = {int(m.group(1), 16): (int(m.group(2)), int(m.group(3)))
            for m in PC_RE.finditer(result.stderr)}
-    return tuple(int(g) for g in match.groups()), pcs
+    return tuple(int(g) for g in match.groups()), pcs, block_stats(result.stderr)
 
 
 def report_profile(symbols_path: Path, pc_lo: dict, pc_hi: dict, samples: int) -> None:
@@ -359,6 +379,7 @@ def main() -> int:
                         f"-DPLAITS_QEMU_TRIGGER_PERIOD={trigger_period}",
                         f"-DPLAITS_QEMU_STEREO={1 if args.stereo else 0}",
                         f"-DPLAITS_QEMU_LINEAR_TZFM={1 if args.linear_tzfm else 0}",
+                        "-DPLAITS_QEMU_BLOCK_MARKS=1",
                     ]
                     commands.append(" ".join(shlex.quote(c) for c in [
                         *compile_prefix, *defines, "-c", mapped_harness, "-o", harness_obj,
@@ -401,8 +422,8 @@ def main() -> int:
         results = []
         samples = (args.blocks_b - args.blocks_a) * BLOCK_SIZE
         for workload, trigger_mode, name, harm, timb, morph, macro, note in workloads:
-            lo, pc_lo = run_qemu(out_dir / f"h_{workload}_a.elf", plugin)
-            hi, pc_hi = run_qemu(out_dir / f"h_{workload}_b.elf", plugin)
+            lo, pc_lo, _ = run_qemu(out_dir / f"h_{workload}_a.elf", plugin)
+            hi, pc_hi, blocks = run_qemu(out_dir / f"h_{workload}_b.elf", plugin)
             d = [hi[i] - lo[i] for i in range(len(lo))]
             results.append({"position": name, "trigger": trigger_mode,
                             "harmonics": harm, "timbre": timb, "morph": morph,
@@ -410,9 +431,13 @@ def main() -> int:
                             "flash": d[1] / samples, "ram": d[2] / samples,
                             "writes": d[3] / samples,
                             "divs": d[4] / samples, "sqrts": d[5] / samples,
-                            "vcmps": d[6] / samples, "branches": d[7] / samples})
+                            "vcmps": d[6] / samples, "branches": d[7] / samples,
+                            "blocks": blocks})
             if not args.quiet:
-                print(f"  {trigger_mode:10} {name:14} {d[0]/samples:8.1f} instructions/sample")
+                line = f"  {trigger_mode:10} {name:14} {d[0]/samples:8.1f} instructions/sample"
+                if blocks:
+                    line += f", worst block {blocks['worst'] / BLOCK_SIZE:8.1f}"
+                print(line)
 
         if args.profile:
             report_profile(out_dir / "symbols.txt", pc_lo, pc_hi, samples)
@@ -421,6 +446,21 @@ def main() -> int:
     est = model.estimate(worst["insns"])
     symbol, sentence = model.verdict(worst["insns"])
 
+    # The audio deadline is per block, so the heaviest single block anywhere in
+    # the sweep matters on its own, whatever position has the worst average.
+    marked = [r for r in results if r["blocks"]]
+    worst_block = None
+    if marked:
+        peak = max(marked, key=lambda r: r["blocks"]["worst"])
+        insns_per_sample = peak["blocks"]["worst"] / BLOCK_SIZE
+        worst_block = {
+            "position": peak["position"],
+            "trigger": peak["trigger"],
+            "index": peak["blocks"]["worst_index"],
+            "insns": insns_per_sample,
+            "estimate": model.estimate(insns_per_sample),
+        }
+
     payload = {
         "engine": args.builtin or str(args.package),
         "stereo": args.stereo,
@@ -429,6 +469,7 @@ def main() -> int:
         "results": results,
         "worst": worst,
         "estimate": est,
+        "worst_block": worst_block,
         "verdict": {"symbol": symbol, "sentence": sentence},
     }
     if args.json:
@@ -438,13 +479,22 @@ def main() -> int:
     if args.quiet:
         print(f"RESULT worst={worst['trigger']}/{worst['position']} insns={worst['insns']:.1f} "
               f"vcmps={worst['vcmps']:.1f} branches={worst['branches']:.1f} "
-              f"divs={worst['divs']:.2f} usage={100*est['usage']:.0f}%")
+              f"divs={worst['divs']:.2f} usage={100*est['usage']:.0f}%"
+              + (f" worst_block={100*worst_block['estimate']['usage']:.0f}%"
+                 if worst_block else ""))
         return 0
 
     print(f"\nworst case: {worst['trigger']}/{worst['position']}  ({worst['insns']:.1f} instructions/sample)")
     if len(results) > 1:
         spread = worst["insns"] / min(r["insns"] for r in results)
         print(f"  cost varies {spread:.2f}x across the parameter space")
+    if worst_block:
+        block_est = worst_block["estimate"]
+        print(f"  heaviest single block: {worst_block['trigger']}/{worst_block['position']} "
+              f"block {worst_block['index']}, {worst_block['insns']:.1f} instructions/sample, "
+              f"~{100*block_est['usage']:.0f}% "
+              f"({100*block_est['usage_low']:.0f}-{100*block_est['usage_high']:.0f}%) "
+              f"of that block's budget")
     print(f"\n{symbol}: approximately {100*est['usage']:.0f}% of the CPU budget "
           f"(likely {100*est['usage_low']:.0f}-{100*est['usage_high']:.0f}%) -- {sentence}")
     print(f"\n{model.outlier_note()}")
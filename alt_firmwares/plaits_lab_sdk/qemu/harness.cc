@@ -80,6 +80,19 @@ using namespace plaits;
 #define PLAITS_QEMU_LINEAR_TZFM 0
 #endif
 
+// Mark every block boundary with a SEV hint, which cycles_plugin.c turns into
+// per-block instruction counts (and leaves out of every total). The marks are
+// what let the SDK report the worst single block next to the A/B average.
+#ifndef PLAITS_QEMU_BLOCK_MARKS
+#define PLAITS_QEMU_BLOCK_MARKS 0
+#endif
+
+static inline void MarkBlock() {
+#if PLAITS_QEMU_BLOCK_MARKS
+  asm volatile("sev" : : : "memory");
+#endif
+}
+
 // Semihosting: the only way out of a bare-metal guest. bkpt 0xAB is the ARM
 // convention; QEMU implements it when started with -semihosting-config.
 static inline int Semihost(int op, void* arg) {
@@ -128,6 +141,7 @@ int main() {
   float aux[kBlockSize];
   bool already_enveloped = false;
 
+  MarkBlock();
   for (int i = 0; i < PLAITS_QEMU_BLOCKS; ++i) {
 #if PLAITS_QEMU_TRIGGER_PERIOD > 0
     // Exercise the active, patched workload too. A constant patched-idle
@@ -137,6 +151,7 @@ int main() {
     p.trigger = (i % PLAITS_QEMU_TRIGGER_PERIOD) == 0 ? 1 : 0;
 #endif
     engine.Render(p, out, aux, kBlockSize, &already_enveloped);
+    MarkBlock();
     g_sink += out[0] + aux[0];
   }
 
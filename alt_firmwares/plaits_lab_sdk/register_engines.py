@@ -8,6 +8,7 @@ are shared, so they are written here instead, in one serial pass:
     alt_firmwares/plaits_lab_catalog/catalog.json   engine record + manual
     plaits/test/makefile                            the .cc in the test build
     plaits/test/cpu_bench.cc                        include + bench<> line
+    plaits/test/batch_render.cc                     include + BATCH_ENGINE row
     plaits/test/plaits_test.cc                      include + audition + validators
 
 Everything written here is derived from the package's own plaits-engine.json,
@@ -33,6 +34,7 @@ PACKAGES = SDK_DIR / "packages" / "mutable-instruments"
 CATALOG = REPO_ROOT / "alt_firmwares" / "plaits_lab_catalog" / "catalog.json"
 TEST_MAKEFILE = REPO_ROOT / "plaits" / "test" / "makefile"
 CPU_BENCH = REPO_ROOT / "plaits" / "test" / "cpu_bench.cc"
+BATCH_RENDER = REPO_ROOT / "plaits" / "test" / "batch_render.cc"
 PLAITS_TEST = REPO_ROOT / "plaits" / "test" / "plaits_test.cc"
 
 
@@ -211,6 +213,17 @@ def register_build_files(manifest: dict, audition_index: int) -> None:
             f'  bench<BowedEngine>("bowed");\n  bench<{class_name}>("{engine_id}");', 1)
         CPU_BENCH.write_text(text)
 
+    text = BATCH_RENDER.read_text()
+    if header not in text:
+        text = text.replace(
+            '#include "plaits/dsp/engine2/bowed_engine.h"',
+            f'#include "plaits/dsp/engine2/bowed_engine.h"\n#include "{header}"', 1)
+        text = text.replace(
+            '  BATCH_ENGINE(BowedEngine, "bowed", -1),',
+            f'  BATCH_ENGINE(BowedEngine, "bowed", -1),\n'
+            f'  BATCH_ENGINE({class_name}, "{engine_id}", -1),', 1)
+        BATCH_RENDER.write_text(text)
+
     text = PLAITS_TEST.read_text()
     if header not in text:
         text = text.replace(
@@ -1,4 +1,6 @@
+import json
 import sys
+import tempfile
 import unittest
 from pathlib import Path
 
@@ -6,6 +8,7 @@ QEMU_DIR = Path(__file__).resolve().parents[1] / "qemu"
 sys.path.insert(0, str(QEMU_DIR))
 
 import audit_catalog
+import budget_table
 import estimate
 
 
@@ -64,5 +67,51 @@ class AuditCatalogTest(unittest.TestCase):
         self.assertIn("--json", command)
 
 
+class BudgetTableTest(unittest.TestCase):
+    def test_block_marks_are_parsed_from_plugin_output(self):
+        stats = estimate.block_stats(
+            "PLAITS_QEMU_COUNTS insns=1 flash_reads=0 ram_reads=0 writes=0 divs=0 "
+            "sqrts=0 vcmps=0 branches=0\n"
+            "PLAITS_QEMU_BLOCKS blocks=400 insns=2400000 p99=7000 max=9000 max_index=0\n")
+        self.assertEqual(stats["blocks"], 400)
+        self.assertEqual(stats["mean"], 6000.0)
+        self.assertEqual(stats["worst"], 9000.0)
+        self.assertEqual(stats["worst_index"], 0)
+        self.assertIsNone(estimate.block_stats("PLAITS_QEMU_COUNTS insns=1"))
+
+    def test_recipe_stereo_follows_the_builder_rules(self):
+        with tempfile.TemporaryDirectory() as temp:
+            path = Path(temp) / "recipe.json"
+            path.write_text(json.dumps({
+                "slots": ["chords", None, {"engine": "swarm"}, "chords"],
+                "stereoEngines": ["swarm"],
+            }))
+            self.assertEqual(budget_table.recipe_workloads(path),
+                             [("chords", False), ("swarm", True)])
+            path.write_text(json.dumps({
+                "slots": ["chords", "swarm"],
+                "initialOptions": {"auxOutput": "stereo"},
+            }))
+            self.assertEqual(budget_table.recipe_workloads(path),
+                             [("chords", True), ("swarm", True)])
+
+    def test_host_bench_skips_crashed_rows(self):
+        with tempfile.TemporaryDirectory() as temp:
+            path = Path(temp) / "cpu_bench.txt"
+            path.write_text("two-op-fm 100.0 120.0\nchords CRASHED\n")
+            self.assertEqual(budget_table.load_host_bench(path),
+                             {"two-op-fm": (100.0, 120.0)})
+
+    def test_only_the_average_can_fail_a_recipe(self):
+        def payload(mid, high, block_mid, block_high):
+            return {"estimate": {"usage": mid, "usage_high": high},
+                    "worst_block": {"estimate": {"usage": block_mid,
+                                                 "usage_high": block_high}}}
+
+        self.assertEqual(budget_table.risk(payload(0.6, 0.8, 0.7, 0.9)), "OK")
+        self.assertEqual(budget_table.risk(payload(0.6, 0.8, 1.2, 1.5)), "HARDWARE")
+        self.assertEqual(budget_table.risk(payload(1.05, 1.3, 1.2, 1.5)), "FAIL")
+
+
 if __name__ == "__main__":
     unittest.main()
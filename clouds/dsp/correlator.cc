@@ -42,34 +42,160 @@ void Correlator::Init(uint32_t* source, uint32_t* destination) {
   done_ = true;
 }
 
+uint32_t Correlator::Score(int32_t candidate) const {
+  uint32_t num_words = size_ >> 5;
+  uint32_t offset_words = candidate >> 5;
+  uint32_t offset_bits = candidate & 0x1f;
+  const uint32_t* source = &source_[0];
+  const uint32_t* destination = &destination_[offset_words];
+  
+  // The mismatching bits are counted per byte, and the byte counts of up to
+  // 31 words (at most 248) are added before being summed.
+  uint32_t mismatches = 0;
+  uint32_t i = 0;
+#ifdef CLOUDS_CORRELATOR_SIMD
+#if defined(__SSE2__)
+  // A right shift by 32 clears the lanes, as the shifts of the Cortex-M4 do.
+  const __m128i left = _mm_cvtsi32_si128(offset_bits);
+  const __m128i right = _mm_cvtsi32_si128(32 - offset_bits);
+  const __m128i m1 = _mm_set1_epi32(0x55555555);
+  const __m128i m2 = _mm_set1_epi32(0x33333333);
+  const __m128i m4 = _mm_set1_epi32(0x0f0f0f0f);
+  while (i + 4 <= num_words) {
+    uint32_t end = min(num_words & ~3, i + 4 * 31);
+    __m128i bytes = _mm_setzero_si128();
+    for (; i < end; i += 4) {
+      __m128i d = _mm_or_si128(
+          _mm_sll_epi32(
+              _mm_loadu_si128((const __m128i*)(destination + i)), left),
+          _mm_srl_epi32(
+              _mm_loadu_si128((const __m128i*)(destination + i + 1)), right));
+      __m128i count = _mm_xor_si128(
+          _mm_loadu_si128((const __m128i*)(source + i)), d);
+      count = _mm_sub_epi32(count, _mm_and_si128(_mm_srli_epi32(count, 1), m1));
+      count = _mm_add_epi32(
+          _mm_and_si128(count, m2),
+          _mm_and_si128(_mm_srli_epi32(count, 2), m2));
+      count = _mm_and_si128(_mm_add_epi32(count, _mm_srli_epi32(count, 4)), m4);
+      bytes = _mm_add_epi8(bytes, count);
+    }
+    bytes = _mm_sad_epu8(bytes, _mm_setzero_si128());
+    mismatches += _mm_cvtsi128_si32(bytes);
+    mismatches += _mm_cvtsi128_si32(_mm_unpackhi_epi64(bytes, bytes));
+  }
+#else
+  // A shift by -32 (to the right) clears the lanes, as above.
+  const int32x4_t left = vdupq_n_s32(offset_bits);
+  const int32x4_t right = vdupq_n_s32(static_cast<int32_t>(offset_bits) - 32);
+  while (i + 4 <= num_words) {
+    uint32_t end = min(num_words & ~3, i + 4 * 31);
+    uint8x16_t bytes = vdupq_n_u8(0);
+    for (; i < end; i += 4) {
+      uint32x4_t d = vorrq_u32(
+          vshlq_u32(vld1q_u32(destination + i), left),
+          vshlq_u32(vld1q_u32(destination + i + 1), right));
+      uint32x4_t count = veorq_u32(vld1q_u32(source + i), d);
+      bytes = vaddq_u8(bytes, vcntq_u8(vreinterpretq_u8_u32(count)));
+    }
+    uint64x2_t sums = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(bytes)));
+    mismatches += vgetq_lane_u64(sums, 0) + vgetq_lane_u64(sums, 1);
+  }
+#endif  // __SSE2__
+#endif  // CLOUDS_CORRELATOR_SIMD
+  while (i < num_words) {
+    uint32_t end = min(num_words, i + 31);
+    uint32_t bytes = 0;
+    for (; i < end; ++i) {
+      // Shifting right in two steps keeps the shift below 32 when the
+      // candidate is word-aligned.
+      uint32_t destination_bits = destination[i] << offset_bits;
+      destination_bits |= (destination[i + 1] >> 1) >> (31 - offset_bits);
+      uint32_t count = source[i] ^ destination_bits;
+      count = count - ((count >> 1) & 0x55555555);
+      count = (count & 0x33333333) + ((count >> 2) & 0x33333333);
+      bytes += (count + (count >> 4)) & 0x0f0f0f0f;
+    }
+    bytes = (bytes & 0x00ff00ff) + ((bytes >> 8) & 0x00ff00ff);
+    mismatches += (bytes & 0xffff) + (bytes >> 16);
+  }
+  return (num_words << 5) - mismatches;
+}
+
+#ifdef CLOUDS_CORRELATOR_COARSE_SEARCH
+void Correlator::AddCoarseMatch(int32_t candidate, uint32_t score) {
+  // A candidate next to a kept one replaces it if it scores better - both
+  // would be refined around the same peak.
+  int32_t i = 0;
+  while (i < num_coarse_matches_ &&
+         candidate - coarse_match_[i] > kCorrelatorCoarseStride) {
+    ++i;
+  }
+  if (i == num_coarse_matches_) {
+    if (i < kCorrelatorNumCoarseMatches) {
+      ++num_coarse_matches_;
+    } else {
+      // Replace the lowest scoring match, if lower than this one.
+      i = 0;
+      for (int32_t j = 1; j < num_coarse_matches_; ++j) {
+        if (coarse_score_[j] < coarse_score_[i]) {
+          i = j;
+        }
+      }
+      if (coarse_score_[i] >= score) {
+        return;
+      }
+    }
+  } else if (coarse_score_[i] >= score) {
+    return;
+  }
+  coarse_match_[i] = candidate;
+  coarse_score_[i] = score;
+}
+#endif  // CLOUDS_CORRELATOR_COARSE_SEARCH
+
 void Correlator::EvaluateNextCandidate() {
   if (done_) {
     return;
   }
-  uint32_t num_words = size_ >> 5;
-  uint32_t offset_words = candidate_ >> 5;
-  uint32_t offset_bits = candidate_ & 0x1f;
-  uint32_t* source = &source_[0];
-  uint32_t* destination = &destination_[offset_words];
-  
-  uint32_t xcorr = 0;
-  for (uint32_t i = 0; i < num_words; ++i) {
-    uint32_t source_bits = source[i];
-    uint32_t destination_bits = 0;
-    destination_bits |= destination[i] << offset_bits;
-    destination_bits |= destination[i + 1] >> (32 - offset_bits);
-    uint32_t count = ~(source_bits ^ destination_bits);
-    count = count - ((count >> 1) & 0x55555555);
-    count = (count & 0x33333333) + ((count >> 2) & 0x33333333);
-    count = (((count + (count >> 4)) & 0xf0f0f0f) * 0x1010101) >> 24;
-    xcorr += count;
-  }
+  uint32_t xcorr = Score(candidate_);
   if (xcorr > best_score_) {
     best_match_ = candidate_;
     best_score_ = xcorr;
   }
+#ifdef CLOUDS_CORRELATOR_COARSE_SEARCH
+  if (coarse_) {
+    AddCoarseMatch(candidate_, xcorr);
+    candidate_ += kCorrelatorCoarseStride;
+    if (candidate_ >= size_) {
+      coarse_ = false;
+      num_refined_ = 0;
+      last_candidate_ = -1;
+    }
+  } else {
+    ++candidate_;
+    if (candidate_ % kCorrelatorCoarseStride == 0) {
+      // Already scored.
+      ++candidate_;
+    }
+  }
+  while (!coarse_ && candidate_ > last_candidate_) {
+    if (num_refined_ < num_coarse_matches_) {
+      // Score the candidates between the next coarse match and its neighbours.
+      int32_t match = coarse_match_[num_refined_++];
+      candidate_ = max(match - kCorrelatorCoarseStride + 1, 0);
+      last_candidate_ = min(match + kCorrelatorCoarseStride - 1, size_ - 1);
+      if (candidate_ % kCorrelatorCoarseStride == 0) {
+        ++candidate_;
+      }
+    } else {
+      done_ = true;
+      break;
+    }
+  }
+#else
   ++candidate_;
   done_ = candidate_ >= size_;
+#endif  // CLOUDS_CORRELATOR_COARSE_SEARCH
 }
 
 void Correlator::StartSearch(
@@ -81,6 +207,11 @@ void Correlator::StartSearch(
   best_score_ = 0;
   best_match_ = 0;
   candidate_ = 0;
+#ifdef CLOUDS_CORRELATOR_COARSE_SEARCH
+  last_candidate_ = size - 1;
+  coarse_ = true;
+  num_coarse_matches_ = 0;
+#endif  // CLOUDS_CORRELATOR_COARSE_SEARCH
   size_ = size;
   done_ = false;
 }
@@ -27,13 +27,39 @@
 // Search for stretch/shift splicing points by maximizing correlation.
 // Correlation is computed by XOR-ing the bit sign of samples - this allows
 // 32 samples to be matched in one single XOR operation.
+//
+// Every candidate is scored. With CLOUDS_CORRELATOR_COARSE_SEARCH defined,
+// the search has two passes instead: every kCorrelatorCoarseStride-th
+// candidate is scored first, then the candidates between the
+// kCorrelatorNumCoarseMatches best of them (the highest peaks, rather than
+// the samples around the single highest one) and their neighbours. This
+// halves the number of candidates to score, but misses the best splice point
+// in 12-30% of the searches on a tone and 71-79% on white noise (see
+// clouds/test/correlator_bench.cc); keeping more peaks or scoring wider
+// around them does not close the gap.
+//
+// On the host, the mismatching bits are counted four words at a time with
+// SSE2 or NEON. The counts are integers, so both paths find the same match.
 
 #ifndef CLOUDS_DSP_CORRELATOR_H_
 #define CLOUDS_DSP_CORRELATOR_H_
 
 #include "stmlib/stmlib.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define CLOUDS_CORRELATOR_SIMD
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define CLOUDS_CORRELATOR_SIMD
+#endif
+
 namespace clouds {
+
+#ifdef CLOUDS_CORRELATOR_COARSE_SEARCH
+const int32_t kCorrelatorCoarseStride = 2;
+const int32_t kCorrelatorNumCoarseMatches = 4;
+#endif  // CLOUDS_CORRELATOR_COARSE_SEARCH
   
 class Correlator {
  public:
@@ -48,8 +74,11 @@ class Correlator {
     return offset_ + (best_match_ * (increment_ >> 4) >> 12);
   }
 
+  // A third of the candidates (the original firmware scored a quarter) per
+  // call: Score() costs less per candidate than it did, and a search now
+  // ends in 3 calls rather than 4.
   inline void EvaluateSomeCandidates() {
-    size_t num_candidates = (size_ >> 2) + 16;
+    size_t num_candidates = size_ / 3 + 16;
     while (num_candidates) {
       EvaluateNextCandidate();
       --num_candidates;
@@ -57,6 +86,10 @@ class Correlator {
   }
 
   void EvaluateNextCandidate();
+  
+  // Number of matching sign bits between the source and the destination
+  // delayed by candidate bits.
+  uint32_t Score(int32_t candidate) const;
 
   inline uint32_t* source() { return source_; }
   inline uint32_t* destination() { return destination_; }
@@ -65,6 +98,10 @@ class Correlator {
   inline bool done() { return done_; }
   
  private:
+#ifdef CLOUDS_CORRELATOR_COARSE_SEARCH
+  void AddCoarseMatch(int32_t candidate, uint32_t score);
+#endif  // CLOUDS_CORRELATOR_COARSE_SEARCH
+
   uint32_t* source_;
   uint32_t* destination_;
   
@@ -76,8 +113,15 @@ class Correlator {
   uint32_t best_score_;
   int32_t best_match_;
   
-  int32_t trace_;
-  
+#ifdef CLOUDS_CORRELATOR_COARSE_SEARCH
+  int32_t last_candidate_;
+  int32_t coarse_match_[kCorrelatorNumCoarseMatches];
+  uint32_t coarse_score_[kCorrelatorNumCoarseMatches];
+  int32_t num_coarse_matches_;
+  int32_t num_refined_;
+  bool coarse_;
+#endif  // CLOUDS_CORRELATOR_COARSE_SEARCH
+
   bool done_;
   
   DISALLOW_COPY_AND_ASSIGN(Correlator);
@@ -24,7 +24,7 @@
 //
 // -----------------------------------------------------------------------------
 //
-// Single grain synthesis.
+// Grain synthesis.
 
 #ifndef CLOUDS_DSP_GRAIN_H_
 #define CLOUDS_DSP_GRAIN_H_
@@ -39,23 +39,31 @@
 
 namespace clouds {
 
+const int32_t kMaxNumGrains = 64;
+
 enum GrainQuality {
   GRAIN_QUALITY_LOW,
   GRAIN_QUALITY_MEDIUM,
   GRAIN_QUALITY_HIGH
 };
 
-class Grain {
+// The state of all the grains, stored as one array per field rather than as
+// an array of grain objects. A grain is playing while its bit is set in
+// active_, so the active grains can be listed without visiting the others.
+class GrainStore {
  public:
-  Grain() { }
-  ~Grain() { }
+  GrainStore() { }
+  ~GrainStore() { }
 
   void Init() {
-    active_ = false;
-    envelope_phase_ = 2.0f;
+    active_ = 0;
+    for (int32_t i = 0; i < kMaxNumGrains; ++i) {
+      envelope_phase_[i] = 2.0f;
+    }
   }
 
   void Start(
+      int32_t index,
       int32_t pre_delay,
       int32_t buffer_size,
       int32_t start,
@@ -65,97 +73,124 @@ class Grain {
       float gain_l,
       float gain_r,
       GrainQuality recommended_quality) {
-    pre_delay_ = pre_delay;
-    width_ = width;
-    first_sample_ = (start + buffer_size) % buffer_size;
-    phase_increment_ = phase_increment;
-    phase_ = 0;
-    envelope_phase_ = 0.0f;
-    envelope_phase_increment_ = 2.0f / static_cast<float>(width);
+    pre_delay_[index] = pre_delay;
+    first_sample_[index] = (start + buffer_size) % buffer_size;
+    phase_increment_[index] = phase_increment;
+    phase_[index] = 0;
+    envelope_phase_[index] = 0.0f;
+    envelope_phase_increment_[index] = 2.0f / static_cast<float>(width);
     if (window_shape >= 0.5f) {
-      envelope_smoothness_ = (window_shape - 0.5f) * 2.0f;
-      envelope_slope_ = 0.0f;
+      envelope_smoothness_[index] = (window_shape - 0.5f) * 2.0f;
+      envelope_slope_[index] = 0.0f;
     } else {
-      envelope_smoothness_ = 0.0f;
-      envelope_slope_ = 0.5f / (window_shape + 0.01f);
+      envelope_smoothness_[index] = 0.0f;
+      envelope_slope_[index] = 0.5f / (window_shape + 0.01f);
     }
-    active_ = true;
-    gain_l_ = gain_l;
-    gain_r_ = gain_r;
-    recommended_quality_ = recommended_quality;
+    active_ |= uint64_t(1) << index;
+    gain_l_[index] = gain_l;
+    gain_r_[index] = gain_r;
+    recommended_quality_[index] = recommended_quality;
   }
-  
-  template<bool use_lut_for_envelope, GrainQuality quality>
-  inline void RenderEnvelope(float* destination, size_t size) {
-    const float increment = envelope_phase_increment_;
-    const float smoothness = envelope_smoothness_;
-    const float slope = envelope_slope_;
-
-    float phase = envelope_phase_;
-    while (size--) {
-      float gain = phase;
-      gain = gain >= 1.0f ? 2.0f - gain : gain;
-      if (use_lut_for_envelope) {
-        if (quality == GRAIN_QUALITY_HIGH) {
-          float window = 0.0f;
-          window = stmlib::Interpolate(lut_window, gain, 4096.0f);
-          gain += smoothness * (window - gain);
-        }
-      } else {
-        if (quality >= GRAIN_QUALITY_MEDIUM) {
-          gain *= slope;
-          if (gain >= 1.0f) gain = 1.0f;
-        }
+
+  // Writes the indices of the grains below num_grains that are free, in
+  // ascending order, and returns how many there are.
+  inline int32_t ListAvailable(int32_t num_grains, int32_t* list) const {
+    int32_t n = 0;
+    for (int32_t i = 0; i < num_grains; ++i) {
+      if (!(active_ & (uint64_t(1) << i))) {
+        list[n++] = i;
       }
-      phase += increment;
-      if (phase >= 2.0f) {
-        *destination = -1.0f;
-        break;
+    }
+    return n;
+  }
+
+  // Same for the grains that are playing.
+  inline int32_t ListActive(int32_t num_grains, int32_t* list) const {
+    int32_t n = 0;
+    for (int32_t i = 0; i < num_grains; ++i) {
+      if (active_ & (uint64_t(1) << i)) {
+        list[n++] = i;
       }
-      *destination++ = gain;
     }
-    envelope_phase_ = phase;
+    return n;
   }
-  
+
+  // Renders one grain and adds it to destination. The envelope is computed
+  // along with the samples it scales, and the grain is released when its
+  // envelope ends.
   template<int32_t num_channels, GrainQuality quality, Resolution resolution>
   inline void OverlapAdd(
+      int32_t index,
       const AudioBuffer<resolution>* buffer,
       float* destination,
-      float* envelope,
       size_t size) {
-    if (!active_) {
-      return;
-    }
     // Rendering is done on 32-sample long blocks. The pre-delay allows grains
     // to start at arbitrary samples within a block, rather than at block
     // boundaries.
-    while (pre_delay_ && size) {
+    int32_t pre_delay = pre_delay_[index];
+    while (pre_delay && size) {
       destination += 2;
       --size;
-      --pre_delay_;
+      --pre_delay;
     }
-    
-    // Pre-render the envelope in one pass.
-    if (envelope_smoothness_ == 0.0f) {
-      RenderEnvelope<false, quality>(envelope, size);
+    pre_delay_[index] = pre_delay;
+
+    if (envelope_smoothness_[index] == 0.0f) {
+      Render<num_channels, quality, false>(index, buffer, destination, size);
     } else {
-      RenderEnvelope<true, quality>(envelope, size);
+      Render<num_channels, quality, true>(index, buffer, destination, size);
     }
-    
-    const int32_t phase_increment = phase_increment_;
-    const int32_t first_sample = first_sample_;
-    const float gain_l = gain_l_;
-    const float gain_r = gain_r_;
-    int32_t phase = phase_;
+  }
+
+  inline int32_t num_active() const {
+    return __builtin_popcountll(active_);
+  }
+
+  inline GrainQuality recommended_quality(int32_t index) const {
+    return recommended_quality_[index];
+  }
+
+ private:
+  template<
+      int32_t num_channels,
+      GrainQuality quality,
+      bool use_lut_for_envelope,
+      Resolution resolution>
+  inline void Render(
+      int32_t index,
+      const AudioBuffer<resolution>* buffer,
+      float* destination,
+      size_t size) {
+    const float envelope_increment = envelope_phase_increment_[index];
+    const float smoothness = envelope_smoothness_[index];
+    const float slope = envelope_slope_[index];
+    const int32_t phase_increment = phase_increment_[index];
+    const int32_t first_sample = first_sample_[index];
+    const float gain_l = gain_l_[index];
+    const float gain_r = gain_r_[index];
+    float envelope_phase = envelope_phase_[index];
+    int32_t phase = phase_[index];
     while (size--) {
-      int32_t sample_index = first_sample + (phase >> 16);
-      
-      float gain = *envelope++;
-      if (gain == -1.0f) {
-        active_ = false;
+      float gain = envelope_phase;
+      gain = gain >= 1.0f ? 2.0f - gain : gain;
+      if (use_lut_for_envelope) {
+        if (quality == GRAIN_QUALITY_HIGH) {
+          float window = stmlib::Interpolate(lut_window, gain, 4096.0f);
+          gain += smoothness * (window - gain);
+        }
+      } else {
+        if (quality >= GRAIN_QUALITY_MEDIUM) {
+          gain *= slope;
+          if (gain >= 1.0f) gain = 1.0f;
+        }
+      }
+      envelope_phase += envelope_increment;
+      if (envelope_phase >= 2.0f) {
+        active_ &= ~(uint64_t(1) << index);
         break;
       }
 
+      int32_t sample_index = first_sample + (phase >> 16);
       float l = buffer[0].template Read<InterpolationMethod(quality)>(
           sample_index, phase & 65535) * gain;
       if (num_channels == 1) {
@@ -169,35 +204,28 @@ class Grain {
       }
       phase += phase_increment;
     }
-    phase_ = phase;
-  }
-  
-  inline bool active() { return active_; }
-  
-  inline GrainQuality recommended_quality() const {
-    return recommended_quality_;
+    envelope_phase_[index] = envelope_phase;
+    phase_[index] = phase;
   }
 
- private:
-  int32_t first_sample_;
-  int32_t width_;
-  int32_t phase_;
-  int32_t phase_increment_;
-  int32_t pre_delay_;
+  uint64_t active_;
+
+  int32_t first_sample_[kMaxNumGrains];
+  int32_t phase_[kMaxNumGrains];
+  int32_t phase_increment_[kMaxNumGrains];
+  int32_t pre_delay_[kMaxNumGrains];
 
-  float envelope_smoothness_;
-  float envelope_slope_;
-  float envelope_phase_;
-  float envelope_phase_increment_;
+  float envelope_smoothness_[kMaxNumGrains];
+  float envelope_slope_[kMaxNumGrains];
+  float envelope_phase_[kMaxNumGrains];
+  float envelope_phase_increment_[kMaxNumGrains];
 
-  float gain_l_;
-  float gain_r_;
+  float gain_l_[kMaxNumGrains];
+  float gain_r_[kMaxNumGrains];
 
-  bool active_;
-  
-  GrainQuality recommended_quality_;
+  GrainQuality recommended_quality_[kMaxNumGrains];
 
-  DISALLOW_COPY_AND_ASSIGN(Grain);
+  DISALLOW_COPY_AND_ASSIGN(GrainStore);
 };
 
 }  // namespace clouds
@@ -46,8 +46,6 @@
 
 namespace clouds {
 
-const int32_t kMaxNumGrains = 64;
-
 using namespace stmlib;
 
 class GranularSamplePlayer {
@@ -59,9 +57,7 @@ class GranularSamplePlayer {
     max_num_grains_ = max_num_grains;
     num_midfi_grains_ = 3 * max_num_grains / 4;
     gain_normalization_ = 1.0f;
-    for (int32_t i = 0; i < kMaxNumGrains; ++i) {
-      grains_[i].Init();
-    }
+    grains_.Init();
     num_grains_ = 0.0f;
     num_channels_ = num_channels;
     grain_size_hint_ = 1024.0f;
@@ -104,9 +100,8 @@ class GranularSamplePlayer {
           quality = GRAIN_QUALITY_HIGH;
         }
         
-        Grain* g = &grains_[index];
         ScheduleGrain(
-            g,
+            index,
             parameters,
             t,
             buffer->size(),
@@ -119,26 +114,26 @@ class GranularSamplePlayer {
     
     // Overlap grains.
     std::fill(&out[0], &out[size * 2], 0.0f);
-    float* e = envelope_buffer_;
-    for (int32_t i = 0; i < max_num_grains_; ++i) {
-      Grain* g = &grains_[i];
-      if (g->recommended_quality() == GRAIN_QUALITY_HIGH) {
+    int32_t num_active = grains_.ListActive(max_num_grains_, active_grains_);
+    for (int32_t i = 0; i < num_active; ++i) {
+      int32_t g = active_grains_[i];
+      if (grains_.recommended_quality(g) == GRAIN_QUALITY_HIGH) {
         if (num_channels_ == 1) {
-          g->OverlapAdd<1, GRAIN_QUALITY_HIGH>(buffer, out, e, size);
+          grains_.OverlapAdd<1, GRAIN_QUALITY_HIGH>(g, buffer, out, size);
         } else {
-          g->OverlapAdd<2, GRAIN_QUALITY_HIGH>(buffer, out, e, size);
+          grains_.OverlapAdd<2, GRAIN_QUALITY_HIGH>(g, buffer, out, size);
         }
-      } else if (g->recommended_quality() == GRAIN_QUALITY_MEDIUM) {
+      } else if (grains_.recommended_quality(g) == GRAIN_QUALITY_MEDIUM) {
         if (num_channels_ == 1) {
-          g->OverlapAdd<1, GRAIN_QUALITY_MEDIUM>(buffer, out, e, size);
+          grains_.OverlapAdd<1, GRAIN_QUALITY_MEDIUM>(g, buffer, out, size);
         } else {
-          g->OverlapAdd<2, GRAIN_QUALITY_MEDIUM>(buffer, out, e, size);
+          grains_.OverlapAdd<2, GRAIN_QUALITY_MEDIUM>(g, buffer, out, size);
         }
       } else {
         if (num_channels_ == 1) {
-          g->OverlapAdd<1, GRAIN_QUALITY_LOW>(buffer, out, e, size);
+          grains_.OverlapAdd<1, GRAIN_QUALITY_LOW>(g, buffer, out, size);
         } else {
-          g->OverlapAdd<2, GRAIN_QUALITY_LOW>(buffer, out, e, size);
+          grains_.OverlapAdd<2, GRAIN_QUALITY_LOW>(g, buffer, out, size);
         }
       }
     }
@@ -163,20 +158,17 @@ class GranularSamplePlayer {
     }
   }
   
+  inline int32_t num_active_grains() const {
+    return grains_.num_active();
+  }
+  
  private:
   int32_t FillAvailableGrainsList() {
-    int32_t num_available_grains = 0;
-    for (int32_t i = 0; i < max_num_grains_; ++i) {
-      if (!grains_[i].active()) {
-        available_grains_[num_available_grains] = i;
-        ++num_available_grains;
-      }
-    }
-    return num_available_grains;
+    return grains_.ListAvailable(max_num_grains_, available_grains_);
   }
   
   void ScheduleGrain(
-      Grain* grain,
+      int32_t index,
       const Parameters& parameters,
       int32_t pre_delay,
       int32_t buffer_size,
@@ -222,7 +214,8 @@ class GranularSamplePlayer {
     int32_t size = static_cast<int32_t>(grain_size) & ~1;
     int32_t start = buffer_head - static_cast<int32_t>(
         position * available + eaten_by_play_head);
-    grain->Start(
+    grains_.Start(
+        index,
         pre_delay,
         buffer_size,
         start,
@@ -244,9 +237,9 @@ class GranularSamplePlayer {
   float grain_size_hint_;
   float grain_rate_phasor_;
   
-  Grain grains_[kMaxNumGrains];
+  GrainStore grains_;
   int32_t available_grains_[kMaxNumGrains];
-  float envelope_buffer_[kMaxBlockSize];
+  int32_t active_grains_[kMaxNumGrains];
   
   DISALLOW_COPY_AND_ASSIGN(GranularSamplePlayer);
 };
@@ -92,8 +92,8 @@ void FrameTransformation::Process(
     AddGlitch(ifft_in);
   }
   QuantizeMagnitudes(ifft_in, parameters.spectral.quantization);
-  SetPhases(ifft_in, parameters.spectral.phase_randomization, pitch_ratio);
-  PolarToRectangular(ifft_in);
+  PolarToRectangular(
+      ifft_in, parameters.spectral.phase_randomization, pitch_ratio);
 
   if (!glitch) {
     // Decide on which glitch algorithm will be used next time... if glitch
@@ -116,34 +116,31 @@ void FrameTransformation::RectangularToPolar(float* fft_data) {
   }
 }
 
-void FrameTransformation::SetPhases(
-    float* destination,
+void FrameTransformation::PolarToRectangular(
+    float* fft_data,
     float phase_randomization,
     float pitch_ratio) {
-  uint32_t* synthesis_phase = (uint32_t*) &destination[fft_size_ >> 1];
-  for (int32_t i = 0; i < size_; ++i) {
-    synthesis_phase[i] = phases_[i];
-    phases_[i] += static_cast<uint16_t>(
-        static_cast<float>(phases_delta_[i]) * pitch_ratio);
-  }
+  float* real = &fft_data[0];
+  float* imag = &fft_data[fft_size_ >> 1];
+  const float* magnitude = &fft_data[0];
+  
   float r = phase_randomization;
   r = (r - 0.05f) * 1.06f;
   CONSTRAIN(r, 0.0f, 1.0f);
   r *= r;
   int32_t amount = static_cast<int32_t>(r * 32768.0f);
+  
+  // The synthesis phase of each bin is the phase it has reached, randomized,
+  // and is converted right away. The DC bin is not converted, but still
+  // advances its phase and draws its random sample.
   for (int32_t i = 0; i < size_; ++i) {
-    synthesis_phase[i] += \
-        static_cast<int32_t>(stmlib::Random::GetSample()) * amount >> 14;
-  }
-}
-
-void FrameTransformation::PolarToRectangular(float* fft_data) {
-  float* real = &fft_data[0];
-  float* imag = &fft_data[fft_size_ >> 1];
-  float* magnitude = &fft_data[0];
-  uint32_t* angle = (uint32_t*) &fft_data[fft_size_ >> 1];
-  for (int32_t i = 1; i < size_; ++i) {
-    fast_p2r(magnitude[i], angle[i], &real[i], &imag[i]);
+    uint32_t phase = phases_[i];
+    phases_[i] += static_cast<uint16_t>(
+        static_cast<float>(phases_delta_[i]) * pitch_ratio);
+    phase += static_cast<int32_t>(stmlib::Random::GetSample()) * amount >> 14;
+    if (i) {
+      fast_p2r(magnitude[i], phase, &real[i], &imag[i]);
+    }
   }
   for (int32_t i = size_; i < fft_size_ >> 1; ++i) {
     real[i] = imag[i] = 0.0f;
@@ -57,7 +57,10 @@ class FrameTransformation {
   
  private:
   void RectangularToPolar(float* fft_data);
-  void PolarToRectangular(float* fft_data);
+  void PolarToRectangular(
+      float* fft_data,
+      float phase_randomization,
+      float pitch_ratio);
   void AddGlitch(float* xf_polar);
   void ShiftMagnitudes(
       float* source,
@@ -69,7 +72,6 @@ class FrameTransformation {
       float amount);
   void QuantizeMagnitudes(float* xf_polar, float amount);
   void StoreMagnitudes(float* xf_polar, float position, float feedback);
-  void SetPhases(float* destination, float diffusion, float pitch_ratio);
   void ReplayMagnitudes(float* xf_polar, float position);
   void DiffuseMagnitudes(float* xf_polar, float diffusion);
   
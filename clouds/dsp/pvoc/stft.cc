@@ -122,15 +122,18 @@ void STFT::Buffer() {
     return;
   }
   
-  // Copy block to FFT buffer and apply window.
-  size_t source_ptr = process_ptr_;
+  // Copy block to FFT buffer and apply window. The block wraps around the
+  // end of the analysis buffer at most once.
+  size_t wrap = min(fft_size_, buffer_size_ - process_ptr_);
+  const short* source = &analysis_[process_ptr_];
   const float* w = window_;
-  for (size_t i = 0; i < fft_size_; ++i) {
-    fft_in_[i] = w[0] * analysis_[source_ptr];
-    ++source_ptr;
-    if (source_ptr >= buffer_size_) {
-      source_ptr -= buffer_size_;
-    }
+  for (size_t i = 0; i < wrap; ++i) {
+    fft_in_[i] = w[0] * *source++;
+    w += window_stride_;
+  }
+  source = &analysis_[0];
+  for (size_t i = wrap; i < fft_size_; ++i) {
+    fft_in_[i] = w[0] * *source++;
     w += window_stride_;
   }
   
@@ -174,7 +177,6 @@ void STFT::Buffer() {
   }
 #endif  // USE_ARM_FFT
   
-  size_t destination_ptr = process_ptr_;
 #ifdef USE_ARM_FFT
   float inverse_window_size = 1.0f / \
       float(fft_size_ / hop_size_ >> 1);
@@ -183,21 +185,35 @@ void STFT::Buffer() {
       float(fft_size_ * fft_size_ / hop_size_ >> 1);
 #endif  // USE_ARM_FFT
     
+  // The first fft_size - hop_size samples are overlap-added, the last
+  // hop_size ones are written. Both runs are split where the block wraps
+  // around the end of the synthesis buffer.
+  size_t overlap = fft_size_ - hop_size_;
+  short* destination = &synthesis_[process_ptr_];
   w = window_;
-  for (size_t i = 0; i < fft_size_; ++i) {
-    float s = ifft_out_[i] * w[0] * inverse_window_size;
-    
-    int32_t x = static_cast<int32_t>(s);
-    if (i < fft_size_ - hop_size_) {
-      // Overlap-add.
-      x += synthesis_[destination_ptr];
+  for (size_t i = 0; i < fft_size_; ) {
+    size_t end = i < overlap ? overlap : fft_size_;
+    if (i < wrap && wrap < end) {
+      end = wrap;
     }
-    synthesis_[destination_ptr] = Clip16(x);
-    ++destination_ptr;
-    if (destination_ptr >= buffer_size_) {
-      destination_ptr -= buffer_size_;
+    if (i < overlap) {
+      for (; i < end; ++i) {
+        float s = ifft_out_[i] * w[0] * inverse_window_size;
+        int32_t x = static_cast<int32_t>(s);
+        x += *destination;
+        *destination++ = Clip16(x);
+        w += window_stride_;
+      }
+    } else {
+      for (; i < end; ++i) {
+        float s = ifft_out_[i] * w[0] * inverse_window_size;
+        *destination++ = Clip16(static_cast<int32_t>(s));
+        w += window_stride_;
+      }
+    }
+    if (i == wrap) {
+      destination = &synthesis_[0];
     }
-    w += window_stride_;
   }
 
   ++done_;
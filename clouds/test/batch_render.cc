@@ -0,0 +1,687 @@
+// Copyright 2026 Rubato Audio.
+//
+// Offline batch renderer for GranularProcessor.
+//
+// clouds_test.cc renders one hard-coded file with hard-coded knobs. This tool
+// streams any number of WAV files through the processor, block by block as
+// the firmware does, in parallel, with the knobs driven by automation files.
+//
+//   batch_render [-j <threads>] <jobs.txt | ->
+//
+// One job per line, '#' starting a comment:
+//   <mode> <quality> <input.wav> <output.wav> [<automation.txt> | -]
+//       [<tail_seconds>]
+// mode is granular, stretch, looping or spectral, and quality the front panel
+// setting of GranularProcessor::set_quality (0: stereo, 1: mono, 2: stereo
+// lo-fi, 3: mono lo-fi). The input is a 16-bit PCM WAV file at 32 kHz, mono
+// or stereo, of any length; it is read as it is rendered, and followed by
+// tail_seconds of silence (0 by default) to let freezes and reverbs ring. The
+// output is a stereo 16-bit WAV file at 32 kHz.
+//
+// An automation file holds one breakpoint per line:
+//   <parameter> <seconds> <value>
+// for the parameters of clouds::Parameters: position, size, pitch, density,
+// texture, dry_wet, stereo_spread, feedback and reverb move linearly from one
+// breakpoint to the next and hold their first and last values; freeze and
+// gate are on from a breakpoint with a value of 0.5 or more until one with a
+// lower value; every trigger breakpoint (its value is ignored) fires TRIG on
+// the block that contains it. A parameter without breakpoints keeps the
+// default of kDefaults.
+//
+// Jobs are dealt and stolen across worker threads as in plaits/test/
+// batch_render.cc. Each job has its own processor and sample memory.
+// stmlib::Random is the only state the jobs share, so a granular or spectral
+// job renders in a child process forked by its worker, with its own copy of
+// the generator seeded as the program started: a job's output does not depend
+// on the batch it runs in, and every job still gets a core. For every job,
+// and then for every mode, the tool prints the
+// real-time factor of the render on one core (seconds of audio per second of
+// processing), and the factor of the whole batch on all of them. Build/run
+// with `make batch-render JOBS=<file>`.
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+#include "stmlib/utils/random.h"
+
+#include "clouds/dsp/granular_processor.h"
+
+using namespace clouds;
+using namespace stmlib;
+
+const uint32_t kSampleRate = 32000;
+const size_t kBlockSize = 32;
+const float kMaxTail = 600.0f;
+
+// Same memory as clouds.cc hands to GranularProcessor.
+const size_t kLargeBufferSize = 118784;
+const size_t kSmallBufferSize = 65536 - 128;
+
+enum AutomatedParameter {
+  AUTOMATED_POSITION,
+  AUTOMATED_SIZE,
+  AUTOMATED_PITCH,
+  AUTOMATED_DENSITY,
+  AUTOMATED_TEXTURE,
+  AUTOMATED_DRY_WET,
+  AUTOMATED_STEREO_SPREAD,
+  AUTOMATED_FEEDBACK,
+  AUTOMATED_REVERB,
+  AUTOMATED_FREEZE,
+  AUTOMATED_GATE,
+  AUTOMATED_TRIGGER,
+  AUTOMATED_LAST
+};
+
+const char* const kParameterNames[] = {
+  "position", "size", "pitch", "density", "texture", "dry_wet",
+  "stereo_spread", "feedback", "reverb", "freeze", "gate", "trigger"
+};
+
+const float kDefaults[] = {
+  0.5f, 0.5f, 0.0f, 0.5f, 0.5f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f
+};
+
+const char* const kModeNames[] = {
+  "granular", "stretch", "looping", "spectral"
+};
+
+struct Breakpoint {
+  float time;
+  float value;
+};
+
+struct Automation {
+  std::vector<Breakpoint> curves[AUTOMATED_LAST];
+};
+
+struct Job {
+  PlaybackMode mode;
+  int quality;
+  std::string input;
+  std::string output;
+  Automation automation;
+  float tail;
+  int line;
+
+  // Filled by the render.
+  double audio_seconds;
+  double render_seconds;
+};
+
+class WorkQueue {
+ public:
+  void Push(size_t job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(job);
+  }
+
+  bool Take(size_t* job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (jobs_.empty()) {
+      return false;
+    }
+    *job = jobs_.front();
+    jobs_.pop_front();
+    return true;
+  }
+
+  bool Steal(size_t* job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (jobs_.empty()) {
+      return false;
+    }
+    *job = jobs_.back();
+    jobs_.pop_back();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::deque<size_t> jobs_;
+};
+
+std::vector<Job> jobs;
+std::mutex output_mutex;
+std::atomic<int> num_failures(0);
+std::atomic<int> num_steals(0);
+
+// stmlib::Random keeps its state in a static, which the granular player and
+// the spectral transformations advance. Renders in those modes run in a child
+// process (RenderInChild) from the state the program started with, so they
+// never race on it and come out the same in any batch.
+uint32_t random_seed;
+
+bool UsesRandom(PlaybackMode mode) {
+  return mode == PLAYBACK_MODE_GRANULAR || mode == PLAYBACK_MODE_SPECTRAL;
+}
+
+// Value of a continuous parameter at time t.
+float Evaluate(const std::vector<Breakpoint>& curve, float t, float value) {
+  if (curve.empty()) {
+    return value;
+  }
+  if (t <= curve.front().time) {
+    return curve.front().value;
+  }
+  for (size_t i = 1; i < curve.size(); ++i) {
+    const Breakpoint& a = curve[i - 1];
+    const Breakpoint& b = curve[i];
+    if (t < b.time) {
+      return a.value + (b.value - a.value) * (t - a.time) / (b.time - a.time);
+    }
+  }
+  return curve.back().value;
+}
+
+// Value of a switch at time t: that of the last breakpoint before t.
+bool Switch(const std::vector<Breakpoint>& curve, float t, bool value) {
+  for (size_t i = 0; i < curve.size() && curve[i].time <= t; ++i) {
+    value = curve[i].value >= 0.5f;
+  }
+  return value;
+}
+
+// Whether a breakpoint falls in [t, t + duration).
+bool Fires(const std::vector<Breakpoint>& curve, float t, float duration) {
+  for (size_t i = 0; i < curve.size(); ++i) {
+    if (curve[i].time >= t && curve[i].time < t + duration) {
+      return true;
+    }
+  }
+  return false;
+}
+
+class WavReader {
+ public:
+  WavReader() : fp_(NULL), num_channels_(0), remaining_(0) { }
+  ~WavReader() {
+    if (fp_) {
+      fclose(fp_);
+    }
+  }
+
+  // Returns NULL on success, or what is wrong with the file.
+  const char* Open(const char* name) {
+    fp_ = fopen(name, "rb");
+    if (!fp_) {
+      return strerror(errno);
+    }
+    char riff[12];
+    if (fread(riff, 1, 12, fp_) != 12 || memcmp(riff, "RIFF", 4) ||
+        memcmp(riff + 8, "WAVE", 4)) {
+      return "not a WAV file";
+    }
+    bool format_read = false;
+    char id[4];
+    uint32_t size;
+    while (fread(id, 1, 4, fp_) == 4 && fread(&size, 4, 1, fp_) == 1) {
+      if (!memcmp(id, "fmt ", 4)) {
+        uint16_t format[8];
+        if (size < 16 || fread(format, 1, 16, fp_) != 16) {
+          return "truncated fmt chunk";
+        }
+        uint32_t sample_rate = format[2] | (uint32_t(format[3]) << 16);
+        num_channels_ = format[1];
+        if (format[0] != 1 || format[7] != 16) {
+          return "not 16-bit PCM";
+        }
+        if (num_channels_ != 1 && num_channels_ != 2) {
+          return "neither mono nor stereo";
+        }
+        if (sample_rate != kSampleRate) {
+          return "not at 32 kHz";
+        }
+        fseek(fp_, size - 16 + (size & 1), SEEK_CUR);
+        format_read = true;
+      } else if (!memcmp(id, "data", 4)) {
+        if (!format_read) {
+          return "data before fmt chunk";
+        }
+        remaining_ = size / (2 * num_channels_);
+        return NULL;
+      } else {
+        fseek(fp_, size + (size & 1), SEEK_CUR);
+      }
+    }
+    return "no data chunk";
+  }
+
+  // Reads up to size frames, as stereo. Returns the number of frames read.
+  // A short read ends the input: the file is truncated, or its data chunk
+  // has a placeholder size (0xffffffff, as left by streaming writers).
+  size_t Read(ShortFrame* frames, size_t size) {
+    size = std::min(size, remaining_);
+    size_t read;
+    if (num_channels_ == 2) {
+      read = fread(frames, sizeof(ShortFrame), size, fp_);
+    } else {
+      short samples[kBlockSize];
+      size = std::min(size, kBlockSize);
+      read = fread(samples, sizeof(short), size, fp_);
+      for (size_t i = 0; i < read; ++i) {
+        frames[i].l = frames[i].r = samples[i];
+      }
+    }
+    remaining_ = read < size ? 0 : remaining_ - read;
+    return read;
+  }
+
+  size_t remaining() const { return remaining_; }
+
+ private:
+  FILE* fp_;
+  uint16_t num_channels_;
+  size_t remaining_;
+};
+
+void WriteWavHeader(FILE* fp, uint32_t num_frames) {
+  uint32_t l;
+  uint16_t s;
+  fwrite("RIFF", 4, 1, fp);
+  l = 36 + num_frames * 4;
+  fwrite(&l, 4, 1, fp);
+  fwrite("WAVE", 4, 1, fp);
+  fwrite("fmt ", 4, 1, fp);
+  l = 16;
+  fwrite(&l, 4, 1, fp);
+  s = 1;
+  fwrite(&s, 2, 1, fp);
+  s = 2;
+  fwrite(&s, 2, 1, fp);
+  l = kSampleRate;
+  fwrite(&l, 4, 1, fp);
+  l = kSampleRate * 4;
+  fwrite(&l, 4, 1, fp);
+  s = 4;
+  fwrite(&s, 2, 1, fp);
+  s = 16;
+  fwrite(&s, 2, 1, fp);
+  fwrite("data", 4, 1, fp);
+  l = num_frames * 4;
+  fwrite(&l, 4, 1, fp);
+}
+
+// What a render reports: the line printed for it, on stdout if it succeeded
+// and on stderr otherwise.
+struct Report {
+  bool ok;
+  double audio_seconds;
+  double render_seconds;
+  char message[1024];
+};
+
+// Renders the job without printing anything or taking any lock, so that it
+// can run in a child forked from a multithreaded process.
+void Render(const Job& job, Report* report) {
+  report->ok = false;
+  report->audio_seconds = report->render_seconds = 0.0;
+  WavReader reader;
+  const char* error = reader.Open(job.input.c_str());
+  if (error) {
+    snprintf(report->message, sizeof(report->message), "%s: %s",
+             job.input.c_str(), error);
+    return;
+  }
+  FILE* fp = fopen(job.output.c_str(), "wb");
+  if (!fp) {
+    snprintf(report->message, sizeof(report->message), "%s: %s",
+             job.output.c_str(), strerror(errno));
+    return;
+  }
+  WriteWavHeader(fp, 0);
+
+  std::vector<uint8_t> large_buffer(kLargeBufferSize);
+  std::vector<uint8_t> small_buffer(kSmallBufferSize);
+  // clouds.cc keeps the processor in .bss, and Init does not set all of its
+  // state (freeze_lp_, for one). On a reused heap block it renders silence.
+  GranularProcessor* processor = new GranularProcessor;
+  memset(static_cast<void*>(processor), 0, sizeof(*processor));
+  processor->Init(
+      &large_buffer[0], kLargeBufferSize,
+      &small_buffer[0], kSmallBufferSize);
+  processor->set_playback_mode(job.mode);
+  processor->set_quality(job.quality);
+  processor->Prepare();
+
+  const Automation& automation = job.automation;
+  size_t tail = static_cast<size_t>(job.tail * kSampleRate);
+  uint32_t num_frames = 0;
+  double render_seconds = 0.0;
+  while (reader.remaining() || tail) {
+    ShortFrame input[kBlockSize];
+    ShortFrame output[kBlockSize];
+    size_t size = reader.Read(input, kBlockSize);
+    if (!size) {
+      size = std::min(tail, kBlockSize);
+      std::fill(&input[0].l, &input[size].l, 0);
+      tail -= size;
+    }
+
+    const float t = static_cast<float>(num_frames) / kSampleRate;
+    Parameters* p = processor->mutable_parameters();
+    float* continuous[] = {
+      &p->position, &p->size, &p->pitch, &p->density, &p->texture,
+      &p->dry_wet, &p->stereo_spread, &p->feedback, &p->reverb
+    };
+    for (int i = 0; i < AUTOMATED_FREEZE; ++i) {
+      *continuous[i] = Evaluate(automation.curves[i], t, kDefaults[i]);
+    }
+    p->freeze = Switch(automation.curves[AUTOMATED_FREEZE], t, false);
+    p->gate = Switch(automation.curves[AUTOMATED_GATE], t, false);
+    p->trigger = Fires(
+        automation.curves[AUTOMATED_TRIGGER], t,
+        static_cast<float>(size) / kSampleRate);
+
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    processor->Process(input, output, size);
+    processor->Prepare();
+    render_seconds += std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    fwrite(output, sizeof(ShortFrame), size, fp);
+    num_frames += size;
+  }
+  delete processor;
+
+  fseek(fp, 0, SEEK_SET);
+  WriteWavHeader(fp, num_frames);
+  fclose(fp);
+
+  report->ok = true;
+  report->audio_seconds = static_cast<double>(num_frames) / kSampleRate;
+  report->render_seconds = render_seconds;
+  snprintf(report->message, sizeof(report->message),
+           "rendered %s (%s, quality %d, %.1f s, %.1fx real time)",
+           job.output.c_str(), kModeNames[job.mode], job.quality,
+           report->audio_seconds,
+           render_seconds > 0.0 ? report->audio_seconds / render_seconds : 0.0);
+}
+
+// Renders the job in a child process, which starts stmlib::Random from the
+// program's seed and hands its report back through a pipe. The child leaves
+// with _exit: flushing the stdio buffers it inherited would print the
+// parent's pending output twice.
+void RenderInChild(const Job& job, Report* report) {
+  report->ok = false;
+  report->audio_seconds = report->render_seconds = 0.0;
+  int fds[2];
+  if (pipe(fds)) {
+    snprintf(report->message, sizeof(report->message), "%s: pipe: %s",
+             job.input.c_str(), strerror(errno));
+    return;
+  }
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    Random::Seed(random_seed);
+    Render(job, report);
+    const char* data = reinterpret_cast<const char*>(report);
+    size_t written = 0;
+    while (written < sizeof(*report)) {
+      ssize_t n = write(fds[1], data + written, sizeof(*report) - written);
+      if (n <= 0) {
+        _exit(1);
+      }
+      written += n;
+    }
+    _exit(0);
+  }
+  close(fds[1]);
+  size_t received = 0;
+  if (pid > 0) {
+    char* data = reinterpret_cast<char*>(report);
+    ssize_t n;
+    while (received < sizeof(*report) &&
+           (n = read(fds[0], data + received, sizeof(*report) - received)) > 0) {
+      received += n;
+    }
+    waitpid(pid, NULL, 0);
+  }
+  close(fds[0]);
+  if (received != sizeof(*report)) {
+    report->ok = false;
+    report->audio_seconds = report->render_seconds = 0.0;
+    snprintf(report->message, sizeof(report->message),
+             pid > 0 ? "%s: the render crashed" : "%s: fork failed",
+             job.input.c_str());
+  }
+}
+
+void Work(std::vector<WorkQueue>* queues, size_t self) {
+#if defined(__SSE2__)
+  // The Cortex-M4 FPU flushes denormals in hardware. The MXCSR is per thread,
+  // so every worker sets it for itself.
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+  const size_t num_queues = queues->size();
+  size_t job;
+  while (true) {
+    bool found = (*queues)[self].Take(&job);
+    for (size_t i = 1; i < num_queues && !found; ++i) {
+      found = (*queues)[(self + i) % num_queues].Steal(&job);
+      if (found) {
+        ++num_steals;
+      }
+    }
+    // No job is ever queued after the workers start, so empty queues
+    // everywhere mean the batch is done.
+    if (!found) {
+      return;
+    }
+    Job& current = jobs[job];
+    Report report;
+    if (UsesRandom(current.mode)) {
+      RenderInChild(current, &report);
+    } else {
+      Render(current, &report);
+    }
+    current.audio_seconds = report.audio_seconds;
+    current.render_seconds = report.render_seconds;
+    if (!report.ok) {
+      ++num_failures;
+    }
+    std::lock_guard<std::mutex> lock(output_mutex);
+    fprintf(report.ok ? stdout : stderr, "%s\n", report.message);
+    fflush(report.ok ? stdout : stderr);
+  }
+}
+
+bool ParseAutomation(const char* name, Automation* automation) {
+  FILE* fp = fopen(name, "r");
+  if (!fp) {
+    perror(name);
+    return false;
+  }
+  char line[256];
+  int line_number = 0;
+  bool parsed = true;
+  while (parsed && fgets(line, sizeof(line), fp)) {
+    ++line_number;
+    char* comment = strchr(line, '#');
+    if (comment) {
+      *comment = '\0';
+    }
+    char parameter[32];
+    Breakpoint breakpoint;
+    const int num_fields = sscanf(
+        line, "%31s %f %f", parameter, &breakpoint.time, &breakpoint.value);
+    if (num_fields <= 0) {
+      continue;
+    }
+    int index = 0;
+    while (index < AUTOMATED_LAST &&
+           strcmp(parameter, kParameterNames[index])) {
+      ++index;
+    }
+    if (num_fields < 3) {
+      fprintf(stderr, "%s:%d: expected <parameter> <seconds> <value>\n",
+              name, line_number);
+      parsed = false;
+    } else if (index == AUTOMATED_LAST) {
+      fprintf(stderr, "%s:%d: unknown parameter %s\n",
+              name, line_number, parameter);
+      parsed = false;
+    } else if (!automation->curves[index].empty() &&
+               breakpoint.time < automation->curves[index].back().time) {
+      fprintf(stderr, "%s:%d: %s breakpoints must be in time order\n",
+              name, line_number, parameter);
+      parsed = false;
+    } else {
+      automation->curves[index].push_back(breakpoint);
+    }
+  }
+  fclose(fp);
+  return parsed;
+}
+
+bool ParseJobs(FILE* fp) {
+  char line[1024];
+  int line_number = 0;
+  while (fgets(line, sizeof(line), fp)) {
+    ++line_number;
+    char* comment = strchr(line, '#');
+    if (comment) {
+      *comment = '\0';
+    }
+    char mode[32];
+    char input[512];
+    char output[512];
+    char automation[512];
+    Job job;
+    job.tail = 0.0f;
+    job.line = line_number;
+    job.audio_seconds = job.render_seconds = 0.0;
+    strcpy(automation, "-");
+    const int num_fields = sscanf(
+        line, "%31s %d %511s %511s %511s %f",
+        mode, &job.quality, input, output, automation, &job.tail);
+    if (num_fields <= 0) {
+      continue;
+    }
+    if (num_fields < 4) {
+      fprintf(stderr, "line %d: expected at least 4 fields, got %d\n",
+              line_number, num_fields);
+      return false;
+    }
+    int m = 0;
+    while (m < PLAYBACK_MODE_LAST && strcmp(mode, kModeNames[m])) {
+      ++m;
+    }
+    if (m == PLAYBACK_MODE_LAST) {
+      fprintf(stderr, "line %d: unknown mode %s\n", line_number, mode);
+      return false;
+    }
+    if (job.quality < 0 || job.quality > 3) {
+      fprintf(stderr, "line %d: quality must be between 0 and 3\n",
+              line_number);
+      return false;
+    }
+    if (job.tail < 0.0f || job.tail > kMaxTail) {
+      fprintf(stderr, "line %d: tail must be between 0 and %.0f seconds\n",
+              line_number, kMaxTail);
+      return false;
+    }
+    if (strcmp(automation, "-") &&
+        !ParseAutomation(automation, &job.automation)) {
+      return false;
+    }
+    job.mode = static_cast<PlaybackMode>(m);
+    job.input = input;
+    job.output = output;
+    jobs.push_back(job);
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  size_t num_threads = std::thread::hardware_concurrency();
+  int arg = 1;
+  if (arg + 1 < argc && !strcmp(argv[arg], "-j")) {
+    num_threads = atoi(argv[arg + 1]);
+    arg += 2;
+  }
+  if (arg + 1 != argc || num_threads < 1) {
+    fprintf(stderr, "usage: %s [-j <threads>] <jobs.txt | ->\n", argv[0]);
+    return 2;
+  }
+
+  FILE* fp = strcmp(argv[arg], "-") ? fopen(argv[arg], "r") : stdin;
+  if (!fp) {
+    perror(argv[arg]);
+    return 2;
+  }
+  const bool parsed = ParseJobs(fp);
+  if (fp != stdin) {
+    fclose(fp);
+  }
+  if (!parsed) {
+    return 2;
+  }
+
+  // The input lengths are not known before the files are opened, so the
+  // jobs are dealt in the order of the file.
+  num_threads = std::min(num_threads, std::max(jobs.size(), size_t(1)));
+  std::vector<WorkQueue> queues(num_threads);
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    queues[i % num_threads].Push(i);
+  }
+
+  random_seed = Random::state();
+  const std::chrono::steady_clock::time_point started =
+      std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < num_threads; ++i) {
+    workers.push_back(std::thread(Work, &queues, i));
+  }
+  for (size_t i = 0; i < workers.size(); ++i) {
+    workers[i].join();
+  }
+  const double elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - started).count();
+
+  double audio_seconds = 0.0;
+  for (int m = 0; m < PLAYBACK_MODE_LAST; ++m) {
+    int num_jobs = 0;
+    double mode_audio_seconds = 0.0;
+    double mode_render_seconds = 0.0;
+    for (size_t i = 0; i < jobs.size(); ++i) {
+      if (jobs[i].mode == m && jobs[i].render_seconds > 0.0) {
+        ++num_jobs;
+        mode_audio_seconds += jobs[i].audio_seconds;
+        mode_render_seconds += jobs[i].render_seconds;
+      }
+    }
+    audio_seconds += mode_audio_seconds;
+    if (num_jobs) {
+      printf("%-8s %3d jobs, %8.1f s of audio, %6.1fx real time per core\n",
+             kModeNames[m], num_jobs, mode_audio_seconds,
+             mode_audio_seconds / mode_render_seconds);
+    }
+  }
+  printf("%zu jobs, %d failed, %zu threads, %d steals: "
+         "%.1f s of audio in %.2f s (%.1fx real time)\n",
+         jobs.size(), num_failures.load(), num_threads, num_steals.load(),
+         audio_seconds, elapsed, elapsed > 0.0 ? audio_seconds / elapsed : 0.0);
+  return num_failures ? 3 : 0;
+}
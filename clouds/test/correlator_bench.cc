@@ -0,0 +1,199 @@
+// Copyright 2026 Rubato Audio.
+//
+// The WSOLA correlator against an exhaustive search.
+//
+// This bench runs the correlator and a plain exhaustive search (every
+// candidate scored one word at a time, as the correlator used to) on the sign
+// bits of random excerpts of three signals: white noise, a harmonic tone with
+// a little noise, and low-passed noise. As built by default the correlator
+// scores every candidate too; built with CLOUDS_CORRELATOR_COARSE_SEARCH it
+// scores every kCorrelatorCoarseStride-th candidate, then the ones around
+// the best of them. For every search size (the number of source bits, up to
+// kMaxWSOLASize) it prints
+//   <signal> <size> <same> <score> <blocks> <exhaustive_blocks> <ns>
+//       <exhaustive_ns>
+// where same is the share of searches that find the exhaustive match, score
+// the mean ratio of the score of the match found to the best score, blocks
+// the number of EvaluateSomeCandidates calls (one per block) a search takes,
+// exhaustive_blocks the number the original firmware took (a quarter of the
+// candidates per call), and ns the time of a whole search. As in the plaits benches the nanoseconds
+// are host numbers.
+//
+// It fails if Score disagrees with the exhaustive scoring on any candidate,
+// or if the default, exhaustive correlator finds another match.
+// Build/run with `make correlator-bench`, or with
+// `make correlator-bench CXXFLAGS=-DCLOUDS_CORRELATOR_COARSE_SEARCH`.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "clouds/dsp/correlator.h"
+#include "clouds/dsp/wsola_sample_player.h"
+
+using namespace clouds;
+
+const int32_t kNumWords = kMaxWSOLASize / 32 + 2;
+const int kNumSearches = 200;
+const int32_t kSignalSize = 65536;
+
+uint32_t source[kNumWords];
+uint32_t destination[2 * kNumWords];
+float signal[kSignalSize];
+
+Correlator correlator;
+
+uint32_t rng_state = 0x22;
+
+uint32_t Random() {
+  rng_state = rng_state * 1664525L + 1013904223L;
+  return rng_state;
+}
+
+float RandomFloat() {
+  return static_cast<float>(Random() >> 8) / 16777216.0f;
+}
+
+enum Signal {
+  SIGNAL_NOISE,
+  SIGNAL_TONE,
+  SIGNAL_LOWPASS,
+  SIGNAL_LAST
+};
+
+const char* const kSignalNames[] = { "noise", "tone", "lowpass" };
+
+void Generate(Signal type) {
+  float f0 = 0.002f + 0.02f * RandomFloat();
+  float lp = 0.0f;
+  for (int32_t i = 0; i < kSignalSize; ++i) {
+    float noise = RandomFloat() - 0.5f;
+    float s = noise;
+    if (type == SIGNAL_TONE) {
+      s = 0.1f * noise;
+      for (int32_t h = 1; h <= 8; ++h) {
+        s += sinf(6.2831853f * f0 * h * i) / h;
+      }
+    } else if (type == SIGNAL_LOWPASS) {
+      lp += 0.02f * (noise - lp);
+      s = lp;
+    }
+    signal[i] = s;
+  }
+}
+
+// Same bit order as WSOLASamplePlayer::ReadSignBits: the first sample is the
+// most significant bit of the first word.
+void ReadSignBits(int32_t start, int32_t size, uint32_t* bits) {
+  std::fill(&bits[0], &bits[size / 32 + 1], 0);
+  for (int32_t i = 0; i < size; ++i) {
+    if (signal[start + i] > 0.0f) {
+      bits[i >> 5] |= 1u << (31 - (i & 0x1f));
+    }
+  }
+}
+
+// The correlator as it was: every candidate is scored, one word at a time.
+uint32_t ExhaustiveScore(int32_t size, int32_t candidate) {
+  uint32_t num_words = size >> 5;
+  uint32_t offset_words = candidate >> 5;
+  uint32_t offset_bits = candidate & 0x1f;
+  const uint32_t* d = &destination[offset_words];
+  uint32_t xcorr = 0;
+  for (uint32_t i = 0; i < num_words; ++i) {
+    uint32_t destination_bits = d[i] << offset_bits;
+    if (offset_bits) {
+      destination_bits |= d[i + 1] >> (32 - offset_bits);
+    }
+    uint32_t count = ~(source[i] ^ destination_bits);
+    count = count - ((count >> 1) & 0x55555555);
+    count = (count & 0x33333333) + ((count >> 2) & 0x33333333);
+    count = (((count + (count >> 4)) & 0xf0f0f0f) * 0x1010101) >> 24;
+    xcorr += count;
+  }
+  return xcorr;
+}
+
+int32_t ExhaustiveSearch(int32_t size, uint32_t* best_score) {
+  int32_t best_match = 0;
+  *best_score = 0;
+  for (int32_t candidate = 0; candidate < size; ++candidate) {
+    uint32_t score = ExhaustiveScore(size, candidate);
+    if (score > *best_score) {
+      best_match = candidate;
+      *best_score = score;
+    }
+  }
+  return best_match;
+}
+
+int main(void) {
+  correlator.Init(source, destination);
+  const int32_t sizes[] = { 256, 512, 1024, 2048, 4096 };
+  int mismatches = 0;
+  int missed = 0;
+  printf("signal  size  same score blocks exhaustive   ns       exhaustive\n");
+  for (int32_t type = 0; type < SIGNAL_LAST; ++type) {
+    Generate(static_cast<Signal>(type));
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+      const int32_t size = sizes[s];
+      int same = 0;
+      float score_ratio = 0.0f;
+      int blocks = 0;
+      float ns = 0.0f;
+      float exhaustive_ns = 0.0f;
+      for (int i = 0; i < kNumSearches; ++i) {
+        int32_t start = Random() % (kSignalSize - 3 * size);
+        int32_t target = start + size / 2 + Random() % size - size;
+        target = std::max(target, int32_t(0));
+        ReadSignBits(start, size, source);
+        ReadSignBits(target, 2 * size, destination);
+
+        auto t0 = std::chrono::high_resolution_clock::now();
+        uint32_t best_score;
+        int32_t best_match = ExhaustiveSearch(size, &best_score);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        correlator.StartSearch(size, 0, 65536);
+        while (!correlator.done()) {
+          correlator.EvaluateSomeCandidates();
+          ++blocks;
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        exhaustive_ns += std::chrono::duration<float, std::nano>(
+            t1 - t0).count();
+        ns += std::chrono::duration<float, std::nano>(t2 - t1).count();
+
+        int32_t match = correlator.best_match();
+        same += match == best_match;
+#ifndef CLOUDS_CORRELATOR_COARSE_SEARCH
+        missed += match != best_match;
+#endif  // CLOUDS_CORRELATOR_COARSE_SEARCH
+        score_ratio += best_score
+            ? static_cast<float>(ExhaustiveScore(size, match)) / best_score
+            : 1.0f;
+        if (i < 4) {
+          for (int32_t candidate = 0; candidate < size; ++candidate) {
+            mismatches += correlator.Score(candidate) !=
+                ExhaustiveScore(size, candidate);
+          }
+        }
+      }
+      printf("%-7s %4d %5.1f %5.3f %6.2f %10.2f %8.0f %10.0f\n",
+             kSignalNames[type], size,
+             100.0f * same / kNumSearches, score_ratio / kNumSearches,
+             static_cast<float>(blocks) / kNumSearches,
+             static_cast<float>(size) / ((size >> 2) + 16),
+             ns / kNumSearches, exhaustive_ns / kNumSearches);
+    }
+  }
+  if (mismatches) {
+    printf("FAILED: %d candidates scored differently\n", mismatches);
+    return 1;
+  }
+  if (missed) {
+    printf("FAILED: %d searches missed the exhaustive match\n", missed);
+    return 1;
+  }
+  return 0;
+}
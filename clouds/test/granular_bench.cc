@@ -0,0 +1,141 @@
+// Copyright 2026 Rubato Audio.
+//
+// Per-block cost of GranularSamplePlayer against the number of grains.
+//
+// The player runs on a buffer that keeps being written with noise, as the
+// processor's record head does, at full overlap, so that it holds as many
+// grains as its budget allows. The budget is the max_num_grains that
+// GranularProcessor::Init passes to the player: 32 (stereo) and 40 (mono) for
+// the 16-bit buffers, 46 and 57 for the low-fidelity mu-law ones, and 64, the
+// size of the grain store. For every budget it prints
+//   <channels> <resolution> <budget> <active> <ns_per_block> <ns_per_grain>
+//       <hash>
+// where active is the mean number of playing grains, the times are those of
+// one kMaxBlockSize block, the fastest of a few batches, and hash is an FNV-1a
+// hash of the output, so that a change to the player can be checked for
+// bit-identical output. As in the plaits benches the nanoseconds are host
+// numbers; the cost per grain and how it scales are the useful results.
+// Build/run with `make granular-bench`.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+#include "clouds/dsp/audio_buffer.h"
+#include "clouds/dsp/frame.h"
+#include "clouds/dsp/granular_sample_player.h"
+#include "clouds/dsp/parameters.h"
+
+using namespace clouds;
+using namespace stmlib;
+
+const int32_t kBufferSize = 32768;
+const int kNumBlocks = 4000;
+const int kNumBatches = 5;
+
+int16_t buffer_memory[2][kBufferSize];
+int16_t tail_memory[2][kCrossFadeSize];
+
+GranularSamplePlayer player;
+
+struct Result {
+  float active;
+  float ns;
+  uint32_t hash;
+};
+
+uint32_t Hash(uint32_t hash, const float* data, size_t size) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(
+      static_cast<const void*>(data));
+  for (size_t i = 0; i < size * sizeof(float); ++i) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+template<Resolution resolution>
+Result Run(int32_t num_channels, int32_t budget) {
+  AudioBuffer<resolution> buffer[2];
+  Result result = { 0.0f, 0.0f, 0 };
+  for (int batch = 0; batch < kNumBatches; ++batch) {
+    for (int32_t i = 0; i < num_channels; ++i) {
+      buffer[i].Init(buffer_memory[i], kBufferSize, tail_memory[i]);
+    }
+    player.Init(num_channels, budget);
+    Random::Seed(0x21);
+
+    Parameters p;
+    memset(&p, 0, sizeof(p));
+    p.position = 0.4f;
+    p.size = 0.45f;
+    p.pitch = 3.0f;
+    p.stereo_spread = 0.5f;
+    p.granular.overlap = 1.0f;
+    p.granular.window_shape = 0.75f;
+    p.granular.use_deterministic_seed = false;
+
+    float noise[kMaxBlockSize];
+    float out[kMaxBlockSize * 2];
+    uint32_t hash = 2166136261u;
+    int64_t active = 0;
+    float ns = 0.0f;
+    for (int block = 0; block < kNumBlocks; ++block) {
+      for (int32_t i = 0; i < num_channels; ++i) {
+        for (size_t j = 0; j < kMaxBlockSize; ++j) {
+          noise[j] = Random::GetFloat() - 0.5f;
+        }
+        buffer[i].Write(noise, kMaxBlockSize, 1);
+      }
+      // Alternate the window shapes, to play both envelope paths.
+      p.granular.window_shape = (block / 500) & 1 ? 0.25f : 0.75f;
+      auto t0 = std::chrono::high_resolution_clock::now();
+      player.Play(buffer, p, out, kMaxBlockSize);
+      auto t1 = std::chrono::high_resolution_clock::now();
+      ns += std::chrono::duration<float, std::nano>(t1 - t0).count();
+      active += player.num_active_grains();
+      hash = Hash(hash, out, kMaxBlockSize * 2);
+    }
+    ns /= kNumBlocks;
+    if (batch == 0 || ns < result.ns) {
+      result.ns = ns;
+    }
+    result.active = static_cast<float>(active) / kNumBlocks;
+    result.hash = hash;
+  }
+  return result;
+}
+
+void Report(const char* resolution, int32_t num_channels, int32_t budget,
+            const Result& r) {
+  printf("%d %-6s %2d %5.1f %9.1f %7.1f %08x\n",
+         num_channels, resolution, budget, r.active, r.ns,
+         r.active > 0.0f ? r.ns / r.active : 0.0f, r.hash);
+}
+
+int main(void) {
+#if defined(__SSE2__)
+  // The Cortex-M4 FPU flushes denormals in hardware.
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+  const int32_t budgets_16[] = { 8, 16, 32, 40, 64 };
+  const int32_t budgets_8[] = { 8, 16, 46, 57, 64 };
+  printf("ch resolution budget active ns/block ns/grain hash\n");
+  for (int32_t num_channels = 1; num_channels <= 2; ++num_channels) {
+    for (size_t i = 0; i < sizeof(budgets_16) / sizeof(budgets_16[0]); ++i) {
+      Report("16-bit", num_channels, budgets_16[i],
+             Run<RESOLUTION_16_BIT>(num_channels, budgets_16[i]));
+    }
+    for (size_t i = 0; i < sizeof(budgets_8) / sizeof(budgets_8[0]); ++i) {
+      Report("mu-law", num_channels, budgets_8[i],
+             Run<RESOLUTION_8_BIT_MU_LAW>(num_channels, budgets_8[i]));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,208 @@
+// Copyright 2026 Rubato Audio.
+//
+// Cost of a spectral-mode frame.
+//
+// The phase vocoder runs as GranularProcessor sets it up: a 4096-point FFT
+// with a hop of 1024 samples, in the memory the firmware gives it, mono (7
+// textures) or stereo (3 textures per channel, the free memory being the
+// limit). It plays a harmonic tone with a little noise for kNumBlocks blocks,
+// in two settings of the knobs: "still" (no pitch shift, warp, quantization
+// or phase randomization) and "busy" (+7 semitones, warped, quantized, with
+// phase randomization). For each it prints
+//   <setting> <channels> <textures> <frame_ns> <fft_ns> <hash>
+// where frame_ns is the time of PhaseVocoder::Buffer for one frame of every
+// channel, the fastest of a few batches, fft_ns that of the forward and
+// inverse FFT of one frame alone (the rest being windowing, overlap-add and
+// FrameTransformation), and hash an FNV-1a hash of the output, so that a
+// change to the vocoder can be checked for bit-identical output. As in the
+// plaits benches the nanoseconds are host numbers.
+// Build/run with `make spectral-bench`.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+#include "stmlib/utils/random.h"
+
+#include "clouds/dsp/frame.h"
+#include "clouds/dsp/parameters.h"
+#include "clouds/dsp/pvoc/phase_vocoder.h"
+#include "clouds/resources.h"
+
+using namespace clouds;
+using namespace stmlib;
+
+const size_t kFftSize = 4096;
+const int kNumBlocks = 2048;
+const int kNumBatches = 3;
+
+// Same memory as clouds.cc hands to GranularProcessor.
+uint8_t block_mem[118784];
+uint8_t block_ccm[65536 - 128];
+
+PhaseVocoder phase_vocoder;
+FFT fft;
+float fft_in[kFftSize];
+float fft_out[kFftSize];
+
+struct Setting {
+  const char* name;
+  float pitch;
+  float size;
+  float density;
+  float texture;
+};
+
+const Setting kSettings[] = {
+  { "still", 0.0f, 0.5f, 0.5f, 0.5f },
+  { "busy", 7.0f, 0.85f, 0.85f, 0.3f },
+};
+
+struct Result {
+  int32_t textures;
+  float frame_ns;
+  uint32_t hash;
+};
+
+uint32_t Hash(uint32_t hash, const float* data, size_t size) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(
+      static_cast<const void*>(data));
+  for (size_t i = 0; i < size * sizeof(float); ++i) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+// The knobs as GranularProcessor maps them in spectral mode.
+void SetParameters(const Setting& setting, Parameters* p) {
+  memset(p, 0, sizeof(*p));
+  p->pitch = setting.pitch;
+  p->position = 0.3f;
+  p->spectral.quantization = setting.texture;
+  p->spectral.refresh_rate = 0.01f + 0.99f * setting.density;
+  float warp = setting.size - 0.5f;
+  p->spectral.warp = 4.0f * warp * warp * warp + 0.5f;
+  float randomization = setting.density - 0.5f;
+  randomization *= randomization * 4.2f;
+  randomization -= 0.05f;
+  CONSTRAIN(randomization, 0.0f, 1.0f);
+  p->spectral.phase_randomization = randomization;
+}
+
+Result Run(const Setting& setting, int32_t num_channels) {
+  Result result = { 0, 0.0f, 0 };
+  for (int batch = 0; batch < kNumBatches; ++batch) {
+    void* buffer[2];
+    size_t buffer_size[2];
+    if (num_channels == 1) {
+      buffer[0] = block_mem;
+      buffer_size[0] = sizeof(block_mem);
+      buffer[1] = NULL;
+      buffer_size[1] = 0;
+    } else {
+      buffer[0] = block_mem;
+      buffer[1] = block_ccm;
+      buffer_size[0] = buffer_size[1] = sizeof(block_ccm);
+    }
+    phase_vocoder.Init(
+        buffer, buffer_size, lut_sine_window_4096, kFftSize,
+        num_channels, 16, 32000.0f);
+    Random::Seed(0x23);
+
+    Parameters p;
+    SetParameters(setting, &p);
+    FloatFrame input[kMaxBlockSize];
+    FloatFrame output[kMaxBlockSize];
+    uint32_t hash = 2166136261u;
+    float ns = 0.0f;
+    float phase = 0.0f;
+    for (int block = 0; block < kNumBlocks; ++block) {
+      for (size_t i = 0; i < kMaxBlockSize; ++i) {
+        float s = 0.0f;
+        for (int32_t h = 1; h <= 6; ++h) {
+          s += sinf(phase * h) / (2.0f * h);
+        }
+        phase += 2.0f * 3.1415926f * 220.0f / 32000.0f;
+        if (phase >= 2.0f * 3.1415926f) {
+          phase -= 2.0f * 3.1415926f;
+        }
+        float noise = Random::GetFloat() - 0.5f;
+        input[i].l = s + 0.05f * noise;
+        input[i].r = s - 0.05f * noise;
+      }
+      phase_vocoder.Process(p, input, output, kMaxBlockSize);
+      auto t0 = std::chrono::high_resolution_clock::now();
+      phase_vocoder.Buffer();
+      auto t1 = std::chrono::high_resolution_clock::now();
+      ns += std::chrono::duration<float, std::nano>(t1 - t0).count();
+      if (num_channels == 1) {
+        for (size_t i = 0; i < kMaxBlockSize; ++i) {
+          output[i].r = output[i].l;
+        }
+      }
+      hash = Hash(hash, &output[0].l, kMaxBlockSize * 2);
+    }
+    ns /= kNumBlocks * kMaxBlockSize / (kFftSize / 4);
+    if (batch == 0 || ns < result.frame_ns) {
+      result.frame_ns = ns;
+    }
+    result.hash = hash;
+  }
+
+  // Textures left by the memory, as PhaseVocoder::Init computes them.
+  size_t texture_size = (kFftSize >> 1) - kHighFrequencyTruncation;
+  size_t free = (num_channels == 1 ? sizeof(block_mem) : sizeof(block_ccm)) -
+      (kFftSize * sizeof(float) * (num_channels == 1 ? 2 : 1)) -
+      (kFftSize + (kFftSize >> 1)) * 2 * sizeof(short);
+  result.textures = std::min(
+      free / (sizeof(float) * texture_size), size_t(kMaxNumTextures));
+  return result;
+}
+
+float FftTime() {
+  fft.Init();
+  for (size_t i = 0; i < kFftSize; ++i) {
+    fft_in[i] = Random::GetFloat() - 0.5f;
+  }
+  float fastest = 0.0f;
+  for (int batch = 0; batch < kNumBatches; ++batch) {
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 100; ++i) {
+      fft.Direct(fft_in, fft_out);
+      fft.Inverse(fft_out, fft_in);
+      for (size_t j = 0; j < kFftSize; ++j) {
+        fft_in[j] *= 1.0f / kFftSize;
+      }
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    float ns = std::chrono::duration<float, std::nano>(t1 - t0).count() / 100;
+    fastest = batch == 0 ? ns : std::min(fastest, ns);
+  }
+  return fastest;
+}
+
+int main(void) {
+#if defined(__SSE2__)
+  // The Cortex-M4 FPU flushes denormals in hardware.
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+  float fft_ns = FftTime();
+  printf("setting ch textures frame_ns fft_ns hash\n");
+  for (size_t s = 0; s < sizeof(kSettings) / sizeof(kSettings[0]); ++s) {
+    for (int32_t num_channels = 1; num_channels <= 2; ++num_channels) {
+      Result r = Run(kSettings[s], num_channels);
+      printf("%-7s %d %d %9.0f %9.0f %08x\n",
+             kSettings[s].name, num_channels, r.textures, r.frame_ns,
+             fft_ns * num_channels, r.hash);
+    }
+  }
+  return 0;
+}
@@ -21,6 +21,13 @@
 #define PLAITS_HAS_CUSTOM_SPEECH_BANKS 0
 #endif
 
+// Or play the five stock banks from decoded frames held in flash, rather than
+// decoding a bank's TI bitstream whenever it is selected (see
+// DECODED_SPEECH_BANKS in plaits/makefile).
+#ifndef PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+#define PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS 0
+#endif
+
 #if PLAITS_ENGINE_COUNT < 1 || PLAITS_ENGINE_COUNT > 32
 #error "PLAITS_ENGINE_COUNT must be between 1 and 32"
 #endif
@@ -191,6 +198,19 @@
     (PLAITS_BUILD_LINEAR_TZFM || PLAITS_BUILD_FAST_FM)
 #endif
 
+// Render each DX7 patch with the renderer specialised for its algorithm
+// (Algorithms::algorithm_fn) instead of the chain of per-operator renderers.
+// Same samples, about a quarter less time in the operators on the host
+// (`make six-op-algorithm-bench`), but the 32 specialisations take much more
+// flash than the shared renderers. Off by default until its cost in the
+// six-op engines' flash budget has been measured on the target; when off, the
+// linker drops the specialisations. Lab builds turn it on with
+// `generate_engine_config.py --fused-fm-algorithms`, the host tools with
+// `make FUSED_FM_ALGORITHMS=1`.
+#ifndef PLAITS_BUILD_FUSED_FM_ALGORITHMS
+#define PLAITS_BUILD_FUSED_FM_ALGORITHMS 0
+#endif
+
 // Qualification builds can distinguish the three latched audio-input fault
 // sources on separate LED positions. Ordinary builds do not replace the model
 // display with diagnostics. This is intentionally not a hosted recipe option.
@@ -135,35 +135,69 @@ void ChordBank::SetRuntimeTables(
 #endif  // PLAITS_CHORD_RUNTIME_TABLE
 
 void ChordBank::Init(BufferAllocator* allocator) {
-  (void) allocator;
+  table_capacity_ = 0;
+  for (int i = 0; i < PLAITS_CHORD_TABLE_COUNT_REF; ++i) {
+    table_capacity_ = std::max(
+        table_capacity_,
+        static_cast<int>(PLAITS_CHORD_TABLE_SIZES_REF[i]));
+  }
+  table_storage_ = allocator->Allocate<float>(table_capacity_ * kRowSize);
+  table_ = NULL;
   chord_set_option_ = 0xff;
   chord_index_ = -1;
   num_notes_ = 0;
+  ratios_ = row_;
+  std::fill(&row_[0], &row_[kRowSize], 0.0f);
 }
 
-void ChordBank::UpdateRatios(int chord_index) {
-  chord_index_ = chord_index;
+/* static */
+void ChordBank::ComputeRatios(int chord_index, float* row) {
   for (int i = 0; i < kChordNumNotes; ++i) {
-    ratios_[i] = SemitonesToRatio(
+    row[i] = SemitonesToRatio(
         static_cast<float>(PLAITS_CHORD_CENTS_REF[chord_index][i]) * 0.01f);
   }
-  num_notes_ = PLAITS_CHORD_ARP_LENGTHS_REF[chord_index];
+  float* sorted_ratios = &row[kChordNumNotes];
+  for (int i = 0; i < kChordNumNotes; ++i) {
+    float r = row[i];
+    while (r > 2.0f) {
+      r *= 0.5f;
+    }
+    sorted_ratios[i] = r;
+  }
+  std::sort(&sorted_ratios[0], &sorted_ratios[kChordNumNotes]);
 }
 
 void ChordBank::set_chord(float parameter, uint8_t chord_set_option) {
   if (chord_set_option >= PLAITS_CHORD_TABLE_COUNT_REF) {
     chord_set_option = 0;
   }
+  const int table_offset = PLAITS_CHORD_TABLE_OFFSETS_REF[chord_set_option];
   if (chord_set_option_ != chord_set_option) {
+    const int table_size = PLAITS_CHORD_TABLE_SIZES_REF[chord_set_option];
     chord_set_option_ = chord_set_option;
-    chord_index_quantizer_.Init(
-        PLAITS_CHORD_TABLE_SIZES_REF[chord_set_option_], 0.075f, false);
+    chord_index_quantizer_.Init(table_size, 0.075f, false);
+    chord_index_ = -1;
+    table_ = table_storage_ && table_size <= table_capacity_
+        ? table_storage_
+        : NULL;
+    if (table_) {
+      for (int i = 0; i < table_size; ++i) {
+        ComputeRatios(table_offset + i, &table_[i * kRowSize]);
+      }
+    }
   }
   chord_index_quantizer_.Process(parameter * 1.02f);
-  int chord_index = PLAITS_CHORD_TABLE_OFFSETS_REF[chord_set_option_] +
-      chord_index_quantizer_.quantized_value();
+  const int chord = chord_index_quantizer_.quantized_value();
+  const int chord_index = table_offset + chord;
   if (chord_index_ != chord_index) {
-    UpdateRatios(chord_index);
+    chord_index_ = chord_index;
+    if (table_) {
+      ratios_ = &table_[chord * kRowSize];
+    } else {
+      ComputeRatios(chord_index, row_);
+      ratios_ = row_;
+    }
+    num_notes_ = PLAITS_CHORD_ARP_LENGTHS_REF[chord_index];
   }
 }
 
@@ -171,7 +205,6 @@ void ChordBank::Reset() {
   chord_set_option_ = 0xff;
   chord_index_ = -1;
   set_chord(0.0f, 0);
-  Sort();
 }
 
 int ChordBank::ComputeChordInversion(
@@ -51,17 +51,9 @@ class ChordBank {
   int ComputeChordInversion(
       float inversion, float* ratios, float* amplitudes);
   
-  inline void Sort() {
-    for (int i = 0; i < kChordNumNotes; ++i) {
-      float r = ratios_[i];
-      while (r > 2.0f) {
-        r *= 0.5f;
-      }
-      sorted_ratios_[i] = r;
-    }
-    std::sort(&sorted_ratios_[0], &sorted_ratios_[kChordNumNotes]);
-  }
-  
+  // Selects a chord. The ratios of every chord of the selected table are
+  // computed when the table is selected, so that a chord change is only a
+  // lookup.
   void set_chord(float parameter, uint8_t chord_set_option);
 
 #ifdef PLAITS_CHORD_RUNTIME_TABLE
@@ -74,8 +66,9 @@ class ChordBank {
   // pointer or a non-positive count restores the compiled-in tables.
   //
   // Call it BEFORE Init()/Reset() on the banks that should see it: a bank
-  // caches its resolved chord index, so a swap under a live instance is not
-  // picked up until the next index change.
+  // caches the ratios of its selected table, so a swap under a live instance
+  // is not picked up until the next Reset() or table change. Init() sizes that
+  // cache for the tables current at the time.
   static void SetRuntimeTables(
       const int16_t (*cents)[kChordNumNotes],
       const uint8_t* arp_lengths,
@@ -96,8 +89,9 @@ class ChordBank {
     return ratios_[note];
   }
 
+  // The ratios of the chord folded into one octave, in ascending order.
   inline float sorted_ratio(int note) const {
-    return sorted_ratios_[note];
+    return ratios_[kChordNumNotes + note];
   }
   
   inline int num_notes() const {
@@ -105,14 +99,24 @@ class ChordBank {
   }
 
  private:
-  void UpdateRatios(int chord_index);
+  // A row holds the kChordNumNotes ratios of a chord, then its sorted ratios.
+  static const int kRowSize = 2 * kChordNumNotes;
+
+  static void ComputeRatios(int chord_index, float* row);
 
   stmlib::HysteresisQuantizer2 chord_index_quantizer_;
   uint8_t chord_set_option_;
   int chord_index_;
   int num_notes_;
-  float ratios_[kChordNumNotes];
-  float sorted_ratios_[kChordNumNotes];
+  const float* ratios_;
+
+  // One row per chord of the selected table, allocated for the largest table
+  // at Init(). NULL if the arena was too small or the table does not fit; the
+  // row of a newly selected chord is then computed into row_.
+  float* table_;
+  float* table_storage_;
+  int table_capacity_;
+  float row_[kRowSize];
 
   DISALLOW_COPY_AND_ASSIGN(ChordBank);
 };
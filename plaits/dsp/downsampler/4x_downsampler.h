@@ -33,6 +33,18 @@
 
 #include "plaits/resources.h"
 
+// Host builds decimate four output samples per vector register in Process.
+// The firmware (Cortex-M4, no SIMD unit) keeps the scalar loop, which stays
+// the reference: the vector loop performs the same operations in the same
+// order, so both produce the samples Accumulate/Read would.
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#define PLAITS_DOWNSAMPLER_SIMD
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define PLAITS_DOWNSAMPLER_SIMD
+#endif
+
 namespace plaits {
   
 const size_t kOversampling = 4;
@@ -58,6 +70,77 @@ class Downsampler {
     tail_ = 0.0f;
     return value;
   }
+  
+  // Decimates a whole block: in holds kOversampling * size samples, out
+  // receives size samples. Same output and state as four Accumulate calls
+  // followed by a Read, for each output sample. The 8-tap filter is split
+  // in two polyphase halves: an output sample is the head taps applied to its
+  // own four input samples, plus the tail taps applied to the four before -
+  // which do not depend on any previous output, so four of them can be
+  // computed side by side. The tail starts from 0.0f as in Accumulate, which
+  // keeps the sign of zero samples identical. Must be called between a Read
+  // and the next Accumulate.
+  inline void Process(const float* in, float* out, size_t size) {
+    const float* h = lut_4x_downsampler_fir;
+#ifdef PLAITS_DOWNSAMPLER_SIMD
+    for (; size >= 4; size -= 4) {
+#if defined(__SSE2__)
+      __m128 x_0 = _mm_loadu_ps(&in[0]);
+      __m128 x_1 = _mm_loadu_ps(&in[4]);
+      __m128 x_2 = _mm_loadu_ps(&in[8]);
+      __m128 x_3 = _mm_loadu_ps(&in[12]);
+      _MM_TRANSPOSE4_PS(x_0, x_1, x_2, x_3);
+      __m128 tail = _mm_add_ps(
+          _mm_setzero_ps(), _mm_mul_ps(x_0, _mm_set1_ps(h[0])));
+      tail = _mm_add_ps(tail, _mm_mul_ps(x_1, _mm_set1_ps(h[1])));
+      tail = _mm_add_ps(tail, _mm_mul_ps(x_2, _mm_set1_ps(h[2])));
+      tail = _mm_add_ps(tail, _mm_mul_ps(x_3, _mm_set1_ps(h[3])));
+      // The tails of the previous output samples: head_, then lanes 0 to 2.
+      __m128 head = _mm_move_ss(
+          _mm_shuffle_ps(tail, tail, _MM_SHUFFLE(2, 1, 0, 0)),
+          _mm_set_ss(head_));
+      head = _mm_add_ps(head, _mm_mul_ps(x_0, _mm_set1_ps(h[3])));
+      head = _mm_add_ps(head, _mm_mul_ps(x_1, _mm_set1_ps(h[2])));
+      head = _mm_add_ps(head, _mm_mul_ps(x_2, _mm_set1_ps(h[1])));
+      head = _mm_add_ps(head, _mm_mul_ps(x_3, _mm_set1_ps(h[0])));
+      _mm_storeu_ps(out, head);
+      head_ = _mm_cvtss_f32(
+          _mm_shuffle_ps(tail, tail, _MM_SHUFFLE(3, 3, 3, 3)));
+#else
+      const float32x4x4_t x = vld4q_f32(in);
+      float32x4_t tail = vaddq_f32(
+          vdupq_n_f32(0.0f), vmulq_n_f32(x.val[0], h[0]));
+      tail = vaddq_f32(tail, vmulq_n_f32(x.val[1], h[1]));
+      tail = vaddq_f32(tail, vmulq_n_f32(x.val[2], h[2]));
+      tail = vaddq_f32(tail, vmulq_n_f32(x.val[3], h[3]));
+      float32x4_t head = vextq_f32(vdupq_n_f32(head_), tail, 3);
+      head = vaddq_f32(head, vmulq_n_f32(x.val[0], h[3]));
+      head = vaddq_f32(head, vmulq_n_f32(x.val[1], h[2]));
+      head = vaddq_f32(head, vmulq_n_f32(x.val[2], h[1]));
+      head = vaddq_f32(head, vmulq_n_f32(x.val[3], h[0]));
+      vst1q_f32(out, head);
+      head_ = vgetq_lane_f32(tail, 3);
+#endif  // __SSE2__
+      in += 4 * kOversampling;
+      out += 4;
+    }
+#endif  // PLAITS_DOWNSAMPLER_SIMD
+    while (size--) {
+      float head = head_;
+      head += in[0] * h[3];
+      head += in[1] * h[2];
+      head += in[2] * h[1];
+      head += in[3] * h[0];
+      float tail = 0.0f;
+      tail += in[0] * h[0];
+      tail += in[1] * h[1];
+      tail += in[2] * h[2];
+      tail += in[3] * h[3];
+      *out++ = head;
+      head_ = tail;
+      in += kOversampling;
+    }
+  }
  private:
   float head_;
   float tail_;
@@ -29,6 +29,9 @@
 #ifndef PLAITS_DSP_ENGINE_ENGINE_H_
 #define PLAITS_DSP_ENGINE_ENGINE_H_
 
+#include <cstring>
+#include <new>
+
 #include "plaits/dsp/dsp.h"
 
 #include "stmlib/dsp/dsp.h"
@@ -359,18 +362,83 @@ inline void RenderEngineWithHardSync(
       already_enveloped);
 }
 
+// Placeholder member for an overlay engine (see EngineRegistry). A config that
+// declares its engines with PLAITS_ENGINE_MEMBER gets one of these, a single
+// byte, instead of the engine object, and registering its address registers
+// the engine's type.
+template<typename E>
+struct EngineSlot { };
+
+template<typename E>
+Engine* ConstructEngine(void* storage) {
+  return new(storage) E;
+}
+
+template<typename E>
+void DestroyEngine(Engine* engine) {
+  static_cast<E*>(engine)->~E();
+}
+
+// Engines are either resident -- a member of the voice, constructed with it
+// and Init()ed once at boot -- or overlay engines, which all share one block
+// of storage sized for the largest of them. Only the selected overlay engine
+// exists: Activate() destroys the previous one, constructs the new one in
+// place and Init()s it. Engines already share their BufferAllocator arena and
+// are Reset() on every model change, so the only state an overlay engine
+// loses is what survived in its members between two selections.
+//
+// A resident engine starts in zeroed .bss, and engines written for that leave
+// some members to it (the chiptune's fifth voice, the synthetic kick's
+// transient envelope did). Activate() zeroes the engine's storage before
+// constructing it, so that an overlay engine starts from the same state
+// rather than from whatever the previous engine left there.
 template<int max_size>
 class EngineRegistry {
  public:
   EngineRegistry() { }
   ~EngineRegistry() { }
   
-  void Init() {
+  // `overlay` is the storage overlay engines are constructed in; it can be
+  // NULL when only resident engines are registered.
+  void Init(void* overlay) {
     num_engines_ = 0;
+    overlay_ = overlay;
+    active_ = NULL;
+    active_construct_ = NULL;
+    active_destroy_ = NULL;
   }
 
+  // Valid for resident engines, and for the overlay engine last activated.
   inline Engine* get(int index) {
-    return engine_[index];
+    return construct_[index] ? active_ : engine_[index];
+  }
+
+  inline bool resident(int index) const {
+    return construct_[index] == NULL;
+  }
+
+  inline const PostProcessingSettings& settings(int index) const {
+    return settings_[index];
+  }
+
+  // Makes the engine at index the one that renders. Overlay engines sharing a
+  // class (the three DX7 banks) share the constructed object, as the resident
+  // registration shares one member.
+  Engine* Activate(int index, stmlib::BufferAllocator* allocator) {
+    if (resident(index) || construct_[index] == active_construct_) {
+      return get(index);
+    }
+    if (active_) {
+      active_destroy_(active_);
+    }
+    memset(overlay_, 0, size_[index]);
+    active_ = construct_[index](overlay_);
+    active_construct_ = construct_[index];
+    active_destroy_ = destroy_[index];
+    allocator->Free();
+    active_->Init(allocator);
+    active_->post_processing_settings = settings_[index];
+    return active_;
   }
   
   void RegisterInstance(
@@ -382,18 +450,53 @@ class EngineRegistry {
       return;
     }
     engine_[num_engines_] = instance;
-    PostProcessingSettings* s = &instance->post_processing_settings;
-    s->already_enveloped = already_enveloped;
-    s->out_gain = out_gain;
-    s->aux_gain = aux_gain;
+    size_[num_engines_] = 0;
+    construct_[num_engines_] = NULL;
+    destroy_[num_engines_] = NULL;
+    SetSettings(already_enveloped, out_gain, aux_gain);
+    instance->post_processing_settings = settings_[num_engines_];
+    ++num_engines_;
+  }
+
+  template<typename E>
+  void RegisterInstance(
+      EngineSlot<E>* slot,
+      bool already_enveloped,
+      float out_gain,
+      float aux_gain) {
+    (void) slot;
+    if (num_engines_ >= max_size) {
+      return;
+    }
+    engine_[num_engines_] = NULL;
+    size_[num_engines_] = sizeof(E);
+    construct_[num_engines_] = &ConstructEngine<E>;
+    destroy_[num_engines_] = &DestroyEngine<E>;
+    SetSettings(already_enveloped, out_gain, aux_gain);
     ++num_engines_;
   }
   
   inline int size() const { return num_engines_; }
 
  private:
+  void SetSettings(bool already_enveloped, float out_gain, float aux_gain) {
+    PostProcessingSettings* s = &settings_[num_engines_];
+    s->already_enveloped = already_enveloped;
+    s->out_gain = out_gain;
+    s->aux_gain = aux_gain;
+  }
+
   Engine* engine_[max_size];
+  size_t size_[max_size];
+  Engine* (*construct_[max_size])(void* storage);
+  void (*destroy_[max_size])(Engine* engine);
+  PostProcessingSettings settings_[max_size];
   int num_engines_;
+
+  void* overlay_;
+  Engine* active_;
+  Engine* (*active_construct_)(void* storage);
+  void (*active_destroy_)(Engine* engine);
 };
 
 }  // namespace plaits
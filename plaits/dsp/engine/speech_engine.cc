@@ -41,6 +41,11 @@ void SpeechEngine::Init(BufferAllocator* allocator) {
   naive_speech_synth_.Init();
 #if PLAITS_HAS_CUSTOM_SPEECH_BANKS
   InitRecipeSpeechWordBank(&lpc_speech_synth_word_bank_, allocator);
+#elif PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+  lpc_speech_synth_word_bank_.Init(
+      decoded_word_banks_,
+      LPC_SPEECH_SYNTH_NUM_WORD_BANKS,
+      allocator);
 #else
   lpc_speech_synth_word_bank_.Init(
       word_banks_,
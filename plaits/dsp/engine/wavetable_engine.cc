@@ -66,7 +66,7 @@ void WavetableEngine::Init(BufferAllocator* allocator) {
   diff_out_.Init();
   stereo_allpass_.Init();
 
-  wave_map_ = allocator->Allocate<const int16_t*>(kNumWavesPerBank);
+  wave_map_ = allocator->Allocate<const int16_t*>(kNumBanks * kNumWavesPerBank);
 }
 
 void WavetableEngine::Reset() {
@@ -239,12 +239,14 @@ void WavetableEngine::RenderInternal(
     MAKE_INTEGRAL_FRACTIONAL(p);
     
     {
+      // A knob at full scale lands exactly on 7.0 once quantized; the
+      // neighbour then has no weight but must still be a cell of the map.
       int x0 = x_integral;
-      int x1 = x_integral + 1;
+      int x1 = min(x_integral + 1, 7);
       int y0 = y_integral;
-      int y1 = y_integral + 1;
+      int y1 = min(y_integral + 1, 7);
       int z0 = z_integral;
-      int z1 = z_integral + 1;
+      int z1 = min(z_integral + 1, 7);
       
       if (z0 >= 4) {
         z0 = 7 - z0;
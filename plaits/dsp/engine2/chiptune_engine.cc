@@ -56,7 +56,7 @@ const float kStereoVoicePan[kChordNumVoices] = {
 
 void ChiptuneEngine::Init(BufferAllocator* allocator) {
   bass_.Init();
-  for (int i = 0; i < kChordNumNotes; ++i) {
+  for (int i = 0; i < kChordNumVoices; ++i) {
     voice_[i].Init();
   }
   
@@ -97,7 +97,6 @@ void ChiptuneEngine::Render(
   if (clocked) {
     if (parameters.trigger & TRIGGER_RISING_EDGE) {
       chords_.set_chord(parameters.harmonics, parameters.chord_set_option);
-      chords_.Sort();
 
       int pattern = arpeggiator_pattern_selector_.Process(parameters.timbre);
       arpeggiator_.set_mode(ArpeggiatorMode(pattern / 3));
@@ -87,6 +87,14 @@ void GranularCloudEngine::Init(BufferAllocator* allocator) {
   // the generator had got to -- which is how the module behaves, its generator
   // being global and shared with every other shape.
   rng_state_ = kGranularCloudSeed;
+  // The grains sit at fixed positions, so their gains are worked out once
+  // here rather than at every block.
+  for (int i = 0; i < kGranularCloudNumGrains; ++i) {
+    const float spread = static_cast<float>(i) /
+        static_cast<float>(kGranularCloudNumGrains - 1) - 0.5f;
+    StereoPanGains(0.5f + spread * kGranularCloudStereoSpread,
+                   &pan_left_[i], &pan_right_[i]);
+  }
   Reset();
 }
 
@@ -193,17 +201,6 @@ void GranularCloudEngine::Render(
 
   ParameterInterpolator peak_modulation(&peak_position_, target_peak, size);
 
-  float pan_left[kGranularCloudNumGrains];
-  float pan_right[kGranularCloudNumGrains];
-  if (stereo) {
-    for (int i = 0; i < kGranularCloudNumGrains; ++i) {
-      const float spread = static_cast<float>(i) /
-          static_cast<float>(kGranularCloudNumGrains - 1) - 0.5f;
-      StereoPanGains(0.5f + spread * kGranularCloudStereoSpread,
-                     &pan_left[i], &pan_right[i]);
-    }
-  }
-
   const float inverse_end = 1.0f / static_cast<float>(kGranularCloudEnvelopeEnd);
 
   size_t sample_index = 0;
@@ -245,8 +242,8 @@ void GranularCloudEngine::Render(
       mono += value;
       envelope_sum += envelope * kGranularCloudGrainGain;
       if (stereo) {
-        left += value * pan_left[i];
-        right += value * pan_right[i];
+        left += value * pan_left_[i];
+        right += value * pan_right_[i];
       }
     }
 
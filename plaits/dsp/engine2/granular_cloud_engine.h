@@ -315,6 +315,8 @@ class GranularCloudEngine : public Engine {
   };
 
   Grain grain_[kGranularCloudNumGrains];
+  float pan_left_[kGranularCloudNumGrains];
+  float pan_right_[kGranularCloudNumGrains];
 
   float aux_phase_;
   float peak_position_;
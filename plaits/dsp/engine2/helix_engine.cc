@@ -71,6 +71,11 @@ const float kInvNyquistFade = 1.0f / (kNyquistLimit - kNyquistFadeStart);
 
 void HelixEngine::Init(stmlib::BufferAllocator* allocator) {
   chords_.Init(allocator);
+  // Rounding the budget up makes at most kHelixRefreshSlices slices.
+  refresh_.Init(
+      kHelixOctaves * kChordNumNotes,
+      (kHelixOctaves * kChordNumNotes + kHelixRefreshSlices - 1) /
+          kHelixRefreshSlices);
   Reset();
 }
 
@@ -87,8 +92,8 @@ void HelixEngine::Reset() {
     pan_r_[i] = 0.0f;
   }
   inv_w_ = 1.0f;
-  setup_phase_ = 0;
-  weight_half_[0] = weight_half_[1] = 0.0f;
+  refresh_.Reset();
+  std::fill(&weight_slice_[0], &weight_slice_[kHelixRefreshSlices], 0.0f);
 }
 
 void HelixEngine::Render(const EngineParameters& parameters, float* out,
@@ -111,7 +116,6 @@ void HelixEngine::Render(const EngineParameters& parameters, float* out,
 #endif
   // HARMONICS selects the chord — its shape is what rises forever.
   chords_.set_chord(parameters.harmonics, parameters.chord_set_option);
-  chords_.Sort();  // fold each chord note into one octave -> sorted_ratio()
 
   float pitch_class[kChordNumNotes];
   for (int n = 0; n < kChordNumNotes; ++n) {
@@ -158,15 +162,12 @@ void HelixEngine::Render(const EngineParameters& parameters, float* out,
   // of every sample.
   const int kVoices = kHelixOctaves * kChordNumNotes;
   const float shift_mid = shift_ + shift_inc * (static_cast<float>(size) * 0.5f);
-  // Refresh HALF the palette's coefficients each block (staggered): every
-  // voice still updates at 2 kHz, but the setup cost is flat across blocks
-  // instead of spiking on alternate ones -- the deadline is per block, and a
-  // flat load is what keeps the worst block under it.
-  const int kHalfVoices = (kHelixOctaves * kChordNumNotes) / 2;
+  // This block's slice of the coefficients, see refresh_.
   {
-    const int start = setup_phase_ * kHalfVoices;
+    const int slice = refresh_.Next();
+    const int end = refresh_.end(slice);
     float weight = 0.0f;
-    for (int j = start; j < start + kHalfVoices; ++j) {
+    for (int j = refresh_.begin(slice); j < end; ++j) {
       const int oct = j / kChordNumNotes;
       const int n = j - oct * kChordNumNotes;
       const int idx = j;
@@ -216,10 +217,12 @@ void HelixEngine::Render(const EngineParameters& parameters, float* out,
         }
       }
     }
-    weight_half_[setup_phase_] = weight;
-    inv_w_ = 1.0f
-        / std::max(weight_half_[0] + weight_half_[1], 1.0e-3f);
-    setup_phase_ ^= 1;
+    weight_slice_[slice] = weight;
+    float total_weight = 0.0f;
+    for (int i = 0; i < kHelixRefreshSlices; ++i) {
+      total_weight += weight_slice_[i];
+    }
+    inv_w_ = 1.0f / std::max(total_weight, 1.0e-3f);
   }
   const float inv_w = inv_w_;
 
@@ -6,6 +6,7 @@
 
 #include "plaits/dsp/engine/engine.h"
 #include "plaits/dsp/chords/chord_bank.h"
+#include "plaits/dsp/staggered_refresh.h"
 
 namespace plaits {
 
@@ -19,6 +20,9 @@ const int kHelixOctaves = 4;  // 16 voices -- the ship config. QEMU-estimated 80
                               // alone and overruns once ISR overhead lands on top
                               // (hardware-validated, ~1% over the deadline).
 
+// Blocks over which the per-voice coefficient setup is spread, see refresh_.
+const int kHelixRefreshSlices = 2;
+
 class HelixEngine : public Engine {
  public:
   HelixEngine() { }
@@ -42,24 +46,19 @@ class HelixEngine : public Engine {
   // the note above Render(). x is the cosine component, y the sine we output.
   float osc_x_[kHelixOctaves * kChordNumNotes];
   float osc_y_[kHelixOctaves * kChordNumNotes];
-  // Per-voice coefficients, refreshed HALF the palette per block (staggered,
-  // setup_phase_ alternates which half): the glide moves the helix ~3.5e-4
-  // octaves per block, so a 2 kHz per-voice refresh is inaudible -- and
-  // staggering keeps every block's setup cost equal, where a full refresh on
-  // alternate blocks left the heavy block as heavy as no optimization at all
-  // (the audio deadline is per block, not on average).
+  // Per-voice coefficients. refresh_ recomputes one of kHelixRefreshSlices
+  // slices of the palette per block: the glide moves the helix ~3.5e-4 octaves
+  // per block, so the slower refresh is inaudible, and staggering it keeps
+  // every block's setup cost equal -- the audio deadline is per block, and a
+  // full refresh on alternate blocks left the heavy block as heavy as before.
   float gain_[kHelixOctaves * kChordNumNotes];
   float cos_w_[kHelixOctaves * kChordNumNotes];
   float sin_w_[kHelixOctaves * kChordNumNotes];
   float pan_l_[kHelixOctaves * kChordNumNotes];
   float pan_r_[kHelixOctaves * kChordNumNotes];
   float inv_w_;
-  // Staggered refresh: half the palette's coefficients per block, so every
-  // voice refreshes at 2 kHz but no single block carries the whole setup --
-  // the audio deadline is per BLOCK, and the earlier all-or-nothing scheme
-  // left the setup block as heavy as before the optimization.
-  int setup_phase_;
-  float weight_half_[2];
+  StaggeredRefresh refresh_;
+  float weight_slice_[kHelixRefreshSlices];      // summed gains of each slice
   float shift_;                                  // continuous octave glide, [0,1)
   DISALLOW_COPY_AND_ASSIGN(HelixEngine);
 };
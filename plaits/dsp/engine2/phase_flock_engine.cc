@@ -74,6 +74,7 @@ void PhaseFlockEngine::Init(BufferAllocator* allocator) {
 void PhaseFlockEngine::Reset() {
   scatter_count_ = 0;
   reset_pending_ = true;
+  frequency_cache_.Invalidate();
   for (int i = 0; i < kNumPhaseFlockOscillators; ++i) {
     sine_[i] = 0.0f;
     cosine_[i] = 1.0f;
@@ -102,20 +103,20 @@ void PhaseFlockEngine::Render(
   }
 
   const float base_frequency = min(0.20f, NoteToFrequency(parameters.note));
-  const float spread = 14.0f * parameters.harmonics * \
-      parameters.harmonics;
-  float natural_frequency[kNumPhaseFlockOscillators];
-#if PLAITS_BUILD_FREQUENCY_OFFSET_FM
-  float natural_ratio[kNumPhaseFlockOscillators];
-#endif
-  for (int i = 0; i < kNumPhaseFlockOscillators; ++i) {
-    natural_frequency[i] = min(
-        0.23f,
-        base_frequency * SemitonesToRatio(spread * kFlockDetuning[i]));
+  if (frequency_cache_.Changed(
+          ParameterCacheNoteKey(parameters.note),
+          ParameterCacheKnobKey(parameters.harmonics))) {
+    const float spread = 14.0f * parameters.harmonics * \
+        parameters.harmonics;
+    for (int i = 0; i < kNumPhaseFlockOscillators; ++i) {
+      natural_frequency_[i] = min(
+          0.23f,
+          base_frequency * SemitonesToRatio(spread * kFlockDetuning[i]));
 #if PLAITS_BUILD_FREQUENCY_OFFSET_FM
-    natural_ratio[i] = natural_frequency[i] /
-        (base_frequency > 1.0e-9f ? base_frequency : 1.0e-9f);
+      natural_ratio_[i] = natural_frequency_[i] /
+          (base_frequency > 1.0e-9f ? base_frequency : 1.0e-9f);
 #endif
+    }
   }
 
   const float coupling = min(
@@ -223,10 +224,10 @@ void PhaseFlockEngine::Render(
             (0.5f * quadrature_2 - quadrature_1) * cluster_mix;
         const float correction = (attraction - lag * quadrature) * \
             lag_normalization;
-        float increment = natural_frequency[i] + coupling * correction;
+        float increment = natural_frequency_[i] + coupling * correction;
 #if PLAITS_BUILD_FREQUENCY_OFFSET_FM
         if (parameters.frequency_offset) {
-          increment += parameters.frequency_offset[sample] * natural_ratio[i];
+          increment += parameters.frequency_offset[sample] * natural_ratio_[i];
           CONSTRAIN(increment, -0.24f, 0.24f);
         } else {
           CONSTRAIN(increment, 0.0f, 0.24f);
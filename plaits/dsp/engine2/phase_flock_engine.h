@@ -16,6 +16,7 @@
 #define PLAITS_DSP_ENGINE2_PHASE_FLOCK_ENGINE_H_
 
 #include "plaits/dsp/engine/engine.h"
+#include "plaits/dsp/parameter_cache.h"
 
 namespace plaits {
 
@@ -46,6 +47,16 @@ class PhaseFlockEngine : public Engine {
   int scatter_count_;
   bool reset_pending_;
 
+  // The flock's detuned natural frequencies follow NOTE and HARMONICS only,
+  // so they are recomputed when one of the two moves, not every block.
+  // Bit-identical on held knobs; under modulation they lag by at most one key
+  // step (1/4096 of HARMONICS, 1/256 semitone of NOTE).
+  ParameterCache frequency_cache_;
+  float natural_frequency_[kNumPhaseFlockOscillators];
+#if PLAITS_BUILD_FREQUENCY_OFFSET_FM
+  float natural_ratio_[kNumPhaseFlockOscillators];
+#endif
+
   DISALLOW_COPY_AND_ASSIGN(PhaseFlockEngine);
 };
 
@@ -86,6 +86,7 @@ void SawSwarmEngine::Reset() {
   cutoff_frequency_ = 440.0f / kSampleRate;
   resonance_ = kSawSwarmResonanceStock;
   morph_ = 0.5f;
+  frequency_cache_.Invalidate();
   svf_.Reset();
 }
 
@@ -113,13 +114,19 @@ void SawSwarmEngine::Render(
 
   // Braids' TIMBRE: detune spread (digital_oscillator.cc:168-179).
   const float timbre = parameters.timbre;
-  const float detune_k = 32.0f * timbre + 1.0f;
-  const float detune_semitones = detune_k * detune_k * kSawSwarmDetuneScale;
-
-  float target_frequency[kNumSawSwarmVoices];
-  for (int i = 0; i < kNumSawSwarmVoices; ++i) {
-    const float rank = static_cast<float>(i - 3);
-    target_frequency[i] = f0 * SemitonesToRatio(rank * detune_semitones);
+  if (frequency_cache_.Changed(
+          ParameterCacheNoteKey(parameters.note),
+          ParameterCacheKnobKey(timbre))) {
+    const float detune_k = 32.0f * timbre + 1.0f;
+    const float detune_semitones = detune_k * detune_k * kSawSwarmDetuneScale;
+    // The root offset of the linear FM scales every voice by its own ratio;
+    // dividing here keeps seven divides per sample out of the sample loop.
+    for (int i = 0; i < kNumSawSwarmVoices; ++i) {
+      const float rank = static_cast<float>(i - 3);
+      target_frequency_[i] = f0 * SemitonesToRatio(rank * detune_semitones);
+      frequency_ratio_[i] = target_frequency_[i] /
+          (f0 > 1.0e-9f ? f0 : 1.0e-9f);
+    }
   }
 
   // Braids' COLOR: HP filter cutoff, tracking the note with a steeper slope
@@ -144,7 +151,7 @@ void SawSwarmEngine::Render(
 
   ParameterInterpolator freq_mod[kNumSawSwarmVoices];
   for (int i = 0; i < kNumSawSwarmVoices; ++i) {
-    freq_mod[i].Init(&frequency_[i], target_frequency[i], size);
+    freq_mod[i].Init(&frequency_[i], target_frequency_[i], size);
   }
   ParameterInterpolator cutoff_modulation(
       &cutoff_frequency_, target_cutoff_frequency, size);
@@ -174,9 +181,8 @@ void SawSwarmEngine::Render(
     const float root_offset = 0.0f;
 #endif
     for (int i = 0; i < kNumSawSwarmVoices; ++i) {
-      const float ratio = target_frequency[i] /
-          (f0 > 1.0e-9f ? f0 : 1.0e-9f);
-      float frequency = freq_mod[i].Next() + root_offset * ratio;
+      float frequency = freq_mod[i].Next() + \
+          root_offset * frequency_ratio_[i];
       CONSTRAIN(frequency, -0.49f, 0.49f);
       phase_[i] += frequency;
       if (phase_[i] >= 1.0f) {
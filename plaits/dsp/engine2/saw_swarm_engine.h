@@ -220,6 +220,7 @@
 #include "stmlib/dsp/filter.h"
 
 #include "plaits/dsp/engine/engine.h"
+#include "plaits/dsp/parameter_cache.h"
 
 namespace plaits {
 
@@ -305,6 +306,15 @@ class SawSwarmEngine : public Engine {
   float resonance_;
   float morph_;
 
+  // Detuned voice frequencies and their ratios to the root: a pure function
+  // of NOTE and TIMBRE, so they are only recomputed when one of them moves.
+  // Bit-identical to computing them every block while the knobs are held;
+  // under modulation they lag by at most one key step (1/4096 of TIMBRE,
+  // 1/256 semitone of NOTE).
+  ParameterCache frequency_cache_;
+  float target_frequency_[kNumSawSwarmVoices];
+  float frequency_ratio_[kNumSawSwarmVoices];
+
   stmlib::Svf svf_;
   StereoPhaseAllpass<5> stereo_allpass_;
 
@@ -32,6 +32,7 @@
 
 #include "plaits/build_config.h"
 #include "plaits/resources.h"
+#include "plaits/user_data_region.h"
 
 namespace plaits {
 
@@ -136,15 +137,25 @@ void SixOpEngine::Init(BufferAllocator* allocator) {
   for (int i = 0; i < kNumSixOpVoices; ++i) {
     voice_[i].Init(&algorithms_, kCorrectedSampleRate);
   }
-  temp_buffer_ = allocator->Allocate<float>(kMaxBlockSize * 4);
-  acc_buffer_ = allocator->Allocate<float>(kMaxBlockSize * kNumSixOpVoices);
-  patches_ = allocator->Allocate<fm::Patch>(kNumPatchesPerBank);
+  // Voice i renders into block i, using the two blocks after it as scratch.
+  temp_buffer_ = allocator->Allocate<float>(
+      kMaxBlockSize * (kNumSixOpVoices + 2));
+  unpacked_patches_ = allocator->Allocate<fm::Patch>(kNumPatchesPerBank);
+  patches_ = unpacked_patches_;
   num_patches_ = kNumPatchesPerBank;
 
   post_filter_ = 0.0f;
   post_filter_right_ = 0.0f;
   active_voice_ = kNumSixOpVoices - 1;
-  rendered_voice_ = 0;
+}
+
+// A released voice whose carriers have faded below -100 dB is inaudible, but
+// rendering it would still cost as much as the sounding note. It is skipped
+// rather than unloaded: its envelopes stay where they are, so the next note
+// it is allocated starts without a patch setup block.
+bool SixOpEngine::voice_audible(int voice) const {
+  return voice == active_voice_ ||
+      voice_[voice].audible(kSixOpTailThreshold);
 }
 
 void SixOpEngine::Reset() {
@@ -170,9 +181,17 @@ void SixOpEngine::LoadUserData(const uint8_t* user_data, size_t length) {
   // patch-index quantizer to that count so the dial addresses only the real
   // patches — the block-fill zone-spreading the web builder used to do to reach
   // 32 becomes unnecessary. A null load keeps the full 32-step quantizer.
-  int n = user_data
-      ? static_cast<int>(length / fm::Patch::SYX_SIZE)
-      : kNumPatchesPerBank;
+  //
+  // A laid-out bank is already a run of fm::Patch records, and the voices read
+  // it straight from flash.
+  int n;
+  const uint8_t* records = UserDataLayout::records(
+      user_data, sizeof(fm::Patch), &n);
+  if (!records) {
+    n = user_data
+        ? static_cast<int>(length / fm::Patch::SYX_SIZE)
+        : kNumPatchesPerBank;
+  }
   if (n < 1) {
     n = 1;
   } else if (n > kNumPatchesPerBank) {
@@ -181,9 +200,15 @@ void SixOpEngine::LoadUserData(const uint8_t* user_data, size_t length) {
   num_patches_ = n;
   patch_index_quantizer_.Init(n, 0.005f, false);
 
-  if (user_data) {
-    for (int i = 0; i < n; ++i) {
-      patches_[i].Unpack(user_data + i * fm::Patch::SYX_SIZE);
+  if (records) {
+    patches_ = static_cast<const fm::Patch*>(
+        static_cast<const void*>(records));
+  } else {
+    patches_ = unpacked_patches_;
+    if (user_data) {
+      for (int i = 0; i < n; ++i) {
+        unpacked_patches_[i].Unpack(user_data + i * fm::Patch::SYX_SIZE);
+      }
     }
   }
   for (int i = 0; i < kNumSixOpVoices; ++i) {
@@ -264,14 +289,8 @@ void SixOpEngine::Render(
   }
 
   if (parameters.trigger & TRIGGER_UNPATCHED) {
-    // Render the single sustained voice at the native block size. The old
-    // staggered path rendered 2 * size samples every other block while also
-    // spending the intervening block rendering a silent voice. This produces
-    // the same continuous oscillator stream without the silent work.
     fill(&temp_buffer_[0], &temp_buffer_[size], 0.0f);
     voice_[0].Render(temp_buffer_, size);
-    fill(&acc_buffer_[0], &acc_buffer_[(kNumSixOpVoices - 1) * size], 0.0f);
-    rendered_voice_ = 0;
 
     const float output_gain = 0.25f *
         ((PLAITS_STEREO_SIX_OP && parameters.stereo)
@@ -280,35 +299,34 @@ void SixOpEngine::Render(
     RenderMonoOutput(output_gain, parameters.macro, out, aux, size);
     post_filter_right_ = post_filter_;
   } else if ((PLAITS_STEREO_SIX_OP && parameters.stereo)) {
-    // Staggered rendering, split by voice: the accumulation buffer always
-    // holds the tail of the single voice rendered on the previous block, so
-    // per-voice pan gains can be applied when the two halves are combined.
-    const int previous_voice = rendered_voice_;
-    fill(&temp_buffer_[0], &temp_buffer_[kNumSixOpVoices * size], 0.0f);
-    rendered_voice_ = (rendered_voice_ + 1) % kNumSixOpVoices;
-    voice_[rendered_voice_].Render(temp_buffer_, size * kNumSixOpVoices);
+    // Each voice gets its own block, so that the per-voice pan gains can be
+    // applied when they are combined. A voice's scratch space overlaps the
+    // blocks of the voices after it, hence the clear just before its render.
+    for (int i = 0; i < kNumSixOpVoices; ++i) {
+      float* voice_buffer = &temp_buffer_[i * size];
+      fill(&voice_buffer[0], &voice_buffer[size], 0.0f);
+      if (voice_audible(i)) {
+        voice_[i].Render(voice_buffer, size);
+      }
+    }
 
     // The unpatched drone returned through the dedicated centred path above.
     // Triggered notes use round-robin allocation and alternate sides.
-    const float previous_left_gain =
-        kSixOpPanLeft[previous_voice] * 0.25f;
-    const float previous_right_gain =
-        kSixOpPanRight[previous_voice] * 0.25f;
-    const float current_left_gain =
-        kSixOpPanLeft[rendered_voice_] * 0.25f;
-    const float current_right_gain =
-        kSixOpPanRight[rendered_voice_] * 0.25f;
+    const float* voice_0 = &temp_buffer_[0];
+    const float* voice_1 = &temp_buffer_[size];
+    const float left_gain_0 = kSixOpPanLeft[0] * 0.25f;
+    const float right_gain_0 = kSixOpPanRight[0] * 0.25f;
+    const float left_gain_1 = kSixOpPanLeft[1] * 0.25f;
+    const float right_gain_1 = kSixOpPanRight[1] * 0.25f;
     const float macro = parameters.macro;
     const float darkness = (0.5f - macro) * 2.0f;
     const float coefficient = 1.0f - darkness * 0.92f;
     if (macro < 0.5f) {
       for (size_t i = 0; i < size; ++i) {
-        const float previous = acc_buffer_[i];
-        const float current = temp_buffer_[i];
         float left = SoftClip(
-            previous * previous_left_gain + current * current_left_gain);
+            voice_0[i] * left_gain_0 + voice_1[i] * left_gain_1);
         float right = SoftClip(
-            previous * previous_right_gain + current * current_right_gain);
+            voice_0[i] * right_gain_0 + voice_1[i] * right_gain_1);
         ONE_POLE(post_filter_, left, coefficient);
         left = post_filter_;
         ONE_POLE(post_filter_right_, right, coefficient);
@@ -325,12 +343,10 @@ void SixOpEngine::Render(
       float last_left = post_filter_;
       float last_right = post_filter_right_;
       for (size_t i = 0; i < size; ++i) {
-        const float previous = acc_buffer_[i];
-        const float current = temp_buffer_[i];
         const float left = SoftClip(
-            previous * previous_left_gain + current * current_left_gain);
+            voice_0[i] * left_gain_0 + voice_1[i] * left_gain_1);
         const float right = SoftClip(
-            previous * previous_right_gain + current * current_right_gain);
+            voice_0[i] * right_gain_0 + voice_1[i] * right_gain_1);
         last_left = left;
         last_right = right;
         out[i] = left;
@@ -339,36 +355,16 @@ void SixOpEngine::Render(
       post_filter_ = last_left;
       post_filter_right_ = last_right;
     }
-    // std::copy lowers to a generic memmove in GCC 4.8.3. This fixed, small
-    // transfer is cheaper as a plain loop and has identical copy semantics
-    // because these buffers never overlap.
-    for (size_t i = 0; i < (kNumSixOpVoices - 1) * size; ++i) {
-      acc_buffer_[i] = temp_buffer_[size + i];
-    }
-    // Once a released voice's carriers are below -100 dB, its continued FM
-    // render is inaudible but can consume nearly half the callback budget.
-    // Unload only the older voice; the active note and real release overlap are
-    // preserved until that threshold is actually crossed.
-    if (rendered_voice_ != active_voice_ &&
-        !voice_[rendered_voice_].audible(kSixOpTailThreshold)) {
-      voice_[rendered_voice_].UnloadPatch();
-    }
   } else {
-    // Staggered rendering.
-    for (size_t i = 0; i < (kNumSixOpVoices - 1) * size; ++i) {
-      temp_buffer_[i] = acc_buffer_[i];
+    // Every voice renders every block, adding its carriers into the same
+    // block, so a new note sounds in the block of its trigger.
+    fill(&temp_buffer_[0], &temp_buffer_[size], 0.0f);
+    for (int i = 0; i < kNumSixOpVoices; ++i) {
+      if (voice_audible(i)) {
+        voice_[i].Render(temp_buffer_, size);
+      }
     }
-    fill(
-        &temp_buffer_[(kNumSixOpVoices - 1) * size],
-        &temp_buffer_[kNumSixOpVoices * size],
-        0.0f);
-    rendered_voice_ = (rendered_voice_ + 1) % kNumSixOpVoices;
-    voice_[rendered_voice_].Render(temp_buffer_, size * kNumSixOpVoices);
-
     RenderMonoOutput(0.25f, parameters.macro, out, aux, size);
-    for (size_t i = 0; i < (kNumSixOpVoices - 1) * size; ++i) {
-      acc_buffer_[i] = temp_buffer_[size + i];
-    }
   }
 }
 
@@ -104,6 +104,8 @@ class SixOpEngine : public Engine {
   // Variable-length bank: `length` bytes hold length / SYX_SIZE patches (1..32).
   // The Harmonics quantizer is re-sized to that count, so the dial sweeps only
   // the patches actually present — no need to zone-fill a short bank to 32.
+  // A bank laid out as fm::Patch records (UserDataLayout) declares its own
+  // count and is played in place.
   virtual void LoadUserData(const uint8_t* user_data, size_t length);
   virtual void Render(const EngineParameters& parameters,
       float* out,
@@ -115,29 +117,23 @@ class SixOpEngine : public Engine {
   void LoadBank(int bank);
   
  private:
-#if defined(__clang__)
-#define SIX_OP_RENDER_ATTRIBUTES __attribute__((noinline))
-#else
-#define SIX_OP_RENDER_ATTRIBUTES __attribute__((noinline, optimize("Os")))
-#endif
-  void SIX_OP_RENDER_ATTRIBUTES RenderMonoOutput(
+  void RenderMonoOutput(
       float gain,
       float macro,
       float* out,
       float* aux,
       size_t size);
-#undef SIX_OP_RENDER_ATTRIBUTES
+  bool voice_audible(int voice) const;
   stmlib::HysteresisQuantizer2 patch_index_quantizer_;
   fm::Algorithms<6> algorithms_;
-  fm::Patch* patches_;
+  const fm::Patch* patches_;
+  fm::Patch* unpacked_patches_;
   int num_patches_;
   FMVoice voice_[kNumSixOpVoices];
   float* temp_buffer_;
-  float* acc_buffer_;
   float post_filter_;
   float post_filter_right_;
   int active_voice_;
-  int rendered_voice_;
   
   DISALLOW_COPY_AND_ASSIGN(SixOpEngine);
 };
@@ -106,297 +106,333 @@ const uint8_t Algorithms<4>::opcodes_[8][4] = {
   }
 };
 
+// The 6-operator algorithms are defined as macros, so that the same opcodes
+// can be both stored in the table below and passed as template parameters to
+// the fused renderers.
+
+// Algorithm 1
+#define DX7_ALGORITHM_1 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUT(1),           /* Op 5 */ \
+    MOD(1) | OUT(1),           /* Op 4 */ \
+    MOD(1) | OUTPUT,           /* Op 3 */ \
+    NO_MOD | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 2
+#define DX7_ALGORITHM_2 \
+    NO_MOD | OUT(1),           /* Op 6 */ \
+    MOD(1) | OUT(1),           /* Op 5 */ \
+    MOD(1) | OUT(1),           /* Op 4 */ \
+    MOD(1) | OUTPUT,           /* Op 3 */ \
+    FB | OUT(1),               /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 3
+#define DX7_ALGORITHM_3 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUT(1),           /* Op 5 */ \
+    MOD(1) | OUTPUT,           /* Op 4 */ \
+    NO_MOD | OUT(1),           /* Op 3 */ \
+    MOD(1) | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 4
+#define DX7_ALGORITHM_4 \
+    FB_DST | NO_MOD | OUT(1),  /* Op 6 */ \
+    MOD(1) | OUT(1),           /* Op 5 */ \
+    FB_SRC | MOD(1) | OUTPUT,  /* Op 4 */ \
+    NO_MOD | OUT(1),           /* Op 3 */ \
+    MOD(1) | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 5
+#define DX7_ALGORITHM_5 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUTPUT,           /* Op 5 */ \
+    NO_MOD | OUT(1),           /* Op 4 */ \
+    MOD(1) | ADD(0),           /* Op 3 */ \
+    NO_MOD | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 6
+#define DX7_ALGORITHM_6 \
+    FB_DST | NO_MOD | OUT(1),  /* Op 6 */ \
+    FB_SRC | MOD(1) | OUTPUT,  /* Op 5 */ \
+    NO_MOD | OUT(1),           /* Op 4 */ \
+    MOD(1) | ADD(0),           /* Op 3 */ \
+    NO_MOD | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 7
+#define DX7_ALGORITHM_7 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUT(1),           /* Op 5 */ \
+    NO_MOD | ADD(1),           /* Op 4 */ \
+    MOD(1) | OUTPUT,           /* Op 3 */ \
+    NO_MOD | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 8
+#define DX7_ALGORITHM_8 \
+    NO_MOD | OUT(1),           /* Op 6 */ \
+    MOD(1) | OUT(1),           /* Op 5 */ \
+    FB | ADD(1),               /* Op 4 */ \
+    MOD(1) | OUTPUT,           /* Op 3 */ \
+    NO_MOD | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 9
+#define DX7_ALGORITHM_9 \
+    NO_MOD | OUT(1),           /* Op 6 */ \
+    MOD(1) | OUT(1),           /* Op 5 */ \
+    NO_MOD | ADD(1),           /* Op 4 */ \
+    MOD(1) | OUTPUT,           /* Op 3 */ \
+    FB | OUT(1),               /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 10
+#define DX7_ALGORITHM_10 \
+    NO_MOD | OUT(1),           /* Op 6 */ \
+    NO_MOD | ADD(1),           /* Op 5 */ \
+    MOD(1) | OUTPUT,           /* Op 4 */ \
+    FB | OUT(1),               /* Op 3 */ \
+    MOD(1) | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 11
+#define DX7_ALGORITHM_11 \
+    FB | OUT(1),               /* Op 6 */ \
+    NO_MOD | ADD(1),           /* Op 5 */ \
+    MOD(1) | OUTPUT,           /* Op 4 */ \
+    NO_MOD | OUT(1),           /* Op 3 */ \
+    MOD(1) | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 12
+#define DX7_ALGORITHM_12 \
+    NO_MOD | OUT(1),           /* Op 6 */ \
+    NO_MOD | ADD(1),           /* Op 5 */ \
+    NO_MOD | ADD(1),           /* Op 4 */ \
+    MOD(1) | OUTPUT,           /* Op 3 */ \
+    FB | OUT(1),               /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 13
+#define DX7_ALGORITHM_13 \
+    FB | OUT(1),               /* Op 6 */ \
+    NO_MOD | ADD(1),           /* Op 5 */ \
+    NO_MOD | ADD(1),           /* Op 4 */ \
+    MOD(1) | OUTPUT,           /* Op 3 */ \
+    NO_MOD | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 14
+#define DX7_ALGORITHM_14 \
+    FB | OUT(1),               /* Op 6 */ \
+    NO_MOD | ADD(1),           /* Op 5 */ \
+    MOD(1) | OUT(1),           /* Op 4 */ \
+    MOD(1) | OUTPUT,           /* Op 3 */ \
+    NO_MOD | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 15
+#define DX7_ALGORITHM_15 \
+    NO_MOD | OUT(1),           /* Op 6 */ \
+    NO_MOD | ADD(1),           /* Op 5 */ \
+    MOD(1) | OUT(1),           /* Op 4 */ \
+    MOD(1) | OUTPUT,           /* Op 3 */ \
+    FB | OUT(1),               /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 16
+#define DX7_ALGORITHM_16 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUT(1),           /* Op 5 */ \
+    NO_MOD | OUT(2),           /* Op 4 */ \
+    MOD(2) | ADD(1),           /* Op 3 */ \
+    NO_MOD | ADD(1),           /* Op 2 */ \
+    MOD(1) | OUTPUT            /* Op 1 */
+
+// Algorithm 17
+#define DX7_ALGORITHM_17 \
+    NO_MOD | OUT(1),           /* Op 6 */ \
+    MOD(1) | OUT(1),           /* Op 5 */ \
+    NO_MOD | OUT(2),           /* Op 4 */ \
+    MOD(2) | ADD(1),           /* Op 3 */ \
+    FB | ADD(1),               /* Op 2 */ \
+    MOD(1) | OUTPUT            /* Op 1 */
+
+// Algorithm 18
+#define DX7_ALGORITHM_18 \
+    NO_MOD | OUT(1),           /* Op 6 */ \
+    MOD(1) | OUT(1),           /* Op 5 */ \
+    MOD(1) | OUT(1),           /* Op 4 */ \
+    FB | ADD(1),               /* Op 3 */ \
+    NO_MOD | ADD(1),           /* Op 2 */ \
+    MOD(1) | OUTPUT            /* Op 1 */
+
+// Algorithm 19
+#define DX7_ALGORITHM_19 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUTPUT,           /* Op 5 */ \
+    MOD(1) | ADD(0),           /* Op 4 */ \
+    NO_MOD | OUT(1),           /* Op 3 */ \
+    MOD(1) | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 20
+#define DX7_ALGORITHM_20 \
+    NO_MOD | OUT(1),           /* Op 6 */ \
+    NO_MOD | ADD(1),           /* Op 5 */ \
+    MOD(1) | OUTPUT,           /* Op 4 */ \
+    FB | OUT(1),               /* Op 3 */ \
+    MOD(1) | ADD(0),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 21
+#define DX7_ALGORITHM_21 \
+    NO_MOD | OUT(1),           /* Op 6 */ \
+    MOD(1) | OUTPUT,           /* Op 5 */ \
+    MOD(1) | ADD(0),           /* Op 4 */ \
+    FB | OUT(1),               /* Op 3 */ \
+    MOD(1) | ADD(0),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 22
+#define DX7_ALGORITHM_22 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUTPUT,           /* Op 5 */ \
+    MOD(1) | ADD(0),           /* Op 4 */ \
+    MOD(1) | ADD(0),           /* Op 3 */ \
+    NO_MOD | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 23
+#define DX7_ALGORITHM_23 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUTPUT,           /* Op 5 */ \
+    MOD(1) | ADD(0),           /* Op 4 */ \
+    NO_MOD | OUT(1),           /* Op 3 */ \
+    MOD(1) | ADD(0),           /* Op 2 */ \
+    NO_MOD | ADD(0)            /* Op 1 */
+
+// Algorithm 24
+#define DX7_ALGORITHM_24 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUTPUT,           /* Op 5 */ \
+    MOD(1) | ADD(0),           /* Op 4 */ \
+    MOD(1) | ADD(0),           /* Op 3 */ \
+    NO_MOD | ADD(0),           /* Op 2 */ \
+    NO_MOD | ADD(0)            /* Op 1 */
+
+// Algorithm 25
+#define DX7_ALGORITHM_25 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUTPUT,           /* Op 5 */ \
+    MOD(1) | ADD(0),           /* Op 4 */ \
+    NO_MOD | ADD(0),           /* Op 3 */ \
+    NO_MOD | ADD(0),           /* Op 2 */ \
+    NO_MOD | ADD(0)            /* Op 1 */
+
+// Algorithm 26
+#define DX7_ALGORITHM_26 \
+    FB | OUT(1),               /* Op 6 */ \
+    NO_MOD | ADD(1),           /* Op 5 */ \
+    MOD(1) | OUTPUT,           /* Op 4 */ \
+    NO_MOD | OUT(1),           /* Op 3 */ \
+    MOD(1) | ADD(0),           /* Op 2 */ \
+    NO_MOD | ADD(0)            /* Op 1 */
+
+// Algorithm 27
+#define DX7_ALGORITHM_27 \
+    NO_MOD | OUT(1),           /* Op 6 */ \
+    NO_MOD | ADD(1),           /* Op 5 */ \
+    MOD(1) | OUTPUT,           /* Op 4 */ \
+    FB | OUT(1),               /* Op 3 */ \
+    MOD(1) | ADD(0),           /* Op 2 */ \
+    NO_MOD | ADD(0)            /* Op 1 */
+
+// Algorithm 28
+#define DX7_ALGORITHM_28 \
+    NO_MOD | OUTPUT,           /* Op 6 */ \
+    FB | OUT(1),               /* Op 5 */ \
+    MOD(1) | OUT(1),           /* Op 4 */ \
+    MOD(1) | ADD(0),           /* Op 3 */ \
+    NO_MOD | OUT(1),           /* Op 2 */ \
+    MOD(1) | ADD(0)            /* Op 1 */
+
+// Algorithm 29
+#define DX7_ALGORITHM_29 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUTPUT,           /* Op 5 */ \
+    NO_MOD | OUT(1),           /* Op 4 */ \
+    MOD(1) | ADD(0),           /* Op 3 */ \
+    NO_MOD | ADD(0),           /* Op 2 */ \
+    NO_MOD | ADD(0)            /* Op 1 */
+
+// Algorithm 30
+#define DX7_ALGORITHM_30 \
+    NO_MOD | OUTPUT,           /* Op 6 */ \
+    FB | OUT(1),               /* Op 5 */ \
+    MOD(1) | OUT(1),           /* Op 4 */ \
+    MOD(1) | ADD(0),           /* Op 3 */ \
+    NO_MOD | ADD(0),           /* Op 2 */ \
+    NO_MOD | ADD(0)            /* Op 1 */
+
+// Algorithm 31
+#define DX7_ALGORITHM_31 \
+    FB | OUT(1),               /* Op 6 */ \
+    MOD(1) | OUTPUT,           /* Op 5 */ \
+    NO_MOD | ADD(0),           /* Op 4 */ \
+    NO_MOD | ADD(0),           /* Op 3 */ \
+    NO_MOD | ADD(0),           /* Op 2 */ \
+    NO_MOD | ADD(0)            /* Op 1 */
+
+// Algorithm 32
+#define DX7_ALGORITHM_32 \
+    FB | OUTPUT,               /* Op 6 */ \
+    NO_MOD | ADD(0),           /* Op 5 */ \
+    NO_MOD | ADD(0),           /* Op 4 */ \
+    NO_MOD | ADD(0),           /* Op 3 */ \
+    NO_MOD | ADD(0),           /* Op 2 */ \
+    NO_MOD | ADD(0)            /* Op 1 */
+
 /* static */
 template<>
 const uint8_t Algorithms<6>::opcodes_[32][6] = {
-  {
-     // Algorithm 1
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUT(1),           // Op 5
-     MOD(1) | OUT(1),           // Op 4
-     MOD(1) | OUTPUT,           // Op 3
-     NO_MOD | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 2
-     NO_MOD | OUT(1),           // Op 6
-     MOD(1) | OUT(1),           // Op 5
-     MOD(1) | OUT(1),           // Op 4
-     MOD(1) | OUTPUT,           // Op 3
-     FB | OUT(1),               // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 3
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUT(1),           // Op 5
-     MOD(1) | OUTPUT,           // Op 4
-     NO_MOD | OUT(1),           // Op 3
-     MOD(1) | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 4
-     FB_DST | NO_MOD | OUT(1),  // Op 6
-     MOD(1) | OUT(1),           // Op 5
-     FB_SRC | MOD(1) | OUTPUT,  // Op 4
-     NO_MOD | OUT(1),           // Op 3
-     MOD(1) | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 5
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUTPUT,           // Op 5
-     NO_MOD | OUT(1),           // Op 4
-     MOD(1) | ADD(0),           // Op 3
-     NO_MOD | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 6
-     FB_DST | NO_MOD | OUT(1),  // Op 6
-     FB_SRC | MOD(1) | OUTPUT,  // Op 5
-     NO_MOD | OUT(1),           // Op 4
-     MOD(1) | ADD(0),           // Op 3
-     NO_MOD | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 7
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUT(1),           // Op 5
-     NO_MOD | ADD(1),           // Op 4
-     MOD(1) | OUTPUT,           // Op 3
-     NO_MOD | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 8
-     NO_MOD | OUT(1),           // Op 6
-     MOD(1) | OUT(1),           // Op 5
-     FB | ADD(1),               // Op 4
-     MOD(1) | OUTPUT,           // Op 3
-     NO_MOD | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 9
-     NO_MOD | OUT(1),           // Op 6
-     MOD(1) | OUT(1),           // Op 5
-     NO_MOD | ADD(1),           // Op 4
-     MOD(1) | OUTPUT,           // Op 3
-     FB | OUT(1),               // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 10
-     NO_MOD | OUT(1),           // Op 6
-     NO_MOD | ADD(1),           // Op 5
-     MOD(1) | OUTPUT,           // Op 4
-     FB | OUT(1),               // Op 3
-     MOD(1) | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 11
-     FB | OUT(1),               // Op 6
-     NO_MOD | ADD(1),           // Op 5
-     MOD(1) | OUTPUT,           // Op 4
-     NO_MOD | OUT(1),           // Op 3
-     MOD(1) | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 12
-     NO_MOD | OUT(1),           // Op 6
-     NO_MOD | ADD(1),           // Op 5
-     NO_MOD | ADD(1),           // Op 4
-     MOD(1) | OUTPUT,           // Op 3
-     FB | OUT(1),               // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 13
-     FB | OUT(1),               // Op 6
-     NO_MOD | ADD(1),           // Op 5
-     NO_MOD | ADD(1),           // Op 4
-     MOD(1) | OUTPUT,           // Op 3
-     NO_MOD | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 14
-     FB | OUT(1),               // Op 6
-     NO_MOD | ADD(1),           // Op 5
-     MOD(1) | OUT(1),           // Op 4
-     MOD(1) | OUTPUT,           // Op 3
-     NO_MOD | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 15
-     NO_MOD | OUT(1),           // Op 6
-     NO_MOD | ADD(1),           // Op 5
-     MOD(1) | OUT(1),           // Op 4
-     MOD(1) | OUTPUT,           // Op 3
-     FB | OUT(1),               // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 16
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUT(1),           // Op 5
-     NO_MOD | OUT(2),           // Op 4
-     MOD(2) | ADD(1),           // Op 3
-     NO_MOD | ADD(1),           // Op 2
-     MOD(1) | OUTPUT            // Op 1
-  },
-  {
-     // Algorithm 17
-     NO_MOD | OUT(1),           // Op 6
-     MOD(1) | OUT(1),           // Op 5
-     NO_MOD | OUT(2),           // Op 4
-     MOD(2) | ADD(1),           // Op 3
-     FB | ADD(1),               // Op 2
-     MOD(1) | OUTPUT            // Op 1
-  },
-  {
-     // Algorithm 18
-     NO_MOD | OUT(1),           // Op 6
-     MOD(1) | OUT(1),           // Op 5
-     MOD(1) | OUT(1),           // Op 4
-     FB | ADD(1),               // Op 3
-     NO_MOD | ADD(1),           // Op 2
-     MOD(1) | OUTPUT            // Op 1
-  },
-  {
-     // Algorithm 19
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUTPUT,           // Op 5
-     MOD(1) | ADD(0),           // Op 4
-     NO_MOD | OUT(1),           // Op 3
-     MOD(1) | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 20
-     NO_MOD | OUT(1),           // Op 6
-     NO_MOD | ADD(1),           // Op 5
-     MOD(1) | OUTPUT,           // Op 4
-     FB | OUT(1),               // Op 3
-     MOD(1) | ADD(0),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 21
-     NO_MOD | OUT(1),           // Op 6
-     MOD(1) | OUTPUT,           // Op 5
-     MOD(1) | ADD(0),           // Op 4
-     FB | OUT(1),               // Op 3
-     MOD(1) | ADD(0),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 22
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUTPUT,           // Op 5
-     MOD(1) | ADD(0),           // Op 4
-     MOD(1) | ADD(0),           // Op 3
-     NO_MOD | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 23
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUTPUT,           // Op 5
-     MOD(1) | ADD(0),           // Op 4
-     NO_MOD | OUT(1),           // Op 3
-     MOD(1) | ADD(0),           // Op 2
-     NO_MOD | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 24
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUTPUT,           // Op 5
-     MOD(1) | ADD(0),           // Op 4
-     MOD(1) | ADD(0),           // Op 3
-     NO_MOD | ADD(0),           // Op 2
-     NO_MOD | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 25
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUTPUT,           // Op 5
-     MOD(1) | ADD(0),           // Op 4
-     NO_MOD | ADD(0),           // Op 3
-     NO_MOD | ADD(0),           // Op 2
-     NO_MOD | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 26
-     FB | OUT(1),               // Op 6
-     NO_MOD | ADD(1),           // Op 5
-     MOD(1) | OUTPUT,           // Op 4
-     NO_MOD | OUT(1),           // Op 3
-     MOD(1) | ADD(0),           // Op 2
-     NO_MOD | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 27
-     NO_MOD | OUT(1),           // Op 6
-     NO_MOD | ADD(1),           // Op 5
-     MOD(1) | OUTPUT,           // Op 4
-     FB | OUT(1),               // Op 3
-     MOD(1) | ADD(0),           // Op 2
-     NO_MOD | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 28
-     NO_MOD | OUTPUT,           // Op 6
-     FB | OUT(1),               // Op 5
-     MOD(1) | OUT(1),           // Op 4
-     MOD(1) | ADD(0),           // Op 3
-     NO_MOD | OUT(1),           // Op 2
-     MOD(1) | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 29
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUTPUT,           // Op 5
-     NO_MOD | OUT(1),           // Op 4
-     MOD(1) | ADD(0),           // Op 3
-     NO_MOD | ADD(0),           // Op 2
-     NO_MOD | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 30
-     NO_MOD | OUTPUT,           // Op 6
-     FB | OUT(1),               // Op 5
-     MOD(1) | OUT(1),           // Op 4
-     MOD(1) | ADD(0),           // Op 3
-     NO_MOD | ADD(0),           // Op 2
-     NO_MOD | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 31
-     FB | OUT(1),               // Op 6
-     MOD(1) | OUTPUT,           // Op 5
-     NO_MOD | ADD(0),           // Op 4
-     NO_MOD | ADD(0),           // Op 3
-     NO_MOD | ADD(0),           // Op 2
-     NO_MOD | ADD(0)            // Op 1
-  },
-  {
-     // Algorithm 32
-     FB | OUTPUT,               // Op 6
-     NO_MOD | ADD(0),           // Op 5
-     NO_MOD | ADD(0),           // Op 4
-     NO_MOD | ADD(0),           // Op 3
-     NO_MOD | ADD(0),           // Op 2
-     NO_MOD | ADD(0)            // Op 1
-  }
+  { DX7_ALGORITHM_1 },
+  { DX7_ALGORITHM_2 },
+  { DX7_ALGORITHM_3 },
+  { DX7_ALGORITHM_4 },
+  { DX7_ALGORITHM_5 },
+  { DX7_ALGORITHM_6 },
+  { DX7_ALGORITHM_7 },
+  { DX7_ALGORITHM_8 },
+  { DX7_ALGORITHM_9 },
+  { DX7_ALGORITHM_10 },
+  { DX7_ALGORITHM_11 },
+  { DX7_ALGORITHM_12 },
+  { DX7_ALGORITHM_13 },
+  { DX7_ALGORITHM_14 },
+  { DX7_ALGORITHM_15 },
+  { DX7_ALGORITHM_16 },
+  { DX7_ALGORITHM_17 },
+  { DX7_ALGORITHM_18 },
+  { DX7_ALGORITHM_19 },
+  { DX7_ALGORITHM_20 },
+  { DX7_ALGORITHM_21 },
+  { DX7_ALGORITHM_22 },
+  { DX7_ALGORITHM_23 },
+  { DX7_ALGORITHM_24 },
+  { DX7_ALGORITHM_25 },
+  { DX7_ALGORITHM_26 },
+  { DX7_ALGORITHM_27 },
+  { DX7_ALGORITHM_28 },
+  { DX7_ALGORITHM_29 },
+  { DX7_ALGORITHM_30 },
+  { DX7_ALGORITHM_31 },
+  { DX7_ALGORITHM_32 }
 };
 
 #define INSTANTIATE_RENDERER(n, m, a) { n, m, a, &RenderOperators<n, m, a> }
@@ -452,6 +488,135 @@ const Algorithms<6>::RendererSpecs Algorithms<6>::renderers_[] = {
   { 0, 0, 0, NULL}
 };
 
+// One operator of a fused renderer, for one sample. bus[0] is the output,
+// bus[1] and bus[2] the modulation buffers, bus[3] the feedback signal - the
+// same indices as the opcodes and as the buffers of Voice::Render.
+template<int opcode>
+inline void RenderFusedOperator(
+    uint32_t* phase,
+    uint32_t frequency,
+    float* amplitude,
+    float amplitude_increment,
+    float* previous,
+    float* bus) {
+  const int source = (opcode & Algorithms<6>::SOURCE_MASK) >> 4;
+  const int destination = opcode & Algorithms<6>::DESTINATION_MASK;
+  
+  *phase += frequency;
+  const float pm = SinePM(*phase, source ? bus[source] : 0.0f) * *amplitude;
+  *amplitude += amplitude_increment;
+  if (opcode & Algorithms<6>::ADDITIVE_FLAG) {
+    bus[destination] += pm;
+  } else {
+    bus[destination] = pm;
+  }
+  if (opcode & Algorithms<6>::FEEDBACK_SOURCE_FLAG) {
+    previous[1] = previous[0];
+    previous[0] = pm;
+  }
+}
+
+template<int o0, int o1, int o2, int o3, int o4, int o5>
+void RenderAlgorithm(
+    Operator* ops,
+    const float* f,
+    const float* a,
+    float* fb_state,
+    int fb_amount,
+    float* out,
+    size_t size) {
+  uint32_t frequency[6];
+  uint32_t phase[6];
+  float amplitude[6];
+  float amplitude_increment[6];
+  
+  const float scale = 1.0f / float(size);
+  for (int i = 0; i < 6; ++i) {
+    frequency[i] = static_cast<uint32_t>(std::min(f[i], 0.5f) * 4294967296.0f);
+    phase[i] = ops[i].phase;
+    amplitude[i] = ops[i].amplitude;
+    amplitude_increment[i] = (std::min(a[i], 4.0f) - amplitude[i]) * scale;
+  }
+  
+  float previous[2] = { fb_state[0], fb_state[1] };
+  const float fb_scale = fb_amount ? float(1 << fb_amount) / 512.0f : 0.0f;
+  
+  while (size--) {
+    float bus[4];
+    bus[0] = *out;
+    bus[3] = (previous[0] + previous[1]) * fb_scale;
+    RenderFusedOperator<o0>(
+        &phase[0], frequency[0], &amplitude[0], amplitude_increment[0],
+        previous, bus);
+    RenderFusedOperator<o1>(
+        &phase[1], frequency[1], &amplitude[1], amplitude_increment[1],
+        previous, bus);
+    RenderFusedOperator<o2>(
+        &phase[2], frequency[2], &amplitude[2], amplitude_increment[2],
+        previous, bus);
+    RenderFusedOperator<o3>(
+        &phase[3], frequency[3], &amplitude[3], amplitude_increment[3],
+        previous, bus);
+    RenderFusedOperator<o4>(
+        &phase[4], frequency[4], &amplitude[4], amplitude_increment[4],
+        previous, bus);
+    RenderFusedOperator<o5>(
+        &phase[5], frequency[5], &amplitude[5], amplitude_increment[5],
+        previous, bus);
+    *out++ = bus[0];
+  }
+  
+  for (int i = 0; i < 6; ++i) {
+    ops[i].phase = phase[i];
+    ops[i].amplitude = amplitude[i];
+  }
+  fb_state[0] = previous[0];
+  fb_state[1] = previous[1];
+}
+
+/* static */
+template<>
+const AlgorithmFn Algorithms<4>::algorithm_fn_[8] = { NULL };
+
+#define INSTANTIATE_ALGORITHM(n) &RenderAlgorithm<DX7_ALGORITHM_ ## n>
+
+/* static */
+template<>
+const AlgorithmFn Algorithms<6>::algorithm_fn_[32] = {
+  INSTANTIATE_ALGORITHM(1),
+  INSTANTIATE_ALGORITHM(2),
+  INSTANTIATE_ALGORITHM(3),
+  INSTANTIATE_ALGORITHM(4),
+  INSTANTIATE_ALGORITHM(5),
+  INSTANTIATE_ALGORITHM(6),
+  INSTANTIATE_ALGORITHM(7),
+  INSTANTIATE_ALGORITHM(8),
+  INSTANTIATE_ALGORITHM(9),
+  INSTANTIATE_ALGORITHM(10),
+  INSTANTIATE_ALGORITHM(11),
+  INSTANTIATE_ALGORITHM(12),
+  INSTANTIATE_ALGORITHM(13),
+  INSTANTIATE_ALGORITHM(14),
+  INSTANTIATE_ALGORITHM(15),
+  INSTANTIATE_ALGORITHM(16),
+  INSTANTIATE_ALGORITHM(17),
+  INSTANTIATE_ALGORITHM(18),
+  INSTANTIATE_ALGORITHM(19),
+  INSTANTIATE_ALGORITHM(20),
+  INSTANTIATE_ALGORITHM(21),
+  INSTANTIATE_ALGORITHM(22),
+  INSTANTIATE_ALGORITHM(23),
+  INSTANTIATE_ALGORITHM(24),
+  INSTANTIATE_ALGORITHM(25),
+  INSTANTIATE_ALGORITHM(26),
+  INSTANTIATE_ALGORITHM(27),
+  INSTANTIATE_ALGORITHM(28),
+  INSTANTIATE_ALGORITHM(29),
+  INSTANTIATE_ALGORITHM(30),
+  INSTANTIATE_ALGORITHM(31),
+  INSTANTIATE_ALGORITHM(32)
+};
+
 }  // namespace fm
   
 }  // namespace plaits
@@ -44,6 +44,16 @@ template<int num_operators> struct NumAlgorithms { enum { N = 1 }; };
 template<> struct NumAlgorithms<4> { enum { N = 8 }; };
 template<> struct NumAlgorithms<6> { enum { N = 32 }; };
 
+// Renders all the operators of an algorithm, mixing the carriers into out.
+typedef void (*AlgorithmFn)(
+    Operator* ops,
+    const float* f,
+    const float* a,
+    float* fb_state,
+    int fb_amount,
+    float* out,
+    size_t size);
+
 // Store information about all FM algorithms, and which functions to call
 // to render them.
 // 
@@ -60,6 +70,13 @@ template<> struct NumAlgorithms<6> { enum { N = 32 }; };
 // Different code space and speed trade-off can be obtained by increasing the
 // palette of available renderers (for example by specializing the code for
 // a renderer rendering in a single pass a "tower" of 4 operators).
+//
+// The 6-operator algorithms also have a fused renderer each: the opcodes are
+// template parameters, so every operator of the algorithm is rendered in the
+// same sample loop, the modulation signals stay in registers instead of going
+// through the intermediate buffers, and there is one call per block instead of
+// one per group of operators. The renderer is picked once, when a patch is
+// loaded (see Voice::Setup). Both paths produce the same samples.
 template<int num_operators>
 class Algorithms {
  public:
@@ -99,6 +116,11 @@ class Algorithms {
     return opcodes_[algorithm][op] & DESTINATION_MASK;
   }
   
+  // NULL when there is no fused renderer for this algorithm.
+  inline AlgorithmFn algorithm_fn(int algorithm) const {
+    return algorithm_fn_[algorithm];
+  }
+  
  private:
   struct RendererSpecs {
     int n;
@@ -191,6 +213,7 @@ class Algorithms {
   RenderCall render_call_[NUM_ALGORITHMS][num_operators];
   static const uint8_t opcodes_[NUM_ALGORITHMS][num_operators];
   static const RendererSpecs renderers_[];
+  static const AlgorithmFn algorithm_fn_[NUM_ALGORITHMS];
   
   DISALLOW_COPY_AND_ASSIGN(Algorithms);
 };
@@ -207,6 +230,12 @@ template<> const uint8_t Algorithms<6>::opcodes_[][6];  // From DX7
 /* static */
 template<> const Algorithms<6>::RendererSpecs Algorithms<6>::renderers_[];
 
+/* static */
+template<> const AlgorithmFn Algorithms<4>::algorithm_fn_[8];
+
+/* static */
+template<> const AlgorithmFn Algorithms<6>::algorithm_fn_[32];
+
 }  // namespace fm
 
 }  // namespace plaits
@@ -31,6 +31,7 @@
 
 #include "stmlib/stmlib.h"
 
+#include "plaits/build_config.h"
 #include "plaits/dsp/fm/algorithms.h"
 #include "plaits/dsp/fm/dx_units.h"
 #include "plaits/dsp/fm/envelope.h"
@@ -67,6 +68,9 @@ class Voice {
       const Algorithms<num_operators>* algorithms,
       float sample_rate) {
     algorithms_ = algorithms;
+#if PLAITS_BUILD_FUSED_FM_ALGORITHMS
+    algorithm_fn_ = NULL;
+#endif  // PLAITS_BUILD_FUSED_FM_ALGORITHMS
 
     sample_rate_ = sample_rate;
     one_hz_ = 1.0f / sample_rate;
@@ -89,6 +93,8 @@ class Voice {
     normalized_velocity_ = 10.0f;
     
     dirty_ = true;
+    scaling_dirty_ = true;
+    level_mod_dirty_ = true;
   }
   
   inline void SetPatch(const Patch* patch) {
@@ -122,11 +128,48 @@ class Voice {
       // (1Hz or the root note) as the sign of the ratio.
       float sign = op.mode == 0 ? 1.0f : -1.0f;
       ratios_[i] = sign * FrequencyRatio(op);
+
+      modulator_[i] = algorithms_->is_modulator(patch_->algorithm, i);
+      amp_mod_sensitivity_[i] = AmpModSensitivity(op.amp_mod_sensitivity);
     }
+#if PLAITS_BUILD_FUSED_FM_ALGORITHMS
+    algorithm_fn_ = algorithms_->algorithm_fn(patch_->algorithm);
+#endif  // PLAITS_BUILD_FUSED_FM_ALGORITHMS
     dirty_ = false;
+    scaling_dirty_ = true;
+    level_mod_dirty_ = true;
     return true;
   }
   
+  // Rate and level scaling only change with the patch, the note and the
+  // velocity -- that is, on a note on, or while the knobs move in free-running
+  // mode. Recomputing them for each operator in every block is wasted work.
+  inline void UpdateScaling() {
+    for (int i = 0; i < num_operators; ++i) {
+      const Patch::Operator& op = patch_->op[i];
+      rate_scaling_[i] = RateScaling(note_, op.rate_scaling);
+      level_scaling_[i] = KeyboardScaling(note_, op.keyboard_scaling) + \
+          normalized_velocity_ * float(op.velocity_sensitivity);
+    }
+    scaling_dirty_ = false;
+  }
+  
+  // The amplitude modulation of each operator only moves with the LFO, and
+  // not at all when the patch does not use it.
+  inline void UpdateLevelModulation(float amp_mod) {
+    for (int i = 0; i < num_operators; ++i) {
+      const float sensitivity = amp_mod_sensitivity_[i];
+#ifdef FAST_OP_LEVEL_MODULATION
+      level_mod_[i] = 1.0f - sensitivity * amp_mod;
+#else
+      const float log_level_mod = sensitivity * amp_mod - 1.0f;
+      level_mod_[i] = 1.0f - Pow2Fast<2>(6.4f * log_level_mod);
+#endif  // FAST_OP_LEVEL_MODULATION
+    }
+    amp_mod_ = amp_mod;
+    level_mod_dirty_ = false;
+  }
+  
   inline float op_level(int i) const {
     return level_[i];
   }
@@ -202,8 +245,19 @@ class Voice {
     const bool note_on = parameters.gate && !gate_;
     gate_ = parameters.gate;
     if (note_on || parameters.sustain) {
-      normalized_velocity_ = NormalizeVelocity(parameters.velocity);
-      note_ = parameters.note;
+      const float normalized_velocity = NormalizeVelocity(parameters.velocity);
+      if (normalized_velocity != normalized_velocity_ ||
+          parameters.note != note_) {
+        normalized_velocity_ = normalized_velocity;
+        note_ = parameters.note;
+        scaling_dirty_ = true;
+      }
+    }
+    if (scaling_dirty_) {
+      UpdateScaling();
+    }
+    if (level_mod_dirty_ || parameters.amp_mod != amp_mod_) {
+      UpdateLevelModulation(parameters.amp_mod);
     }
     
     // Reset operator phase if a note on is detected & if the patch requires it.
@@ -218,45 +272,48 @@ class Voice {
     float a[num_operators];
     const float modulator_ratio = stmlib::SemitonesToRatioSafe(
         parameters.modulator_detune);
+    const float modulator_brightness = (parameters.brightness - 0.5f) * 32.0f;
     for (int i = 0; i < num_operators; ++i) {
-      const Patch::Operator& op = patch_->op[i];
-      
       f[i] = ratios_[i] * (ratios_[i] < 0.0f ? -one_hz_ : f0);
-      if (algorithms_->is_modulator(patch_->algorithm, i)) {
+      if (modulator_[i]) {
         f[i] *= modulator_ratio;
       }
 
-      const float rate_scaling = RateScaling(note_, op.rate_scaling);
       float level = parameters.sustain
           ? operator_envelope_[i].RenderAtSample(envelope_sample, gate_duration)
           : operator_envelope_[i].Render(
                 parameters.gate,
-                envelope_rate * rate_scaling,
+                envelope_rate * rate_scaling_[i],
                 ad_scale,
                 r_scale);
-      const float kb_scaling = KeyboardScaling(note_, op.keyboard_scaling);
-      const float velocity_scaling = normalized_velocity_ * \
-          float(op.velocity_sensitivity);
-      const float brightness = algorithms_->is_modulator(patch_->algorithm, i)
-          ? (parameters.brightness - 0.5f) * 32.0f
-          : 0.0f;
+      const float brightness = modulator_[i] ? modulator_brightness : 0.0f;
       
       level += 0.125f * std::min(
-          kb_scaling + velocity_scaling + brightness,
+          level_scaling_[i] + brightness,
           level_headroom_[i]);
       
       level_[i] = level;
       
-      const float sensitivity = AmpModSensitivity(op.amp_mod_sensitivity);
 #ifdef FAST_OP_LEVEL_MODULATION
-      const float level_mod = 1.0f - sensitivity * parameters.amp_mod;
-      a[i] = Pow2Fast<2>(-14.0f + level) * level_mod;
+      a[i] = Pow2Fast<2>(-14.0f + level) * level_mod_[i];
 #else
-      const float log_level_mod = sensitivity * parameters.amp_mod - 1.0f;
-      const float level_mod = 1.0f - Pow2Fast<2>(6.4f * log_level_mod);
-      a[i] = Pow2Fast<2>(-14.0f + level * level_mod);
-#endif  // FAST_LINEAR_AMPLITUDE_MODULATION
+      a[i] = Pow2Fast<2>(-14.0f + level * level_mod_[i]);
+#endif  // FAST_OP_LEVEL_MODULATION
+    }
+    
+#if PLAITS_BUILD_FUSED_FM_ALGORITHMS
+    if (algorithm_fn_) {
+      (*algorithm_fn_)(
+          operator_,
+          f,
+          a,
+          feedback_state_,
+          patch_->feedback,
+          buffers[0],
+          size);
+      return;
     }
+#endif  // PLAITS_BUILD_FUSED_FM_ALGORITHMS
     
     for (int i = 0; i < num_operators; ) {
       const typename Algorithms<num_operators>::RenderCall& call = \
@@ -276,6 +333,9 @@ class Voice {
   
  private:
   const Algorithms<num_operators>* algorithms_;
+#if PLAITS_BUILD_FUSED_FM_ALGORITHMS
+  AlgorithmFn algorithm_fn_;
+#endif  // PLAITS_BUILD_FUSED_FM_ALGORITHMS
   float sample_rate_;
   float one_hz_;
   float a0_;
@@ -292,12 +352,20 @@ class Voice {
   float ratios_[num_operators];
   float level_headroom_[num_operators];
   float level_[num_operators];
+  bool modulator_[num_operators];
+  float amp_mod_sensitivity_[num_operators];
+  float rate_scaling_[num_operators];
+  float level_scaling_[num_operators];
+  float level_mod_[num_operators];
+  float amp_mod_;
   
   float feedback_state_[2];
   
   const Patch* patch_;
   
   bool dirty_;
+  bool scaling_dirty_;
+  bool level_mod_dirty_;
   
   DISALLOW_COPY_AND_ASSIGN(Voice);
 };
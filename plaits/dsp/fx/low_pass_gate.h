@@ -44,7 +44,14 @@ class LowPassGate {
   
   void Init() {
     previous_gain_ = 0.0f;
-    filter_.Init();
+    state_1_ = state_2_ = 0.0f;
+  }
+  
+  // True when the gate is shut and has finished ringing: the block will be
+  // silent, and rendering it would leave the same state.
+  inline bool closed(float gain) const {
+    return gain == 0.0f && previous_gain_ == 0.0f && \
+        state_1_ == 0.0f && state_2_ == 0.0f;
   }
   
   void Process(
@@ -54,12 +61,16 @@ class LowPassGate {
       float* in_out,
       size_t size) {
     stmlib::ParameterInterpolator gain_modulation(&previous_gain_, gain, size);
-    filter_.set_f_q<stmlib::FREQUENCY_DIRTY>(frequency, 0.4f);
+    const Coefficients c(frequency);
+    float state_1 = state_1_;
+    float state_2 = state_2_;
     while (size--) {
       const float s = *in_out * gain_modulation.Next();
-      const float lp = filter_.Process<stmlib::FILTER_MODE_LOW_PASS>(s);
+      const float lp = c.LowPass(s, &state_1, &state_2);
       *in_out++ = lp + (s - lp) * hf_bleed;
     }
+    state_1_ = state_1;
+    state_2_ = state_2;
   }
   
   void Process(
@@ -70,19 +81,109 @@ class LowPassGate {
       short* out,
       size_t size,
       size_t stride) {
+    if (closed(gain)) {
+      Silence(out, size, stride);
+      return;
+    }
     stmlib::ParameterInterpolator gain_modulation(&previous_gain_, gain, size);
-    filter_.set_f_q<stmlib::FREQUENCY_DIRTY>(frequency, 0.4f);
+    const Coefficients c(frequency);
+    float state_1 = state_1_;
+    float state_2 = state_2_;
     while (size--) {
       const float s = *in++ * gain_modulation.Next();
-      const float lp = filter_.Process<stmlib::FILTER_MODE_LOW_PASS>(s);
+      const float lp = c.LowPass(s, &state_1, &state_2);
       *out = stmlib::Clip16(1 + static_cast<int32_t>(lp + (s - lp) * hf_bleed));
       out += stride;
     }
+    state_1_ = state_1;
+    state_2_ = state_2;
+  }
+  
+  // Two gates opened by the same envelope (OUT and AUX of a voice), each with
+  // its own gain, rendered in one pass: the filter coefficients are computed
+  // once, and the two independent filters interleave in the loop. Same
+  // samples as calling the single-channel Process on each.
+  static void Process(
+      LowPassGate* lpg_a,
+      LowPassGate* lpg_b,
+      float gain_a,
+      float gain_b,
+      float frequency,
+      float hf_bleed,
+      float* in_a,
+      float* in_b,
+      short* out_a,
+      short* out_b,
+      size_t size,
+      size_t stride) {
+    if (lpg_a->closed(gain_a) || lpg_b->closed(gain_b)) {
+      lpg_a->Process(gain_a, frequency, hf_bleed, in_a, out_a, size, stride);
+      lpg_b->Process(gain_b, frequency, hf_bleed, in_b, out_b, size, stride);
+      return;
+    }
+    stmlib::ParameterInterpolator gain_modulation_a(
+        &lpg_a->previous_gain_, gain_a, size);
+    stmlib::ParameterInterpolator gain_modulation_b(
+        &lpg_b->previous_gain_, gain_b, size);
+    const Coefficients c(frequency);
+    float state_1_a = lpg_a->state_1_;
+    float state_2_a = lpg_a->state_2_;
+    float state_1_b = lpg_b->state_1_;
+    float state_2_b = lpg_b->state_2_;
+    while (size--) {
+      const float s_a = *in_a++ * gain_modulation_a.Next();
+      const float s_b = *in_b++ * gain_modulation_b.Next();
+      const float lp_a = c.LowPass(s_a, &state_1_a, &state_2_a);
+      const float lp_b = c.LowPass(s_b, &state_1_b, &state_2_b);
+      *out_a = stmlib::Clip16(
+          1 + static_cast<int32_t>(lp_a + (s_a - lp_a) * hf_bleed));
+      *out_b = stmlib::Clip16(
+          1 + static_cast<int32_t>(lp_b + (s_b - lp_b) * hf_bleed));
+      out_a += stride;
+      out_b += stride;
+    }
+    lpg_a->state_1_ = state_1_a;
+    lpg_a->state_2_ = state_2_a;
+    lpg_b->state_1_ = state_1_b;
+    lpg_b->state_2_ = state_2_b;
   }
   
  private:
+  // The low-pass output of stmlib::Svf with a resonance of 0.4, on a state
+  // kept in locals by the callers: the output buffers could alias the
+  // members, which would otherwise be written back at every sample.
+  struct Coefficients {
+    explicit Coefficients(float frequency) {
+      g = stmlib::OnePole::tan<stmlib::FREQUENCY_DIRTY>(frequency);
+      r = 1.0f / 0.4f;
+      h = 1.0f / (1.0f + r * g + g * g);
+    }
+    
+    inline float LowPass(float in, float* state_1, float* state_2) const {
+      const float hp = (in - r * *state_1 - g * *state_1 - *state_2) * h;
+      const float bp = g * hp + *state_1;
+      *state_1 = g * hp + bp;
+      const float lp = g * bp + *state_2;
+      *state_2 = g * bp + lp;
+      return lp;
+    }
+    
+    float g;
+    float r;
+    float h;
+  };
+  
+  // Clip16(1 + 0), the sample a silent block renders to.
+  static inline void Silence(short* out, size_t size, size_t stride) {
+    while (size--) {
+      *out = 1;
+      out += stride;
+    }
+  }
+  
   float previous_gain_;
-  stmlib::Svf filter_;
+  float state_1_;
+  float state_2_;
   
   DISALLOW_COPY_AND_ASSIGN(LowPassGate);
 };
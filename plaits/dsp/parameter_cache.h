@@ -0,0 +1,101 @@
+// Copyright 2026 Rubato Audio.
+
+#ifndef PLAITS_DSP_PARAMETER_CACHE_H_
+#define PLAITS_DSP_PARAMETER_CACHE_H_
+
+#include "stmlib/stmlib.h"
+
+namespace plaits {
+
+// Remembers which quantized control values an engine's derived coefficients
+// were last computed from, so Render() can skip the exponentials, table
+// lookups and divides behind them while the knobs rest -- which, outside of
+// CV sweeps, is most blocks. Typical use:
+//
+//   if (cache_.Changed(ParameterCacheNoteKey(parameters.note),
+//                      ParameterCacheKnobKey(parameters.timbre))) {
+//     ... recompute the coefficients into members ...
+//   }
+//
+// Within one key step the coefficients keep the values computed at the last
+// miss. The steps are chosen so that this is not audible: knobs are read by a
+// 12-bit converter, so a finer key would only follow noise, and a note step
+// is the 1/256 semitone resolution of stmlib::SemitonesToRatio, below which
+// NoteToFrequency() does not move anyway. A cache is only worth it for
+// coefficients that are a pure function of the keys; anything that also
+// depends on engine state (smoothers, glides) has to be computed every block.
+
+const float kParameterCacheKnobSteps = 4096.0f;
+const float kParameterCacheNoteSteps = 256.0f;
+
+// For harmonics, timbre, morph, macro, accent: anything in [0, 1].
+inline int32_t ParameterCacheKnobKey(float value) {
+  return static_cast<int32_t>(value * kParameterCacheKnobSteps);
+}
+
+// For MIDI notes in [-128, 128], offset like SemitonesToRatio so that the
+// truncation rounds the same way on both sides of zero.
+inline int32_t ParameterCacheNoteKey(float note) {
+  return static_cast<int32_t>((note + 128.0f) * kParameterCacheNoteSteps);
+}
+
+#if defined(TEST)
+// Host builds only. Every cache of the process counts into the same pair, so
+// a bench resets it, renders one engine, and reads the engine's hit rate.
+struct ParameterCacheCounters {
+  uint32_t hits;
+  uint32_t misses;
+};
+
+inline ParameterCacheCounters* parameter_cache_counters() {
+  static ParameterCacheCounters counters = { 0, 0 };
+  return &counters;
+}
+#endif  // TEST
+
+class ParameterCache {
+ public:
+  ParameterCache() { }
+  ~ParameterCache() { }
+
+  void Init() {
+    Invalidate();
+  }
+
+  // Forces the next Changed() to report a change. Call it from Reset(), and
+  // whenever something other than the keyed inputs alters the coefficients.
+  inline void Invalidate() {
+    valid_ = false;
+  }
+
+  // Up to four keys, unused ones left at 0. Any integer that selects the
+  // coefficients (a chord set option, a stereo flag) can be a key as well.
+  // Returns true, and remembers the keys, when the caller has to recompute.
+  inline bool Changed(int32_t a, int32_t b = 0, int32_t c = 0, int32_t d = 0) {
+    const bool hit = valid_ && \
+        a == key_[0] && b == key_[1] && c == key_[2] && d == key_[3];
+#if defined(TEST)
+    ++(hit ? parameter_cache_counters()->hits
+           : parameter_cache_counters()->misses);
+#endif  // TEST
+    if (hit) {
+      return false;
+    }
+    key_[0] = a;
+    key_[1] = b;
+    key_[2] = c;
+    key_[3] = d;
+    valid_ = true;
+    return true;
+  }
+
+ private:
+  int32_t key_[4];
+  bool valid_;
+
+  DISALLOW_COPY_AND_ASSIGN(ParameterCache);
+};
+
+}  // namespace plaits
+
+#endif  // PLAITS_DSP_PARAMETER_CACHE_H_
@@ -42,6 +42,16 @@ namespace plaits {
 using namespace std;
 using namespace stmlib;
 
+// Number of modes whose coefficients are computed before they are rendered.
+// The vector kernel interleaves all the batches, so it needs every mode at
+// once. The firmware renders each batch as soon as its modes are known, which
+// keeps the coefficient arrays on the interrupt stack at one batch.
+#ifdef PLAITS_RESONATOR_SVF_SIMD
+const int kModesPerBank = kMaxNumModes;
+#else
+const int kModesPerBank = kModeBatchSize;
+#endif  // PLAITS_RESONATOR_SVF_SIMD
+
 void Resonator::Init(float position, int resolution) {
   resolution_ = min(resolution, kMaxNumModes);
   
@@ -89,11 +99,11 @@ void Resonator::Process(
   brightness *= 1.0f - damping * 0.3f;
   float q_loss = brightness * (2.0f - brightness) * 0.85f + 0.15f;
   
-  float mode_q[kModeBatchSize];
-  float mode_f[kModeBatchSize];
-  float mode_a[kModeBatchSize];
-  int batch_counter = 0;
-  ResonatorSvf<kModeBatchSize>* batch_processor = &mode_filters_[0];
+  float mode_q[kModesPerBank];
+  float mode_f[kModesPerBank];
+  float mode_a[kModesPerBank];
+  int mode_counter = 0;
+  ResonatorSvf<kModeBatchSize>* bank = &mode_filters_[0];
   for (int i = 0; i < resolution_; ++i) {
     float mode_frequency = harmonic * stretch_factor;
     if (mode_frequency >= 0.499f) {
@@ -101,21 +111,23 @@ void Resonator::Process(
     }
     const float mode_attenuation = 1.0f - mode_frequency * 2.0f;
     
-    mode_f[batch_counter] = mode_frequency;
-    mode_q[batch_counter] = 1.0f + mode_frequency * q;
-    mode_a[batch_counter] = mode_amplitude_[i] * mode_attenuation;
-    ++batch_counter;
+    mode_f[mode_counter] = mode_frequency;
+    mode_q[mode_counter] = 1.0f + mode_frequency * q;
+    mode_a[mode_counter] = mode_amplitude_[i] * mode_attenuation;
+    ++mode_counter;
     
-    if (batch_counter == kModeBatchSize) {
-      batch_counter = 0;
-      batch_processor->Process<FILTER_MODE_BAND_PASS, true>(
+    if (mode_counter == kModesPerBank) {
+      mode_counter = 0;
+      ResonatorSvf<kModeBatchSize>::ProcessBank<FILTER_MODE_BAND_PASS, true>(
+          bank,
+          kModesPerBank / kModeBatchSize,
           mode_f,
           mode_q,
           mode_a,
           in,
           out,
           size);
-      ++batch_processor;
+      bank += kModesPerBank / kModeBatchSize;
     }
     
     stretch_factor += stiffness;
@@ -129,6 +141,19 @@ void Resonator::Process(
     harmonic += f0;
     q *= q_loss;
   }
+  
+  // Only whole batches are rendered.
+  if (mode_counter >= kModeBatchSize) {
+    ResonatorSvf<kModeBatchSize>::ProcessBank<FILTER_MODE_BAND_PASS, true>(
+        bank,
+        mode_counter / kModeBatchSize,
+        mode_f,
+        mode_q,
+        mode_a,
+        in,
+        out,
+        size);
+  }
 }
 
 void Resonator::ProcessStereo(
@@ -159,12 +184,12 @@ void Resonator::ProcessStereo(
   const float odd_left = even_right;
   const float odd_right = even_left;
 
-  float mode_q[kModeBatchSize];
-  float mode_f[kModeBatchSize];
-  float mode_a_left[kModeBatchSize];
-  float mode_a_right[kModeBatchSize];
-  int batch_counter = 0;
-  ResonatorSvf<kModeBatchSize>* batch_processor = &mode_filters_[0];
+  float mode_q[kModesPerBank];
+  float mode_f[kModesPerBank];
+  float mode_a_left[kModesPerBank];
+  float mode_a_right[kModesPerBank];
+  int mode_counter = 0;
+  ResonatorSvf<kModeBatchSize>* bank = &mode_filters_[0];
   for (int i = 0; i < resolution_; ++i) {
     float mode_frequency = harmonic * stretch_factor;
     if (mode_frequency >= 0.499f) {
@@ -173,24 +198,29 @@ void Resonator::ProcessStereo(
     const float mode_attenuation = 1.0f - mode_frequency * 2.0f;
     const float mode_amplitude = mode_amplitude_[i] * mode_attenuation;
 
-    mode_f[batch_counter] = mode_frequency;
-    mode_q[batch_counter] = 1.0f + mode_frequency * q;
-    mode_a_left[batch_counter] = mode_amplitude * ((i & 1) ? odd_left : even_left);
-    mode_a_right[batch_counter] = mode_amplitude * ((i & 1) ? odd_right : even_right);
-    ++batch_counter;
-
-    if (batch_counter == kModeBatchSize) {
-      batch_counter = 0;
-      batch_processor->ProcessStereo<FILTER_MODE_BAND_PASS, true>(
-          mode_f,
-          mode_q,
-          mode_a_left,
-          mode_a_right,
-          in,
-          left,
-          right,
-          size);
-      ++batch_processor;
+    mode_f[mode_counter] = mode_frequency;
+    mode_q[mode_counter] = 1.0f + mode_frequency * q;
+    mode_a_left[mode_counter] =
+        mode_amplitude * ((i & 1) ? odd_left : even_left);
+    mode_a_right[mode_counter] =
+        mode_amplitude * ((i & 1) ? odd_right : even_right);
+    ++mode_counter;
+
+    if (mode_counter == kModesPerBank) {
+      mode_counter = 0;
+      ResonatorSvf<kModeBatchSize>::ProcessStereoBank<
+          FILTER_MODE_BAND_PASS, true>(
+              bank,
+              kModesPerBank / kModeBatchSize,
+              mode_f,
+              mode_q,
+              mode_a_left,
+              mode_a_right,
+              in,
+              left,
+              right,
+              size);
+      bank += kModesPerBank / kModeBatchSize;
     }
 
     stretch_factor += stiffness;
@@ -204,6 +234,21 @@ void Resonator::ProcessStereo(
     harmonic += f0;
     q *= q_loss;
   }
+
+  if (mode_counter >= kModeBatchSize) {
+    ResonatorSvf<kModeBatchSize>::ProcessStereoBank<
+        FILTER_MODE_BAND_PASS, true>(
+            bank,
+            mode_counter / kModeBatchSize,
+            mode_f,
+            mode_q,
+            mode_a_left,
+            mode_a_right,
+            in,
+            left,
+            right,
+            size);
+  }
 }
 
 }  // namespace plaits
@@ -31,47 +31,111 @@
 
 #include "stmlib/dsp/filter.h"
 
+// Host builds run each batch of 4 modes in one vector register. The firmware
+// (Cortex-M4, no SIMD unit) keeps the scalar kernel, which stays the reference:
+// the vector kernel performs the same operations in the same order, so the two
+// produce identical samples.
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#define PLAITS_RESONATOR_SVF_SIMD
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define PLAITS_RESONATOR_SVF_SIMD
+#endif
+
 namespace plaits {
 
 const int kMaxNumModes = 24;
 const int kModeBatchSize = 4;
 
-// We render 4 modes simultaneously since there are enough registers to hold
-// all state variables.
+inline void ResonatorSvfCoefficients(
+    float f,
+    float q,
+    float* g,
+    float* r_plus_g,
+    float* h) {
+  *g = stmlib::OnePole::tan<stmlib::FREQUENCY_FAST>(f);
+  const float r = 1.0f / q;
+  *h = 1.0f / (1.0f + r * *g + *g * *g);
+  *r_plus_g = r + *g;
+}
+
+// Renders a bank of ResonatorSvf filters, one after the other, each one
+// accumulating into the output. This is the firmware code, and the reference
+// for the vector kernel below.
 template<int batch_size>
-class ResonatorSvf {
- public:
-  ResonatorSvf() { }
-  ~ResonatorSvf() { }
-  
-  void Init() {
-    for (int i = 0; i < batch_size; ++i) {
-      state_1_[i] = state_2_[i] = 0.0f;
+struct ResonatorSvfScalarKernel {
+  template<stmlib::FilterMode mode, bool add, typename Filter>
+  static inline void Process(
+      Filter* bank,
+      int num_batches,
+      const float* f,
+      const float* q,
+      const float* gain,
+      const float* in,
+      float* out,
+      size_t size) {
+    for (int b = 0; b < num_batches; ++b) {
+      const int o = b * batch_size;
+      if (add || b != 0) {
+        ProcessBatch<mode, true>(
+            &f[o], &q[o], &gain[o], bank[b].state_1(), bank[b].state_2(),
+            in, out, size);
+      } else {
+        ProcessBatch<mode, false>(
+            &f[o], &q[o], &gain[o], bank[b].state_1(), bank[b].state_2(),
+            in, out, size);
+      }
     }
   }
-  
+
+  template<stmlib::FilterMode mode, bool add, typename Filter>
+  static inline void ProcessStereo(
+      Filter* bank,
+      int num_batches,
+      const float* f,
+      const float* q,
+      const float* left_gain,
+      const float* right_gain,
+      const float* in,
+      float* left,
+      float* right,
+      size_t size) {
+    for (int b = 0; b < num_batches; ++b) {
+      const int o = b * batch_size;
+      if (add || b != 0) {
+        ProcessStereoBatch<mode, true>(
+            &f[o], &q[o], &left_gain[o], &right_gain[o],
+            bank[b].state_1(), bank[b].state_2(), in, left, right, size);
+      } else {
+        ProcessStereoBatch<mode, false>(
+            &f[o], &q[o], &left_gain[o], &right_gain[o],
+            bank[b].state_1(), bank[b].state_2(), in, left, right, size);
+      }
+    }
+  }
+
+ private:
   template<stmlib::FilterMode mode, bool add>
-  void Process(
+  static inline void ProcessBatch(
       const float* f,
       const float* q,
       const float* gain,
+      float* state_1_ptr,
+      float* state_2_ptr,
       const float* in,
       float* out,
       size_t size) {
     float g[batch_size];
-    float r[batch_size];
     float r_plus_g[batch_size];
     float h[batch_size];
     float state_1[batch_size];
     float state_2[batch_size];
     float gains[batch_size];
     for (int i = 0; i < batch_size; ++i) {
-      g[i] = stmlib::OnePole::tan<stmlib::FREQUENCY_FAST>(f[i]);
-      r[i] = 1.0f / q[i];
-      h[i] = 1.0f / (1.0f + r[i] * g[i] + g[i] * g[i]);
-      r_plus_g[i] = r[i] + g[i];
-      state_1[i] = state_1_[i];
-      state_2[i] = state_2_[i];
+      ResonatorSvfCoefficients(f[i], q[i], &g[i], &r_plus_g[i], &h[i]);
+      state_1[i] = state_1_ptr[i];
+      state_2[i] = state_2_ptr[i];
       gains[i] = gain[i];
     }
     
@@ -93,25 +157,24 @@ class ResonatorSvf {
       }
     }
     for (int i = 0; i < batch_size; ++i) {
-      state_1_[i] = state_1[i];
-      state_2_[i] = state_2[i];
+      state_1_ptr[i] = state_1[i];
+      state_2_ptr[i] = state_2[i];
     }
   }
 
-  // Same filter bank, but each mode is multiply-accumulated into two output
-  // buffers with its own pair of gains.
   template<stmlib::FilterMode mode, bool add>
-  void ProcessStereo(
+  static inline void ProcessStereoBatch(
       const float* f,
       const float* q,
       const float* left_gain,
       const float* right_gain,
+      float* state_1_ptr,
+      float* state_2_ptr,
       const float* in,
       float* left,
       float* right,
       size_t size) {
     float g[batch_size];
-    float r[batch_size];
     float r_plus_g[batch_size];
     float h[batch_size];
     float state_1[batch_size];
@@ -119,12 +182,9 @@ class ResonatorSvf {
     float left_gains[batch_size];
     float right_gains[batch_size];
     for (int i = 0; i < batch_size; ++i) {
-      g[i] = stmlib::OnePole::tan<stmlib::FREQUENCY_FAST>(f[i]);
-      r[i] = 1.0f / q[i];
-      h[i] = 1.0f / (1.0f + r[i] * g[i] + g[i] * g[i]);
-      r_plus_g[i] = r[i] + g[i];
-      state_1[i] = state_1_[i];
-      state_2[i] = state_2_[i];
+      ResonatorSvfCoefficients(f[i], q[i], &g[i], &r_plus_g[i], &h[i]);
+      state_1[i] = state_1_ptr[i];
+      state_2[i] = state_2_ptr[i];
       left_gains[i] = left_gain[i];
       right_gains[i] = right_gain[i];
     }
@@ -152,11 +212,328 @@ class ResonatorSvf {
       }
     }
     for (int i = 0; i < batch_size; ++i) {
-      state_1_[i] = state_1[i];
-      state_2_[i] = state_2[i];
+      state_1_ptr[i] = state_1[i];
+      state_2_ptr[i] = state_2[i];
+    }
+  }
+};
+
+#ifdef PLAITS_RESONATOR_SVF_SIMD
+
+// Four modes per register, and up to kMaxBatches filters advanced together
+// sample by sample: a single filter is bound by the latency of its state
+// update, while independent ones keep the vector unit busy. Each sample still
+// receives the filters in order, and within a filter the weighted modes are
+// summed lane 0 to lane 3 like the scalar loop does, so the output is
+// bit-exact.
+struct ResonatorSvfVectorKernel {
+  static const int kMaxBatches = 8;
+
+#if defined(__SSE2__)
+  typedef __m128 Lanes;
+  static inline Lanes Load(const float* p) { return _mm_loadu_ps(p); }
+  static inline void Store(float* p, Lanes x) { _mm_storeu_ps(p, x); }
+  static inline Lanes Splat(float x) { return _mm_set1_ps(x); }
+  static inline Lanes Add(Lanes a, Lanes b) { return _mm_add_ps(a, b); }
+  static inline Lanes Sub(Lanes a, Lanes b) { return _mm_sub_ps(a, b); }
+  static inline Lanes Mul(Lanes a, Lanes b) { return _mm_mul_ps(a, b); }
+  static inline float Sum(Lanes x) {
+    Lanes s = _mm_add_ss(x, _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 1, 1, 1)));
+    s = _mm_add_ss(s, _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 2, 2, 2)));
+    s = _mm_add_ss(s, _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3)));
+    return _mm_cvtss_f32(s);
+  }
+  // Per-register sums of four registers, each still added lane 0 to lane 3.
+  static inline void Sum4(Lanes a, Lanes b, Lanes c, Lanes d, float* sums) {
+    _MM_TRANSPOSE4_PS(a, b, c, d);
+    _mm_storeu_ps(sums, _mm_add_ps(_mm_add_ps(_mm_add_ps(a, b), c), d));
+  }
+#else
+  typedef float32x4_t Lanes;
+  static inline Lanes Load(const float* p) { return vld1q_f32(p); }
+  static inline void Store(float* p, Lanes x) { vst1q_f32(p, x); }
+  static inline Lanes Splat(float x) { return vdupq_n_f32(x); }
+  static inline Lanes Add(Lanes a, Lanes b) { return vaddq_f32(a, b); }
+  static inline Lanes Sub(Lanes a, Lanes b) { return vsubq_f32(a, b); }
+  static inline Lanes Mul(Lanes a, Lanes b) { return vmulq_f32(a, b); }
+  static inline float Sum(Lanes x) {
+    float s = vgetq_lane_f32(x, 0) + vgetq_lane_f32(x, 1);
+    s += vgetq_lane_f32(x, 2);
+    return s + vgetq_lane_f32(x, 3);
+  }
+  static inline void Sum4(Lanes a, Lanes b, Lanes c, Lanes d, float* sums) {
+    const float32x4x2_t ab = vtrnq_f32(a, b);
+    const float32x4x2_t cd = vtrnq_f32(c, d);
+    const Lanes lane_0 = vcombine_f32(
+        vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+    const Lanes lane_1 = vcombine_f32(
+        vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+    const Lanes lane_2 = vcombine_f32(
+        vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+    const Lanes lane_3 = vcombine_f32(
+        vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+    vst1q_f32(sums, vaddq_f32(vaddq_f32(vaddq_f32(lane_0, lane_1), lane_2),
+                              lane_3));
+  }
+#endif  // __SSE2__
+
+  // Sums of the n registers of x, four at a time where possible.
+  static inline void SumEach(const Lanes* x, int n, float* sums) {
+    int b = 0;
+    for (; b + 4 <= n; b += 4) {
+      Sum4(x[b], x[b + 1], x[b + 2], x[b + 3], &sums[b]);
+    }
+    for (; b < n; ++b) {
+      sums[b] = Sum(x[b]);
+    }
+  }
+
+  struct Batch {
+    Lanes g;
+    Lanes r_plus_g;
+    Lanes h;
+    Lanes state_1;
+    Lanes state_2;
+  };
+
+  template<typename Filter>
+  static inline void LoadBatch(Filter* filter, const float* f, const float* q,
+                               Batch* batch) {
+    float g[4];
+    float r_plus_g[4];
+    float h[4];
+    for (int i = 0; i < 4; ++i) {
+      ResonatorSvfCoefficients(f[i], q[i], &g[i], &r_plus_g[i], &h[i]);
+    }
+    batch->g = Load(g);
+    batch->r_plus_g = Load(r_plus_g);
+    batch->h = Load(h);
+    batch->state_1 = Load(filter->state_1());
+    batch->state_2 = Load(filter->state_2());
+  }
+
+  template<typename Filter>
+  static inline void StoreBatch(Filter* filter, const Batch& batch) {
+    Store(filter->state_1(), batch.state_1);
+    Store(filter->state_2(), batch.state_2);
+  }
+
+  template<stmlib::FilterMode mode>
+  static inline Lanes Tick(Lanes s_in, Batch* b) {
+    const Lanes hp = Mul(
+        Sub(Sub(s_in, Mul(b->r_plus_g, b->state_1)), b->state_2), b->h);
+    const Lanes g_hp = Mul(b->g, hp);
+    const Lanes bp = Add(g_hp, b->state_1);
+    b->state_1 = Add(g_hp, bp);
+    const Lanes g_bp = Mul(b->g, bp);
+    const Lanes lp = Add(g_bp, b->state_2);
+    b->state_2 = Add(g_bp, lp);
+    return (mode == stmlib::FILTER_MODE_LOW_PASS) ? lp : bp;
+  }
+
+  template<stmlib::FilterMode mode, bool add, typename Filter>
+  static inline void Process(
+      Filter* bank,
+      int num_batches,
+      const float* f,
+      const float* q,
+      const float* gain,
+      const float* in,
+      float* out,
+      size_t size) {
+    if (num_batches == 1) {
+      // Nothing to interleave.
+      ResonatorSvfScalarKernel<4>::Process<mode, add>(
+          bank, 1, f, q, gain, in, out, size);
+      return;
+    }
+    for (int first = 0; first < num_batches; first += kMaxBatches) {
+      const int n = num_batches - first < kMaxBatches
+          ? num_batches - first
+          : kMaxBatches;
+      Batch batch[kMaxBatches];
+      Lanes gains[kMaxBatches];
+      for (int b = 0; b < n; ++b) {
+        const int o = (first + b) * 4;
+        LoadBatch(&bank[first + b], &f[o], &q[o], &batch[b]);
+        gains[b] = Load(&gain[o]);
+      }
+      const bool accumulate = add || first != 0;
+      for (size_t i = 0; i < size; ++i) {
+        const Lanes s_in = Splat(in[i]);
+        Lanes weighted[kMaxBatches];
+        for (int b = 0; b < n; ++b) {
+          weighted[b] = Mul(gains[b], Tick<mode>(s_in, &batch[b]));
+        }
+        float s[kMaxBatches];
+        SumEach(weighted, n, s);
+        float s_out = accumulate ? out[i] + s[0] : s[0];
+        for (int b = 1; b < n; ++b) {
+          s_out += s[b];
+        }
+        out[i] = s_out;
+      }
+      for (int b = 0; b < n; ++b) {
+        StoreBatch(&bank[first + b], batch[b]);
+      }
     }
   }
 
+  template<stmlib::FilterMode mode, bool add, typename Filter>
+  static inline void ProcessStereo(
+      Filter* bank,
+      int num_batches,
+      const float* f,
+      const float* q,
+      const float* left_gain,
+      const float* right_gain,
+      const float* in,
+      float* left,
+      float* right,
+      size_t size) {
+    if (num_batches == 1) {
+      ResonatorSvfScalarKernel<4>::ProcessStereo<mode, add>(
+          bank, 1, f, q, left_gain, right_gain, in, left, right, size);
+      return;
+    }
+    for (int first = 0; first < num_batches; first += kMaxBatches) {
+      const int n = num_batches - first < kMaxBatches
+          ? num_batches - first
+          : kMaxBatches;
+      Batch batch[kMaxBatches];
+      Lanes left_gains[kMaxBatches];
+      Lanes right_gains[kMaxBatches];
+      for (int b = 0; b < n; ++b) {
+        const int o = (first + b) * 4;
+        LoadBatch(&bank[first + b], &f[o], &q[o], &batch[b]);
+        left_gains[b] = Load(&left_gain[o]);
+        right_gains[b] = Load(&right_gain[o]);
+      }
+      const bool accumulate = add || first != 0;
+      for (size_t i = 0; i < size; ++i) {
+        const Lanes s_in = Splat(in[i]);
+        Lanes weighted_left[kMaxBatches];
+        Lanes weighted_right[kMaxBatches];
+        for (int b = 0; b < n; ++b) {
+          const Lanes s = Tick<mode>(s_in, &batch[b]);
+          weighted_left[b] = Mul(left_gains[b], s);
+          weighted_right[b] = Mul(right_gains[b], s);
+        }
+        float l[kMaxBatches];
+        float r[kMaxBatches];
+        SumEach(weighted_left, n, l);
+        SumEach(weighted_right, n, r);
+        float s_left = accumulate ? left[i] + l[0] : l[0];
+        float s_right = accumulate ? right[i] + r[0] : r[0];
+        for (int b = 1; b < n; ++b) {
+          s_left += l[b];
+          s_right += r[b];
+        }
+        left[i] = s_left;
+        right[i] = s_right;
+      }
+      for (int b = 0; b < n; ++b) {
+        StoreBatch(&bank[first + b], batch[b]);
+      }
+    }
+  }
+};
+
+#endif  // PLAITS_RESONATOR_SVF_SIMD
+
+template<int batch_size>
+struct ResonatorSvfDefaultKernel {
+  typedef ResonatorSvfScalarKernel<batch_size> Type;
+};
+
+#ifdef PLAITS_RESONATOR_SVF_SIMD
+template<>
+struct ResonatorSvfDefaultKernel<4> {
+  typedef ResonatorSvfVectorKernel Type;
+};
+#endif  // PLAITS_RESONATOR_SVF_SIMD
+
+// We render 4 modes simultaneously since there are enough registers to hold
+// all state variables. The Kernel argument only exists so that the bench can
+// time the scalar reference against the vector kernel in the same binary.
+template<
+    int batch_size,
+    typename Kernel = typename ResonatorSvfDefaultKernel<batch_size>::Type>
+class ResonatorSvf {
+ public:
+  ResonatorSvf() { }
+  ~ResonatorSvf() { }
+  
+  void Init() {
+    for (int i = 0; i < batch_size; ++i) {
+      state_1_[i] = state_2_[i] = 0.0f;
+    }
+  }
+  
+  template<stmlib::FilterMode mode, bool add>
+  void Process(
+      const float* f,
+      const float* q,
+      const float* gain,
+      const float* in,
+      float* out,
+      size_t size) {
+    Kernel::template Process<mode, add>(this, 1, f, q, gain, in, out, size);
+  }
+
+  // Same filter bank, but each mode is multiply-accumulated into two output
+  // buffers with its own pair of gains.
+  template<stmlib::FilterMode mode, bool add>
+  void ProcessStereo(
+      const float* f,
+      const float* q,
+      const float* left_gain,
+      const float* right_gain,
+      const float* in,
+      float* left,
+      float* right,
+      size_t size) {
+    Kernel::template ProcessStereo<mode, add>(
+        this, 1, f, q, left_gain, right_gain, in, left, right, size);
+  }
+
+  // Renders num_batches consecutive filters, f, q and the gains holding
+  // batch_size modes per filter. Same result as calling Process on each
+  // filter in turn, but lets the vector kernel interleave them.
+  template<stmlib::FilterMode mode, bool add>
+  static void ProcessBank(
+      ResonatorSvf* bank,
+      int num_batches,
+      const float* f,
+      const float* q,
+      const float* gain,
+      const float* in,
+      float* out,
+      size_t size) {
+    Kernel::template Process<mode, add>(
+        bank, num_batches, f, q, gain, in, out, size);
+  }
+
+  template<stmlib::FilterMode mode, bool add>
+  static void ProcessStereoBank(
+      ResonatorSvf* bank,
+      int num_batches,
+      const float* f,
+      const float* q,
+      const float* left_gain,
+      const float* right_gain,
+      const float* in,
+      float* left,
+      float* right,
+      size_t size) {
+    Kernel::template ProcessStereo<mode, add>(
+        bank, num_batches, f, q, left_gain, right_gain, in, left, right, size);
+  }
+
+  // For the kernels.
+  inline float* state_1() { return state_1_; }
+  inline float* state_2() { return state_2_; }
+
  private:
   float state_1_[batch_size];
   float state_2_[batch_size];
@@ -110,6 +110,18 @@ const int8_t LPCSpeechSynthWordBank::k9_lut_[8] = {
   -51, -33, -15, 4, 22, 32, 59, 77
 };
 
+#if PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+void LPCSpeechSynthWordBank::Init(
+    const LPCSpeechSynthRawWordBankData* word_banks,
+    int num_banks,
+    BufferAllocator* allocator) {
+  word_banks_ = word_banks;
+  num_banks_ = num_banks;
+  frames_ = NULL;
+  word_boundaries_ = NULL;
+  Reset();
+}
+#else
 void LPCSpeechSynthWordBank::Init(
     const LPCSpeechSynthWordBankData* word_banks,
     int num_banks,
@@ -126,6 +138,7 @@ void LPCSpeechSynthWordBank::Init(
   Reset();
 #endif
 }
+#endif  // PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
 
 #if PLAITS_HAS_CUSTOM_SPEECH_BANKS
 void LPCSpeechSynthWordBank::Init(
@@ -150,6 +163,12 @@ void LPCSpeechSynthWordBank::Reset() {
   loaded_bank_ = -1;
   num_frames_ = 0;
   num_words_ = 0;
+#if !PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+  loading_ = false;
+#endif
+#if PLAITS_HAS_CUSTOM_SPEECH_BANKS
+  raw_word_bank_ = NULL;
+#endif
   // GetWordBoundaries() does not read the array while num_words_ is zero, and
   // Load() overwrites every live boundary before publishing a non-zero count.
 }
@@ -171,62 +190,101 @@ int RecipeSpeechWordBankCount() {
 }
 #endif
 
-size_t LPCSpeechSynthWordBank::LoadNextWord(const uint8_t* data) {
+/* static */
+void LPCSpeechSynthWordBank::ClearFrame(LPCSpeechSynth::Frame* frame) {
+  frame->energy = 0;
+  frame->period = 0;
+  frame->k0 = 0;
+  frame->k1 = 0;
+  frame->k2 = 0;
+  frame->k3 = 0;
+  frame->k4 = 0;
+  frame->k5 = 0;
+  frame->k6 = 0;
+  frame->k7 = 0;
+  frame->k8 = 0;
+  frame->k9 = 0;
+}
+
+/* static */
+bool LPCSpeechSynthWordBank::DecodeFrame(
+    BitStream* bitstream,
+    LPCSpeechSynth::Frame* frame) {
+  int energy = bitstream->GetBits(4);
+  if (energy == 0) {
+    frame->energy = 0;
+  } else if (energy == 0xf) {
+    bitstream->Flush();
+    return false;
+  } else {
+    frame->energy = energy_lut_[energy];
+    bool repeat = bitstream->GetBits(1);
+    frame->period = period_lut_[bitstream->GetBits(6)];
+    if (!repeat) {
+      frame->k0 = k0_lut_[bitstream->GetBits(5)];
+      frame->k1 = k1_lut_[bitstream->GetBits(5)];
+      frame->k2 = k2_lut_[bitstream->GetBits(4)];
+      frame->k3 = k3_lut_[bitstream->GetBits(4)];
+      if (frame->period) {
+        frame->k4 = k4_lut_[bitstream->GetBits(4)];
+        frame->k5 = k5_lut_[bitstream->GetBits(4)];
+        frame->k6 = k6_lut_[bitstream->GetBits(4)];
+        frame->k7 = k7_lut_[bitstream->GetBits(3)];
+        frame->k8 = k8_lut_[bitstream->GetBits(3)];
+        frame->k9 = k9_lut_[bitstream->GetBits(3)];
+      }
+    }
+  }
+  return true;
+}
+
+/* static */
+size_t LPCSpeechSynthWordBank::DecodeWord(
+    const uint8_t* data,
+    LPCSpeechSynth::Frame* frames,
+    int* num_frames) {
   BitStream bitstream;
   bitstream.Init(data);
 
   LPCSpeechSynth::Frame frame;
-  frame.energy = 0;
-  frame.period = 0;
-  frame.k0 = 0;
-  frame.k1 = 0;
-  frame.k2 = 0;
-  frame.k3 = 0;
-  frame.k4 = 0;
-  frame.k5 = 0;
-  frame.k6 = 0;
-  frame.k7 = 0;
-  frame.k8 = 0;
-  frame.k9 = 0;
-
-  while (true) {
-    int energy = bitstream.GetBits(4);
-    if (energy == 0) {
-      frame.energy = 0;
-    } else if (energy == 0xf) {
-      bitstream.Flush();
-      break;
-    } else {
-      frame.energy = energy_lut_[energy];
-      bool repeat = bitstream.GetBits(1);
-      frame.period = period_lut_[bitstream.GetBits(6)];
-      if (!repeat) {
-        frame.k0 = k0_lut_[bitstream.GetBits(5)];
-        frame.k1 = k1_lut_[bitstream.GetBits(5)];
-        frame.k2 = k2_lut_[bitstream.GetBits(4)];
-        frame.k3 = k3_lut_[bitstream.GetBits(4)];
-        if (frame.period) {
-          frame.k4 = k4_lut_[bitstream.GetBits(4)];
-          frame.k5 = k5_lut_[bitstream.GetBits(4)];
-          frame.k6 = k6_lut_[bitstream.GetBits(4)];
-          frame.k7 = k7_lut_[bitstream.GetBits(3)];
-          frame.k8 = k8_lut_[bitstream.GetBits(3)];
-          frame.k9 = k9_lut_[bitstream.GetBits(3)];
-        }
-      }
-    }
-    frames_[num_frames_++] = frame;
+  ClearFrame(&frame);
+  while (DecodeFrame(&bitstream, &frame)) {
+    frames[(*num_frames)++] = frame;
   }
   return bitstream.ptr() - data;
 }
 
-bool LPCSpeechSynthWordBank::Load(int bank) {
+/* static */
+int LPCSpeechSynthWordBank::Decode(
+    const LPCSpeechSynthWordBankData& bank,
+    LPCSpeechSynth::Frame* frames,
+    int* word_boundaries,
+    int* num_words) {
+  const uint8_t* data = bank.data;
+  size_t size = bank.size;
+  int num_frames = 0;
+  *num_words = 0;
+  
+  while (size) {
+    word_boundaries[*num_words] = num_frames;
+    size_t consumed = DecodeWord(data, frames, &num_frames);
+
+    data += consumed;
+    size -= consumed;
+    ++(*num_words);
+  }
+  word_boundaries[*num_words] = num_frames;
+  return num_frames;
+}
+
+bool LPCSpeechSynthWordBank::Load(int bank, int max_frames) {
 #if PLAITS_HAS_CUSTOM_SPEECH_BANKS
   if (bank == loaded_bank_ || bank < 0 ||
       bank >= num_banks_ + num_raw_word_banks_) {
 #else
   if (bank == loaded_bank_ || bank >= num_banks_) {
 #endif
+    LoadFrames(max_frames);
     return false;
   }
 
@@ -234,43 +292,71 @@ bool LPCSpeechSynthWordBank::Load(int bank) {
   num_words_ = 0;
 
 #if PLAITS_HAS_CUSTOM_SPEECH_BANKS
+  raw_word_bank_ = NULL;
+  loading_ = false;
   if (bank >= num_banks_) {
     const LPCSpeechSynthRawWordBankData& raw = raw_word_banks_[bank - num_banks_];
     if (raw.num_words > kLPCSpeechSynthMaxWords ||
         raw.num_frames > kLPCSpeechSynthMaxFrames) {
       return false;
     }
-    num_frames_ = raw.num_frames;
     num_words_ = raw.num_words;
-    copy(raw.frames, raw.frames + num_frames_, frames_);
-    for (int i = 0; i < num_frames_; ++i) {
-      frames_[i].energy = MatchCustomSpeechBankEnergy(frames_[i].energy);
-    }
     copy(
         raw.word_boundaries,
         raw.word_boundaries + num_words_ + 1,
         word_boundaries_);
+    raw_word_bank_ = &raw;
+    loading_ = raw.num_frames != 0;
     loaded_bank_ = bank;
+    LoadFrames(max_frames);
     return true;
   }
 #endif
-  
-  const uint8_t* data = word_banks_[bank].data;
-  size_t size = word_banks_[bank].size;
-  
-  while (size) {
-    word_boundaries_[num_words_] = num_frames_;
-    size_t consumed = LoadNextWord(data);
 
-    data += consumed;
-    size -= consumed;
-    ++num_words_;
-  }
-  word_boundaries_[num_words_] = num_frames_;
+#if PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+  frames_ = word_banks_[bank].frames;
+  word_boundaries_ = word_banks_[bank].word_boundaries;
+  num_frames_ = word_banks_[bank].num_frames;
+  num_words_ = word_banks_[bank].num_words;
+#else
+  bitstream_.Init(word_banks_[bank].data);
+  end_ = word_banks_[bank].data + word_banks_[bank].size;
+  ClearFrame(&frame_);
+  word_boundaries_[0] = 0;
+  loading_ = word_banks_[bank].size != 0;
+  LoadFrames(max_frames);
+#endif  // PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
   loaded_bank_ = bank;
   return true;
 }
 
+void LPCSpeechSynthWordBank::LoadFrames(int max_frames) {
+#if !PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+#if PLAITS_HAS_CUSTOM_SPEECH_BANKS
+  if (raw_word_bank_) {
+    while (loading_ && max_frames--) {
+      LPCSpeechSynth::Frame frame = raw_word_bank_->frames[num_frames_];
+      frame.energy = MatchCustomSpeechBankEnergy(frame.energy);
+      frames_[num_frames_++] = frame;
+      loading_ = num_frames_ < raw_word_bank_->num_frames;
+    }
+    return;
+  }
+#endif  // PLAITS_HAS_CUSTOM_SPEECH_BANKS
+  while (loading_ && max_frames--) {
+    if (DecodeFrame(&bitstream_, &frame_)) {
+      frames_[num_frames_++] = frame_;
+    } else {
+      // Words start on a byte boundary, each with a cleared frame.
+      word_boundaries_[++num_words_] = num_frames_;
+      bitstream_.Init(bitstream_.ptr());
+      ClearFrame(&frame_);
+      loading_ = bitstream_.ptr() < end_;
+    }
+  }
+#endif  // !PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+}
+
 void LPCSpeechSynthController::Init(LPCSpeechSynthWordBank* word_bank) {
   word_bank_ = word_bank;
   
@@ -278,6 +364,7 @@ void LPCSpeechSynthController::Init(LPCSpeechSynthWordBank* word_bank) {
   playback_frame_ = -1;
   last_playback_frame_ = -1;
   remaining_frame_samples_ = 0;
+  trigger_pending_ = false;
 
   fill(&sample_[0], &sample_[2], 0.0f);
   fill(&next_sample_[0], &next_sample_[2], 0.0f);
@@ -311,11 +398,24 @@ void LPCSpeechSynthController::Render(
             : (formant_shift > 0.6f ? (formant_shift - 0.6f) * -45.0f : 0.0f)));
   
   if (bank != -1) {
-    bool reset_everything = word_bank_->Load(bank);
+    bool reset_everything = word_bank_->Load(
+        bank,
+        kLPCSpeechSynthLoadFramesPerBlock);
     if (reset_everything) {
       playback_frame_ = -1;
       last_playback_frame_ = -1;
     }
+    if (word_bank_->loading()) {
+      // Until the bank is complete, the synth keeps its current frame and a
+      // trigger waits.
+      trigger_pending_ = trigger_pending_ || trigger;
+      trigger = false;
+    } else {
+      trigger = trigger || trigger_pending_;
+      trigger_pending_ = false;
+    }
+  } else {
+    trigger_pending_ = false;
   }
   
   const int num_frames = bank == -1
@@ -343,7 +443,9 @@ void LPCSpeechSynthController::Render(
     remaining_frame_samples_ = 0;
   }
   
-  if (playback_frame_ == -1 && remaining_frame_samples_ == 0) {
+  if (bank != -1 && word_bank_->loading()) {
+    // Nothing to play yet.
+  } else if (playback_frame_ == -1 && remaining_frame_samples_ == 0) {
     synth_.PlayFrame(
         frames,
         address * (static_cast<float>(num_frames) - 1.0001f),
@@ -39,6 +39,14 @@ namespace plaits {
 #define PLAITS_HAS_CUSTOM_SPEECH_BANKS 0
 #endif
 
+#ifndef PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+#define PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS 0
+#endif
+
+#if PLAITS_HAS_CUSTOM_SPEECH_BANKS && PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+#error "Recipe speech banks select their stock banks as TI bitstreams"
+#endif
+
 class BitStream {
  public:
   BitStream() { }
@@ -97,6 +105,10 @@ const int kLPCSpeechSynthNumPhonemes = \
     kLPCSpeechSynthNumVowels + kLPCSpeechSynthNumConsonants;
 const float kLPCSpeechSynthFPS = 40.0f;
 
+// Frames of a newly selected bank decoded per block: the largest stock bank
+// (926 frames, 22 words) is complete 30 blocks, 7.5 ms, after the change.
+const int kLPCSpeechSynthLoadFramesPerBlock = 32;
+
 // The custom-bank analyzer was calibrated at one fifth of the shipped TI
 // banks' level. Match decoded custom frames to the stock energy range while
 // preserving silence and capping at the highest playable stock energy (0xa1;
@@ -111,27 +123,36 @@ struct LPCSpeechSynthWordBankData {
   size_t size;
 };
 
-#if PLAITS_HAS_CUSTOM_SPEECH_BANKS
-// Custom banks already contain decoded LPC frames. Keeping them in this form
-// avoids forcing newly analysed speech through the legacy TI bitstream format;
-// the selected bank is copied into the controller's existing working buffer.
+// A word bank as decoded LPC frames. Custom banks already come in this form,
+// which avoids forcing newly analysed speech through the legacy TI bitstream
+// format; the selected bank is copied into the controller's existing working
+// buffer. The five stock banks are also available in this form
+// (decoded_word_banks_), in which case they are played straight from flash.
 struct LPCSpeechSynthRawWordBankData {
   const LPCSpeechSynth::Frame* frames;
   const uint16_t* word_boundaries;
   uint16_t num_frames;
   uint8_t num_words;
 };
-#endif
 
 class LPCSpeechSynthWordBank {
  public:
   LPCSpeechSynthWordBank() { }
   ~LPCSpeechSynthWordBank() { }
 
+#if PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+  // Loading a bank only points at its frames: there is nothing to decode and
+  // no working buffer to allocate.
+  void Init(
+      const LPCSpeechSynthRawWordBankData* word_banks,
+      int num_banks,
+      stmlib::BufferAllocator* allocator);
+#else
   void Init(
       const LPCSpeechSynthWordBankData* word_banks,
       int num_banks,
       stmlib::BufferAllocator* allocator);
+#endif
 #if PLAITS_HAS_CUSTOM_SPEECH_BANKS
   void Init(
       const LPCSpeechSynthWordBankData* word_banks,
@@ -141,12 +162,36 @@ class LPCSpeechSynthWordBank {
       stmlib::BufferAllocator* allocator);
 #endif
   
-  bool Load(int index);
+  // Loads the whole bank at once.
+  inline bool Load(int index) {
+    return Load(index, kLPCSpeechSynthMaxFrames + kLPCSpeechSynthMaxWords);
+  }
+
+  // Starts loading bank index if it is not the current one, then decodes at
+  // most max_frames more of its frames (a word's end marker counts as one).
+  // Called once per block, this bounds the decoding work of each block; the
+  // frames and word boundaries are not to be played before loading() is
+  // false. Returns true when a new bank has been started.
+  bool Load(int index, int max_frames);
   void Reset();
   
+#if PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+  inline bool loading() const { return false; }
+#else
+  inline bool loading() const { return loading_; }
+#endif
   inline int num_frames() const { return num_frames_; }
   inline const LPCSpeechSynth::Frame* frames() const { return frames_; }
   
+  // Decodes a TI bitstream bank into frames and word boundaries; the buffers
+  // must have room for the whole bank. Returns the number of frames and writes
+  // the number of words to num_words.
+  static int Decode(
+      const LPCSpeechSynthWordBankData& bank,
+      LPCSpeechSynth::Frame* frames,
+      int* word_boundaries,
+      int* num_words);
+
   inline void GetWordBoundaries(float address, int* start, int* end) {
     if (num_words_ == 0) {
       *start = *end = -1;
@@ -161,9 +206,20 @@ class LPCSpeechSynthWordBank {
   }
   
  private:
-  size_t LoadNextWord(const uint8_t* data);
+  void LoadFrames(int max_frames);
+
+  static void ClearFrame(LPCSpeechSynth::Frame* frame);
+  static bool DecodeFrame(BitStream* bitstream, LPCSpeechSynth::Frame* frame);
+  static size_t DecodeWord(
+      const uint8_t* data,
+      LPCSpeechSynth::Frame* frames,
+      int* num_frames);
   
+#if PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+  const LPCSpeechSynthRawWordBankData* word_banks_;
+#else
   const LPCSpeechSynthWordBankData* word_banks_;
+#endif
 #if PLAITS_HAS_CUSTOM_SPEECH_BANKS
   const LPCSpeechSynthRawWordBankData* raw_word_banks_;
 #endif
@@ -176,8 +232,22 @@ class LPCSpeechSynthWordBank {
   int num_frames_;
   int num_words_;
 
+#if PLAITS_HAS_DECODED_STOCK_SPEECH_BANKS
+  const uint16_t* word_boundaries_;
+  const LPCSpeechSynth::Frame* frames_;
+#else
   int* word_boundaries_;
   LPCSpeechSynth::Frame* frames_;
+
+  // Where the bank being loaded stands.
+  bool loading_;
+  BitStream bitstream_;
+  const uint8_t* end_;
+  LPCSpeechSynth::Frame frame_;
+#endif
+#if PLAITS_HAS_CUSTOM_SPEECH_BANKS
+  const LPCSpeechSynthRawWordBankData* raw_word_bank_;
+#endif
   
   static const uint8_t energy_lut_[16];
   static const uint8_t period_lut_[64];
@@ -235,6 +305,7 @@ class LPCSpeechSynthController {
   int playback_frame_;
   int last_playback_frame_;
   size_t remaining_frame_samples_;
+  bool trigger_pending_;
 
   LPCSpeechSynthWordBank* word_bank_;
   
@@ -0,0 +1,2689 @@
+// Copyright 2016 Emilie Gillet.
+//
+// Author: Emilie Gillet (emilie.o.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// The LPC10 words of lpc_speech_synth_words.cc, decoded.
+//
+// Automatically generated with:
+// make decoded-speech-banks
+
+#include "plaits/dsp/speech/lpc_speech_synth_words.h"
+
+namespace plaits {
+
+static const LPCSpeechSynth::Frame bank_0_frames[] = {
+  // Word 0
+  { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+  { 81, 71, -28480, 22656, -70, 15, 11, 25, -5, 31, 16, 22 },
+  { 161, 73, -24256, 22656, -83, 29, 11, 47, -5, 55, 37, 22 },
+  { 161, 73, -18368, 24000, -70, 29, -1, 25, -5, 79, -4, 4 },
+  { 161, 71, -14528, 21248, -56, 29, -1, 36, -5, 79, -4, 4 },
+  { 161, 69, -14528, 22656, -56, 43, -24, 36, 31, 55, -44, 32 },
+  { 161, 66, -10048, 19648, -56, 57, -12, 25, 55, 31, -44, 32 },
+  { 161, 66, -18368, 15936, -56, 57, 23, 25, 67, 7, -44, 32 },
+  { 161, 69, -18368, 11584, -43, 29, 34, 14, 55, 31, -44, 32 },
+  { 161, 71, -18368, 15936, -43, 29, 34, 3, 55, 7, -44, 32 },
+  { 161, 71, -18368, 13824, -29, 29, 34, 3, 55, 7, -44, 32 },
+  { 161, 77, -18368, 15936, -29, 15, 34, 36, 55, 7, -24, 32 },
+  { 161, 85, -21632, 15936, -43, 43, 23, 25, 55, -16, -24, 32 },
+  { 161, 87, -21632, 13824, -29, 15, 46, 36, 31, 7, -44, 22 },
+  { 161, 87, -14528, 4160, -16, 1, 34, 25, 43, 55, -44, 4 },
+  { 161, 95, -10048, 13824, -56, 15, -1, 25, 67, 31, -4, 22 },
+  { 161, 99, -5184, 17856, -56, 15, -12, -9, 55, 31, -24, 22 },
+  { 161, 99, 0, 11584, -56, -12, 11, -20, 43, 79, -24, 32 },
+  { 0, 99, 0, 11584, -56, -12, 11, -20, 43, 79, -24, 32 },
+  { 0, 99, 0, 11584, -56, -12, 11, -20, 43, 79, -24, 32 },
+  { 81, 102, 5184, -8768, -2, -12, -12, 25, -5, 31, -4, 22 },
+  { 57, 102, -10048, 4160, -56, -40, 23, 14, 67, 55, -64, 22 },
+  { 0, 102, -10048, 4160, -56, -40, 23, 14, 67, 55, -64, 22 },
+  { 0, 102, -10048, 4160, -56, -40, 23, 14, 67, 55, -64, 22 },
+  { 0, 102, -10048, 4160, -56, -40, 23, 14, 67, 55, -64, 22 },
+  { 0, 102, -10048, 4160, -56, -40, 23, 14, 67, 55, -64, 22 },
+  // Word 1
+  { 81, 81, -26368, 27072, 25, 71, -47, -31, 31, 31, -24, 4 },
+  { 161, 63, -27968, 24000, 65, 29, -1, -9, -5, 31, -4, 22 },
+  { 161, 59, -26368, 22656, 79, 43, -12, -31, -5, 55, 16, 22 },
+  { 161, 57, -26368, 22656, 52, 43, -1, -53, 19, 55, -4, 32 },
+  { 81, 57, -27968, 27072, -16, 43, -12, -42, 7, 55, 16, -15 },
+  { 81, 59, -27968, 27840, -16, 1, 23, -31, -17, 79, -24, 4 },
+  { 81, 59, -26368, 27072, 11, -40, 34, -9, -53, 79, -24, 4 },
+  { 81, 63, -26368, 27840, -43, -26, 46, -20, -29, 79, -4, 22 },
+  { 114, 69, -26368, 27072, -16, -54, 34, 3, -41, 55, -4, 32 },
+  { 81, 77, -24256, 27840, -83, 57, 34, -53, 31, 55, -44, 22 },
+  { 57, 81, -24256, 27072, -97, 57, 23, -31, 31, 55, -64, 32 },
+  { 81, 87, -24256, 25152, -83, 57, 11, -9, 19, 31, -44, 22 },
+  { 81, 87, -21632, 22656, -83, 71, -1, 14, 31, 31, -64, 22 },
+  { 114, 92, -18368, 21248, -83, 71, -12, 3, 43, 31, -44, 22 },
+  { 114, 92, -14528, 19648, -97, 57, -1, 14, 31, 31, -44, 22 },
+  { 81, 95, -18368, 11584, -83, 43, 11, 58, -17, 31, -64, 4 },
+  { 114, 95, -14528, 15936, -97, 43, -12, 58, 31, 7, -24, -15 },
+  { 81, 99, -18368, -1088, -83, 43, -24, 80, -17, 7, -24, 4 },
+  { 41, 102, -28928, -6272, -29, 99, -47, 3, -5, 31, 16, 22 },
+  { 41, 102, -29376, -1088, -29, 85, -24, 36, -5, -40, 37, 22 },
+  { 32, 106, -30848, 6720, -29, 57, 11, 36, 7, -64, 16, 22 },
+  { 32, 110, -30848, 6720, -16, 43, 46, 36, 43, -64, -4, 32 },
+  { 57, 110, -24256, -1088, -70, 29, -1, 58, -29, 7, 16, 4 },
+  { 15, 0, -26368, -11200, -70, 29, -1, 58, -29, 7, 16, 4 },
+  { 32, 0, 10048, 15936, -56, -54, -1, 58, -29, 7, 16, 4 },
+  { 15, 0, 5184, 29632, 38, 57, -1, 58, -29, 7, 16, 4 },
+  { 7, 0, 10048, 29120, 11, 1, -1, 58, -29, 7, 16, 4 },
+  { 0, 0, 10048, 29120, 11, 1, -1, 58, -29, 7, 16, 4 },
+  { 0, 0, 10048, 29120, 11, 1, -1, 58, -29, 7, 16, 4 },
+  { 0, 0, 10048, 29120, 11, 1, -1, 58, -29, 7, 16, 4 },
+  { 0, 0, 10048, 29120, 11, 1, -1, 58, -29, 7, 16, 4 },
+  // Word 2
+  { 32, 73, 18368, -11200, -83, 15, -12, 36, 19, -16, -4, 32 },
+  { 57, 73, 0, -20992, -83, 15, 11, 58, 43, 7, -4, 32 },
+  { 81, 69, 5184, -20992, -70, 57, 23, 58, 67, 7, -24, 32 },
+  { 114, 66, -18368, -15552, -29, 15, 46, 58, 19, -16, -44, 22 },
+  { 161, 66, -14528, -1088, -70, 15, 23, 58, 31, -16, -24, 22 },
+  { 161, 63, -14528, 13824, -83, 43, 46, 47, 19, 7, -24, 4 },
+  { 161, 63, -10048, 17856, -70, 43, 11, 36, 31, 7, -24, 22 },
+  { 161, 63, -14528, 21248, -56, 29, 34, 3, 55, 7, -24, 22 },
+  { 161, 63, -18368, 21248, -43, 43, 11, 3, 43, 31, -44, 22 },
+  { 161, 66, -18368, 24000, -29, 57, -12, 3, 55, 7, -24, 22 },
+  { 161, 66, -21632, 25152, -29, 43, -1, 3, 43, 31, -44, 22 },
+  { 114, 66, -24256, 21248, 11, 15, -12, -9, 19, 31, -24, 22 },
+  { 57, 69, -26368, 13824, -2, 71, -59, -20, 55, 31, -24, 4 },
+  { 81, 77, -26368, 24000, 25, 29, -47, -31, 55, 55, -24, 4 },
+  { 57, 77, -27968, 24000, 25, 15, -47, -20, 55, 31, -24, 22 },
+  { 81, 81, -26368, 22656, 52, -12, -24, -20, 43, 55, -44, 32 },
+  { 81, 85, -26368, 26176, 11, -12, -12, 14, 31, 31, -24, 32 },
+  { 114, 85, -26368, 22656, 52, -12, -12, 14, 43, 31, -24, 22 },
+  { 114, 87, -24256, 24000, 11, 1, -1, 3, 43, 31, -44, 32 },
+  { 161, 87, -21632, 19648, -2, 57, -35, 25, 55, 7, -24, 22 },
+  { 161, 92, -21632, 19648, 11, 43, -24, 14, 43, 31, -44, 22 },
+  { 161, 92, -18368, 15936, 25, 43, -12, -9, 19, 79, -44, 22 },
+  { 161, 95, -18368, 15936, 11, 57, -1, -9, 7, 79, -44, 22 },
+  { 161, 95, -18368, 13824, 25, 57, -1, 3, -29, 79, -44, 22 },
+  { 114, 95, -18368, 13824, -2, 71, -1, -9, -29, 79, -24, 22 },
+  { 114, 99, -18368, 11584, 25, 57, -12, 3, -41, 55, -24, 4 },
+  { 81, 99, -21632, 13824, 25, 43, -12, -9, -29, 55, -24, 4 },
+  { 57, 102, -24256, 21248, 38, 43, -35, -20, -5, 55, -24, 4 },
+  { 20, 110, -24256, 24000, 38, 15, -59, -31, -29, 55, -24, 4 },
+  { 10, 99, -26368, 15936, 25, 29, -70, -31, -41, 55, -24, 22 },
+  { 7, 99, -24256, 11584, 38, 1, -70, 14, -53, 7, -24, 22 },
+  { 0, 99, -24256, 11584, 38, 1, -70, 14, -53, 7, -24, 22 },
+  { 0, 99, -24256, 11584, 38, 1, -70, 14, -53, 7, -24, 22 },
+  { 0, 99, -24256, 11584, 38, 1, -70, 14, -53, 7, -24, 22 },
+  { 0, 99, -24256, 11584, 38, 1, -70, 14, -53, 7, -24, 22 },
+  // Word 3
+  { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+  { 2, 79, -32064, 32384, 65, 1, -59, -31, -29, 31, 37, 22 },
+  { 5, 79, -32064, 26176, -29, 15, 57, 47, 31, 7, -24, -15 },
+  { 41, 77, -18368, 30080, 11, 15, -1, -9, -5, 31, -4, 4 },
+  { 114, 71, -14528, 22656, 11, 15, -1, -20, -41, 7, -4, 4 },
+  { 81, 77, -27968, 15936, -16, 1, 11, 14, 19, 31, -4, 22 },
+  { 57, 71, -29376, 24000, -70, 43, 23, 25, 19, 7, 16, 22 },
+  { 41, 69, -28928, 22656, -97, 57, 46, 3, 7, 31, -4, 4 },
+  { 57, 69, -27968, 17856, -83, 29, 57, 14, 7, 55, -64, 22 },
+  { 114, 69, -27968, 11584, -43, 1, 69, 47, -41, 31, -44, 4 },
+  { 114, 69, -21632, 6720, -83, 15, 69, 36, -5, 31, -64, 4 },
+  { 161, 69, -18368, 4160, -83, 1, 69, 58, -17, 31, -44, 4 },
+  { 161, 69, -18368, 4160, -83, 1, 57, 69, -5, 31, -44, 4 },
+  { 161, 77, -10048, 1536, -83, -12, 46, 69, 7, 7, -44, 4 },
+  { 161, 85, -10048, 1536, -83, 1, 46, 58, -5, 7, -24, 22 },
+  { 161, 92, -5184, 6720, -83, -12, 23, 58, -5, 7, -24, 22 },
+  { 161, 92, 0, 6720, -83, -26, 23, 58, -5, 31, -4, 22 },
+  { 161, 92, 5184, 6720, -70, -40, 23, 58, 7, 31, -4, 22 },
+  { 161, 92, 0, 9216, -83, -12, 11, 36, 19, 31, -24, 22 },
+  { 161, 99, 0, 13824, -83, 1, 11, 14, 31, 31, -4, 22 },
+  { 81, 99, -10048, 13824, -83, -26, 23, -9, 31, 55, -44, 22 },
+  { 81, 99, -14528, 11584, -97, 1, -1, -9, 55, 31, -24, 32 },
+  { 81, 102, -10048, 15936, -97, 15, -24, 3, 67, 7, -4, 22 },
+  { 114, 102, -10048, 17856, -83, 1, -35, -9, 55, 31, 16, 32 },
+  { 57, 99, -21632, 6720, -83, 29, -1, 25, 55, -16, 16, 22 },
+  { 32, 71, -26368, 4160, -56, 15, -12, 47, 7, 31, -4, 4 },
+  { 20, 49, -5184, 4160, -43, 15, -70, 14, -5, 79, 37, 22 },
+  { 0, 49, -5184, 4160, -43, 15, -70, 14, -5, 79, 37, 22 },
+  { 0, 49, -5184, 4160, -43, 15, -70, 14, -5, 79, 37, 22 },
+  { 0, 49, -5184, 4160, -43, 15, -70, 14, -5, 79, 37, 22 },
+  { 0, 49, -5184, 4160, -43, 15, -70, 14, -5, 79, 37, 22 },
+  // Word 4
+  { 5, 79, -31872, 21248, -2, 43, -12, 3, 31, 31, -24, 22 },
+  { 7, 71, -32064, 22656, -16, 57, -24, 14, 31, 7, -24, 22 },
+  { 7, 71, -31552, 26176, -70, 43, -1, 36, -5, 7, 16, 4 },
+  { 57, 66, 0, 4160, 11, 15, -35, -9, -5, 55, 16, 22 },
+  { 114, 63, -24256, 1536, 11, 43, -12, 25, 7, 55, -44, 22 },
+  { 114, 77, -26368, 4160, 65, 43, -12, -9, -5, 55, -24, 32 },
+  { 57, 73, -27968, 1536, 92, 15, -70, 14, 19, 55, -24, 4 },
+  { 41, 71, -28480, -1088, 92, 29, -59, 14, 7, 55, -4, 22 },
+  { 41, 69, -28480, -3712, 65, 57, -24, 14, -17, 31, -4, 22 },
+  { 41, 66, -29696, 6720, 52, 29, -12, -9, 7, 55, -4, 22 },
+  { 81, 66, -28480, 1536, 38, 29, -35, 14, 19, 55, -4, 22 },
+  { 81, 69, -29376, 11584, 65, 29, -1, -20, 31, 55, -44, 4 },
+  { 81, 69, -30016, 15936, 52, 71, 23, -31, 19, 55, -24, 4 },
+  { 114, 77, -29696, 13824, 38, 57, 34, -9, 43, 55, -64, 4 },
+  { 161, 81, -28480, 11584, -2, 15, 11, 36, 55, 55, -24, -15 },
+  { 161, 85, -21632, 1536, -16, 15, -1, 14, 31, 79, 16, -15 },
+  { 161, 87, -18368, 1536, -16, 1, -24, 25, 7, 79, 37, -33 },
+  { 161, 87, -21632, -1088, -29, 29, -1, 25, -5, 79, 16, -33 },
+  { 161, 92, -21632, 4160, -29, 29, -1, 3, -5, 102, -4, 4 },
+  { 114, 92, -24256, 4160, -16, 29, -1, -9, -5, 102, -4, 4 },
+  { 57, 92, -26368, 13824, 11, 15, -24, -31, -5, 102, -4, 4 },
+  { 57, 95, -26368, 19648, 11, -12, -47, -9, 7, 55, -4, 22 },
+  { 20, 95, -27968, 11584, 11, 1, -12, -9, -17, 55, -4, 4 },
+  { 10, 99, -24256, 11584, -2, -12, -24, -9, -41, 31, -44, 59 },
+  { 10, 102, -24256, 19648, -29, 29, -47, -42, -17, 31, -24, 32 },
+  { 4, 99, -29696, 15936, -43, 43, -35, -31, 7, 7, -4, 32 },
+  { 0, 99, -29696, 15936, -43, 43, -35, -31, 7, 7, -4, 32 },
+  { 0, 99, -29696, 15936, -43, 43, -35, -31, 7, 7, -4, 32 },
+  { 0, 99, -29696, 15936, -43, 43, -35, -31, 7, 7, -4, 32 },
+  { 0, 99, -29696, 15936, -43, 43, -35, -31, 7, 7, -4, 32 },
+  // Word 5
+  { 15, 69, -10048, 6720, -83, 15, 46, 36, 19, -16, 16, 32 },
+  { 161, 69, 5184, 15936, -29, -68, -12, 25, 55, 55, -4, 32 },
+  { 161, 69, -5184, 1536, -83, -12, 11, 69, 55, 7, -24, 22 },
+  { 161, 66, 5184, 17856, -16, -54, -47, 14, 55, 55, 16, 22 },
+  { 161, 66, 0, 1536, -70, -12, -1, 58, 55, 7, -24, 4 },
+  { 81, 63, -21632, -1088, -83, 15, -1, 58, 43, 7, -4, 4 },
+  { 81, 59, -26368, -1088, -70, 43, 23, 47, 31, 7, -4, 4 },
+  { 57, 59, -28480, 1536, -56, 57, -1, 80, 31, -40, 16, -33 },
+  { 41, 59, -30016, 9216, -56, 85, -1, 80, -29, 7, -4, -15 },
+  { 32, 63, -31424, 19648, -16, 85, -12, 47, -53, 7, 16, -15 },
+  { 20, 63, -31552, 15936, -2, 71, 23, 14, 7, -40, -4, 22 },
+  { 114, 66, 5184, 9216, 11, -12, -35, -9, 55, 7, -24, 32 },
+  { 161, 69, -10048, 6720, -70, 1, -12, 47, 67, 7, -4, 4 },
+  { 161, 73, -18368, 6720, -70, 1, 46, 47, 55, 7, -24, 22 },
+  { 161, 73, -14528, 6720, -70, 1, 23, 58, 55, 7, -4, 22 },
+  { 161, 81, -10048, 9216, -70, -26, 34, 36, 67, 31, -24, 22 },
+  { 57, 87, -18368, 4160, -83, 29, 23, 14, 55, -16, 16, 22 },
+  { 7, 95, -31232, 1536, -29, 71, 57, 36, 19, -16, -24, 4 },
+  { 3, 0, -31680, 9216, -83, 71, 57, 36, 19, -16, -24, 4 },
+  { 20, 0, -18368, 15936, -83, 15, 57, 36, 19, -16, -24, 4 },
+  { 114, 66, -14528, 11584, -56, -40, 23, 36, 55, 55, -24, 22 },
+  { 161, 92, -14528, 1536, -43, 1, 46, 14, 31, 55, -64, 22 },
+  { 161, 92, -18368, 9216, -16, 1, 11, 14, 55, 55, -24, 22 },
+  { 161, 92, -24256, 11584, -29, 43, 11, 25, 67, 31, -24, 22 },
+  { 161, 95, -26368, 13824, 25, 15, 11, 14, 55, 55, -44, 4 },
+  { 161, 95, -24256, 15936, 11, 15, 11, 14, 43, 55, -24, 22 },
+  { 161, 95, -26368, 19648, 11, -12, -1, 25, 43, 55, -24, 22 },
+  { 161, 95, -26368, 15936, 52, -12, -1, 14, 31, 79, -24, -15 },
+  { 161, 95, -26368, 13824, 65, -12, -12, 14, 31, 55, -24, 4 },
+  { 161, 95, -21632, 17856, -2, 57, -47, -20, 43, 55, 37, -15 },
+  { 161, 99, -24256, 17856, 11, 57, -47, -9, 31, 55, 37, -33 },
+  { 81, 99, -24256, 21248, 11, 43, -59, -9, 43, 79, 37, -33 },
+  { 81, 99, -26368, 19648, 25, 43, -70, -9, 19, 55, 37, -15 },
+  { 81, 99, -26368, 21248, 25, 29, -70, -9, 31, 55, 37, -33 },
+  { 81, 106, -28480, 24000, 11, 15, -47, -9, 55, 55, 16, -15 },
+  { 7, 106, -21632, 13824, -2, 15, -12, 3, 7, 31, 16, 22 },
+  { 0, 106, -21632, 13824, -2, 15, -12, 3, 7, 31, 16, 22 },
+  { 0, 106, -21632, 13824, -2, 15, -12, 3, 7, 31, 16, 22 },
+  { 0, 106, -21632, 13824, -2, 15, -12, 3, 7, 31, 16, 22 },
+  // Word 6
+  { 32, 79, -30592, 9216, 11, 43, 34, 14, -17, 31, -24, -33 },
+  { 32, 85, -26368, -1088, -29, 15, -24, -9, -5, 31, 16, 32 },
+  { 41, 79, -21632, 4160, -16, -12, -12, -9, -41, 7, 16, 22 },
+  { 81, 79, -10048, 1536, -29, 15, -1, 14, -53, 7, -24, 22 },
+  { 114, 77, -10048, -1088, -2, 29, 11, 14, -65, 7, 16, 4 },
+  { 161, 71, -21632, 9216, -2, 29, 23, -20, -29, 55, -4, 22 },
+  { 161, 71, -24256, 17856, 25, 15, 11, -9, -5, 79, -24, 32 },
+  { 161, 73, -24256, 27072, 25, -12, 11, -9, 31, 55, -24, 22 },
+  { 161, 73, -24256, 29120, -2, -40, 34, 25, 31, 31, -44, 4 },
+  { 161, 66, -24256, 26176, 25, -12, 34, -9, 31, 79, -44, 4 },
+  { 161, 66, -24256, 25152, 11, 15, 34, -20, 43, 55, -44, 4 },
+  { 161, 66, -21632, 21248, 52, -26, 34, 36, -5, 55, -24, -15 },
+  { 161, 66, -21632, 25152, -2, -12, 57, 36, 7, 31, -24, 4 },
+  { 161, 66, -21632, 24000, -2, -12, 57, 14, 31, 31, -44, 22 },
+  { 161, 71, -18368, 19648, -29, 29, 34, 3, 67, 31, -44, 22 },
+  { 161, 73, -14528, 17856, -16, 1, 34, 3, 67, 55, -24, 22 },
+  { 161, 79, -18368, 17856, -29, 15, 23, 14, 79, 7, -24, 22 },
+  { 161, 85, -18368, 6720, 25, -12, 23, 3, 43, 55, -44, 4 },
+  { 161, 87, -21632, -1088, 52, -12, 11, 14, 19, 55, -24, 22 },
+  { 161, 87, -18368, -6272, 52, 15, -24, -9, -5, 79, -4, 22 },
+  { 114, 92, -24256, 4160, 25, 15, -12, -31, 43, 55, -4, 22 },
+  { 161, 92, -21632, 4160, 11, -12, -1, -9, 55, 55, -24, 22 },
+  { 161, 92, -21632, 4160, 11, -12, 11, -9, 55, 55, -24, 22 },
+  { 161, 92, -14528, 1536, -43, 29, 34, -20, 55, 55, -24, 22 },
+  { 161, 95, -14528, 9216, -29, 1, -1, 3, 67, 55, -24, 32 },
+  { 161, 102, -18368, 4160, -16, -12, 11, 3, 43, 79, -64, 22 },
+  { 161, 110, -21632, 6720, -16, 1, 11, 14, 43, 79, -44, 32 },
+  { 32, 92, -24256, 13824, -43, -12, -12, 25, 67, 55, -64, 32 },
+  { 10, 79, -30016, 25152, -16, 29, -1, -9, 19, 7, -24, 22 },
+  { 5, 0, -21632, -13440, -43, 43, -1, -9, 19, 7, -24, 22 },
+  { 4, 0, -5184, -6272, -56, 1, -1, -9, 19, 7, -24, 22 },
+  { 4, 0, -18368, -3712, -16, 1, -1, -9, 19, 7, -24, 22 },
+  { 3, 0, -21632, 1536, -29, 15, -1, -9, 19, 7, -24, 22 },
+  { 0, 0, -21632, 1536, -29, 15, -1, -9, 19, 7, -24, 22 },
+  { 0, 0, -21632, 1536, -29, 15, -1, -9, 19, 7, -24, 22 },
+  { 0, 0, -21632, 1536, -29, 15, -1, -9, 19, 7, -24, 22 },
+  { 0, 0, -21632, 1536, -29, 15, -1, -9, 19, 7, -24, 22 },
+};
+
+static const uint16_t bank_0_boundaries[] = {
+  0, 26, 57, 92, 123, 153, 192, 229
+};
+
+static const LPCSpeechSynth::Frame bank_1_frames[] = {
+  // Word 0
+  { 32, 95, 27968, 21248, -43, 15, -1, -53, -17, -16, 37, 77 },
+  { 41, 92, 27968, 21248, -43, 15, -1, -53, -17, -16, 37, 77 },
+  { 57, 95, 27968, 21248, -43, 15, -1, -53, -17, -16, 37, 77 },
+  { 7, 0, 26368, -20992, -29, 43, -1, -53, -17, -16, 37, 77 },
+  { 7, 0, 26368, -20992, -83, 29, -1, -53, -17, -16, 37, 77 },
+  { 114, 66, 21632, 1536, 38, -26, -24, -20, -53, 7, 77, 32 },
+  { 161, 63, 10048, 17856, 52, -26, -70, 3, -29, 79, 57, 32 },
+  { 161, 61, 10048, 17856, 52, -26, -70, 3, -29, 79, 57, 32 },
+  { 114, 61, 10048, 17856, 52, -26, -70, 3, -29, 79, 57, 32 },
+  { 114, 63, 10048, 17856, 52, -26, -70, 3, -29, 79, 57, 32 },
+  { 81, 66, -14528, 19648, -56, 15, -12, -20, -5, 55, 37, 32 },
+  { 57, 73, -26368, 22656, -70, 43, -12, 14, -5, 31, -4, 59 },
+  { 41, 73, -26368, 22656, -70, 43, -12, 14, -5, 31, -4, 59 },
+  { 114, 77, -24256, 15936, -16, 29, -1, 47, -41, 31, 57, 59 },
+  { 81, 79, -24256, 15936, -16, 29, -1, 47, -41, 31, 57, 59 },
+  { 81, 85, -21632, 1536, 38, 29, 23, 25, -53, 31, 77, 59 },
+  { 81, 85, -21632, 1536, 38, 29, 23, 25, -53, 31, 77, 59 },
+  { 57, 92, -21632, 1536, 38, 29, 23, 25, -53, 31, 77, 59 },
+  { 57, 92, -21632, 1536, 38, 29, 23, 25, -53, 31, 77, 59 },
+  { 41, 95, -26368, -1088, 65, 29, 23, 14, -65, 55, 57, 22 },
+  { 20, 95, -26368, -1088, 65, 29, 23, 14, -65, 55, 57, 22 },
+  { 20, 99, -26368, -1088, 65, 29, 23, 14, -65, 55, 57, 22 },
+  { 15, 99, -26368, -1088, 65, 29, 23, 14, -65, 55, 57, 22 },
+  { 0, 99, -26368, -1088, 65, 29, 23, 14, -65, 55, 57, 22 },
+  // Word 1
+  { 10, 77, -21632, -17536, 25, 71, 69, 3, -41, 7, -4, 22 },
+  { 20, 81, -21632, -17536, 25, 71, 69, 3, -41, 7, -4, 22 },
+  { 57, 77, -21632, -13440, 25, 85, 92, -9, -65, 7, 37, 32 },
+  { 81, 63, -21632, -6272, 65, 85, 57, -31, -53, 31, 57, 77 },
+  { 161, 59, -18368, 6720, 38, 57, 23, -20, -17, 55, 57, 4 },
+  { 161, 57, -18368, 6720, 38, 57, 23, -20, -17, 55, 57, 4 },
+  { 161, 54, -10048, 4160, 25, 15, 23, -9, -17, 79, 57, 4 },
+  { 161, 59, -10048, 4160, 25, 15, 23, -9, -17, 79, 57, 4 },
+  { 114, 69, -10048, 4160, 25, 15, 23, -9, -17, 79, 57, 4 },
+  { 57, 81, 5184, 11584, -56, -68, 23, -9, 19, 7, 16, 32 },
+  { 41, 85, 5184, 11584, -56, -68, 23, -9, 19, 7, 16, 32 },
+  { 41, 87, 5184, 11584, -56, -68, 23, -9, 19, 7, 16, 32 },
+  { 32, 95, 5184, 11584, -56, -68, 23, -9, 19, 7, 16, 32 },
+  { 20, 95, 5184, 11584, -56, -68, 23, -9, 19, 7, 16, 32 },
+  { 20, 102, 5184, 11584, -56, -68, 23, -9, 19, 7, 16, 32 },
+  { 15, 102, 5184, 11584, -56, -68, 23, -9, 19, 7, 16, 32 },
+  { 32, 106, -5184, 13824, -2, -12, 11, 3, -5, 79, 37, 4 },
+  { 20, 106, -10048, 19648, -43, 29, -35, -20, 7, 55, -4, 4 },
+  { 10, 106, -10048, 19648, -43, 29, -35, -20, 7, 55, -4, 4 },
+  { 0, 106, -10048, 19648, -43, 29, -35, -20, 7, 55, -4, 4 },
+  // Word 2
+  { 10, 0, 24256, 21248, -56, -12, 0, 0, 0, 0, 0, 0 },
+  { 20, 0, 21632, 17856, 25, 85, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, 5184, 9216, -29, -12, 0, 0, 0, 0, 0, 0 },
+  { 81, 54, -10048, 4160, -56, -12, -24, 47, -5, 55, 57, 4 },
+  { 161, 59, -5184, -6272, -29, 15, -47, 47, -41, 31, 57, 77 },
+  { 161, 59, -5184, -6272, -29, 15, -47, 47, -41, 31, 57, 77 },
+  { 114, 63, -5184, -6272, -29, 15, -47, 47, -41, 31, 57, 77 },
+  { 57, 66, -24256, 4160, -43, 15, 23, 25, -65, 55, 77, 22 },
+  { 41, 77, -24256, 4160, -43, 15, 23, 25, -65, 55, 77, 22 },
+  { 41, 85, -24256, 4160, -43, 15, 23, 25, -65, 55, 77, 22 },
+  { 32, 87, -28928, 1536, 25, 43, -24, 36, -53, 55, 57, 22 },
+  { 32, 99, -28928, 1536, 25, 43, -24, 36, -53, 55, 57, 22 },
+  { 15, 99, -28928, 1536, 25, 43, -24, 36, -53, 55, 57, 22 },
+  { 15, 102, -28928, 1536, 25, 43, -24, 36, -53, 55, 57, 22 },
+  { 10, 106, -29376, 6720, 38, 29, -24, 25, -65, 79, 77, 32 },
+  { 7, 110, -29376, 6720, 38, 29, -24, 25, -65, 79, 77, 32 },
+  { 0, 110, -29376, 6720, 38, 29, -24, 25, -65, 79, 77, 32 },
+  // Word 3
+  { 4, 0, 0, 11584, -2, -12, 0, 0, 0, 0, 0, 0 },
+  { 4, 0, -5184, -1088, -16, -12, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, -5184, -1088, -16, -12, 0, 0, 0, 0, 0, 0 },
+  { 7, 0, -5184, -1088, -16, -12, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, -5184, -1088, -16, -12, 0, 0, 0, 0, 0, 0 },
+  { 57, 51, -18368, 6720, -70, 29, 23, 14, -17, 79, 16, 4 },
+  { 57, 54, -18368, 15936, -70, 43, -47, 25, 19, 7, 37, 32 },
+  { 81, 57, -21632, 17856, -43, 15, -59, 69, -17, 31, 16, 77 },
+  { 114, 57, -21632, 17856, -43, 15, -59, 69, -17, 31, 16, 77 },
+  { 114, 59, -5184, 25152, 11, -26, -59, 58, -65, 79, 37, 32 },
+  { 114, 59, 0, 25152, 11, -40, -59, 25, -41, 102, 37, 22 },
+  { 161, 61, 0, 25152, 11, -40, -59, 25, -41, 102, 37, 22 },
+  { 114, 71, 5184, 19648, -16, -68, -59, 36, 19, 102, 16, 22 },
+  { 81, 85, 5184, 19648, -16, -68, -59, 36, 19, 102, 16, 22 },
+  { 57, 87, 5184, 24000, -43, -68, -59, 14, 43, 102, -4, 4 },
+  { 41, 95, 5184, 24000, -43, -68, -59, 14, 43, 102, -4, 4 },
+  { 41, 102, 5184, 24000, -43, -68, -59, 14, 43, 102, -4, 4 },
+  { 41, 110, 5184, 24000, -43, -68, -59, 14, 43, 102, -4, 4 },
+  { 41, 115, 5184, 24000, -43, -68, -59, 14, 43, 102, -4, 4 },
+  { 32, 119, 5184, 27072, -16, -54, -59, -9, 31, 102, 16, 4 },
+  { 32, 119, 5184, 27072, -16, -54, -59, -9, 31, 102, 16, 4 },
+  { 20, 119, 5184, 27072, -16, -54, -59, -9, 31, 102, 16, 4 },
+  { 0, 119, 5184, 27072, -16, -54, -59, -9, 31, 102, 16, 4 },
+  // Word 4
+  { 2, 0, -5184, 15936, 11, 1, 0, 0, 0, 0, 0, 0 },
+  { 2, 0, -5184, 15936, 11, 1, 0, 0, 0, 0, 0, 0 },
+  { 4, 0, -5184, 15936, 11, 1, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, -5184, 15936, 11, 1, 0, 0, 0, 0, 0, 0 },
+  { 81, 45, -21632, 1536, -29, 85, 34, 14, -77, 55, 37, 59 },
+  { 114, 51, -14528, -6272, -43, 71, 57, 69, -65, -40, 37, 59 },
+  { 114, 51, -14528, -6272, -43, 71, 57, 69, -65, -40, 37, 59 },
+  { 81, 51, -24256, -3712, 25, 57, 57, 36, -65, -16, 37, 59 },
+  { 81, 54, -24256, -3712, 25, 57, 57, 36, -65, -16, 37, 59 },
+  { 57, 63, -26368, 13824, 25, 71, 23, 14, -53, 31, 77, 22 },
+  { 57, 77, -26368, 13824, 25, 71, 23, 14, -53, 31, 77, 22 },
+  { 57, 87, -26368, 13824, 25, 71, 23, 14, -53, 31, 77, 22 },
+  { 41, 99, -26368, 19648, 11, -12, 46, 36, -29, 31, 77, 77 },
+  { 41, 99, -26368, 19648, 11, -12, 46, 36, -29, 31, 77, 77 },
+  { 41, 115, -21632, 21248, 11, -40, 11, 69, -5, 7, 57, 59 },
+  { 32, 123, -21632, 21248, 11, -40, 11, 69, -5, 7, 57, 59 },
+  { 32, 128, -21632, 27072, -56, -40, 57, 36, -5, 31, 57, 22 },
+  { 20, 133, -21632, 22656, -2, -68, 57, 58, 19, 7, 37, 32 },
+  { 15, 128, -18368, 29120, -56, -68, 69, 14, -5, 31, 57, 22 },
+  { 0, 128, -18368, 29120, -56, -68, 69, 14, -5, 31, 57, 22 },
+  // Word 5
+  { 2, 0, -5184, 11584, -43, 15, 0, 0, 0, 0, 0, 0 },
+  { 3, 0, -5184, 11584, -43, 15, 0, 0, 0, 0, 0, 0 },
+  { 4, 0, -5184, 11584, -43, 15, 0, 0, 0, 0, 0, 0 },
+  { 4, 0, 10048, 17856, 11, 1, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, 10048, 17856, 11, 1, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 10048, 17856, 11, 1, 0, 0, 0, 0, 0, 0 },
+  { 81, 54, -10048, -1088, -2, 43, 57, 25, -65, 79, 57, 22 },
+  { 114, 54, -10048, -1088, -2, 43, 57, 25, -65, 79, 57, 22 },
+  { 161, 51, -14528, 6720, 25, 29, 57, -9, -5, 79, 16, 22 },
+  { 161, 54, -14528, 6720, 25, 29, 57, -9, -5, 79, 16, 22 },
+  { 161, 54, -14528, 6720, 25, 29, 57, -9, -5, 79, 16, 22 },
+  { 114, 59, -14528, 6720, 25, 29, 57, -9, -5, 79, 16, 22 },
+  { 114, 63, -14528, 6720, 25, 29, 57, -9, -5, 79, 16, 22 },
+  { 114, 66, -5184, 1536, 38, 1, 34, 25, -17, 102, 37, 22 },
+  { 114, 73, -5184, 1536, 38, 1, 34, 25, -17, 102, 37, 22 },
+  { 81, 81, -5184, 1536, 38, 1, 34, 25, -17, 102, 37, 22 },
+  { 81, 87, 0, 9216, 25, -40, -12, 36, 7, 102, 37, 22 },
+  { 81, 87, 0, 9216, 25, -40, -12, 36, 7, 102, 37, 22 },
+  { 57, 95, -5184, 15936, -29, -26, 11, 14, 43, 102, 57, 22 },
+  { 57, 99, 0, 17856, -2, -26, -12, 14, -29, 102, 57, 32 },
+  { 41, 99, 0, 17856, -2, -26, -12, 14, -29, 102, 57, 32 },
+  { 32, 106, -5184, 22656, -56, 15, 11, -9, -65, 79, 16, 32 },
+  { 41, 110, 0, 15936, -16, 1, 11, -9, -29, -16, -4, 4 },
+  { 20, 110, 0, 15936, -16, 1, 11, -9, -29, -16, -4, 4 },
+  { 10, 110, 0, 15936, -16, 1, 11, -9, -29, -16, -4, 4 },
+  { 5, 110, 0, 15936, -16, 1, 11, -9, -29, -16, -4, 4 },
+  { 4, 110, 0, 15936, -16, 1, 11, -9, -29, -16, -4, 4 },
+  { 0, 110, 0, 15936, -16, 1, 11, -9, -29, -16, -4, 4 },
+  // Word 6
+  { 3, 0, 27968, 21248, 38, -12, 0, 0, 0, 0, 0, 0 },
+  { 7, 0, 27968, 25152, 11, 15, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 27968, 25152, -16, 29, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 27968, 25152, 11, 29, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 27968, 25152, -16, 29, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 27968, 19648, -43, 1, 0, 0, 0, 0, 0, 0 },
+  { 114, 85, 5184, 6720, 11, 1, -24, -20, -29, 102, 37, 22 },
+  { 114, 85, -5184, -1088, -16, -12, -24, 25, 19, 102, 37, 22 },
+  { 114, 102, -5184, 11584, 38, -26, -35, 25, 7, 102, 57, 22 },
+  { 114, 119, -5184, 9216, 11, -54, -1, 36, 19, 79, 57, 4 },
+  { 81, 138, -5184, 9216, 11, -54, -1, 36, 19, 79, 57, 4 },
+  { 2, 22, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 0, 22, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 0, 22, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 0, 22, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 3, 0, -14528, 11584, 11, -12, -24, -20, -53, 55, -4, -51 },
+  { 7, 0, 24256, 4160, 25, 99, -24, -20, -53, 55, -4, -51 },
+  { 10, 0, 27968, 17856, 25, 43, -24, -20, -53, 55, -4, -51 },
+  { 10, 0, 27968, 25152, 11, 29, -24, -20, -53, 55, -4, -51 },
+  { 10, 0, 27968, 25152, 11, 15, -24, -20, -53, 55, -4, -51 },
+  { 7, 0, 27968, 22656, 11, 43, -24, -20, -53, 55, -4, -51 },
+  { 4, 0, 27968, 21248, 25, 29, -24, -20, -53, 55, -4, -51 },
+  { 0, 0, 27968, 21248, 25, 29, -24, -20, -53, 55, -4, -51 },
+  // Word 7
+  { 4, 0, 26368, 6720, -16, -12, 0, 0, 0, 0, 0, 0 },
+  { 4, 0, 27968, 19648, 11, -26, 0, 0, 0, 0, 0, 0 },
+  { 7, 0, 27968, 25152, 25, -12, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 27968, 25152, 25, -12, 0, 0, 0, 0, 0, 0 },
+  { 20, 0, 27968, 25152, 11, -12, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, 27968, 22656, 25, 1, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 27968, 21248, 25, 1, 0, 0, 0, 0, 0, 0 },
+  { 114, 77, -14528, 9216, -2, 1, -1, 25, 31, 102, 16, 22 },
+  { 114, 85, -14528, 17856, 11, 1, -12, 3, 31, 79, 37, 4 },
+  { 81, 85, -18368, 17856, -2, 15, -12, 3, -5, 79, 57, -15 },
+  { 32, 92, -18368, 15936, -2, 15, -24, -9, -41, 55, 37, 4 },
+  { 81, 92, -18368, 11584, 11, 1, -12, -9, -17, 79, 37, -15 },
+  { 81, 81, -14528, 9216, 25, -12, -12, 3, 31, 102, 37, -33 },
+  { 41, 81, -5184, 4160, -97, 43, 46, -20, 19, -16, 37, 22 },
+  { 41, 77, 0, 1536, -83, 29, 11, -9, 19, -16, 37, 4 },
+  { 41, 73, 5184, 6720, -83, 15, 23, -20, 19, -40, 37, 22 },
+  { 32, 73, 5184, 1536, -56, -12, 11, -42, 19, -16, 57, -15 },
+  { 15, 66, -18368, 13824, -43, 1, -35, -9, 43, 31, -24, -51 },
+  { 0, 66, -18368, 13824, -43, 1, -35, -9, 43, 31, -24, -51 },
+  // Word 8
+  { 57, 92, 5184, 13824, -29, -40, -24, 25, 31, 79, 16, 4 },
+  { 114, 92, 5184, 4160, -2, -54, -12, 58, 31, 79, 16, 4 },
+  { 114, 85, 5184, 9216, -2, -68, -12, 58, 31, 79, -4, 4 },
+  { 114, 79, 10048, 19648, 11, -82, -24, 36, 31, 79, -4, 4 },
+  { 114, 85, 5184, 22656, -43, -82, -1, 25, 43, 79, -4, 4 },
+  { 114, 99, 10048, 25152, -29, -82, -12, 25, 43, 79, 16, 4 },
+  { 32, 110, 5184, 22656, -56, -82, 11, 47, 67, 79, -4, -15 },
+  { 15, 143, 0, 13824, -97, -68, 46, 80, 55, 55, -24, -33 },
+  { 2, 17, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 0, 17, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 0, 17, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 0, 17, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 7, 0, 5184, -1088, -16, 1, -24, -20, -53, 55, -4, -51 },
+  { 4, 0, 18368, -6272, -43, 1, -24, -20, -53, 55, -4, -51 },
+  { 0, 0, 18368, -6272, -43, 1, -24, -20, -53, 55, -4, -51 },
+  // Word 9
+  { 5, 85, -28480, -6272, -16, 43, 23, -9, 43, 31, -4, -15 },
+  { 15, 81, -18368, -3712, -70, 29, 23, 3, 7, 31, -4, 22 },
+  { 57, 77, 0, 4160, -70, -26, 23, 3, -17, 31, 16, 32 },
+  { 81, 73, 5184, 13824, -83, -26, 23, 25, -17, 31, -4, 59 },
+  { 114, 66, -5184, 11584, -29, 29, -1, -20, -17, 55, 16, 4 },
+  { 114, 61, -14528, 13824, 52, -12, -12, 14, -17, 79, -4, 22 },
+  { 114, 61, -14528, 17856, 52, 1, -12, 36, -5, 79, 16, 22 },
+  { 114, 59, -18368, 25152, 11, 1, -1, 25, 19, 55, 16, 22 },
+  { 114, 59, -18368, 25152, -2, 1, -1, 25, 19, 55, -4, 22 },
+  { 114, 61, -18368, 25152, -2, -12, 11, 25, 19, 79, -4, 22 },
+  { 114, 66, -18368, 24000, -2, -26, 23, 36, 7, 79, -4, 22 },
+  { 114, 71, -14528, 19648, -2, -12, 23, 36, 7, 79, -4, 22 },
+  { 114, 77, -10048, 13824, -2, -26, 23, 47, 7, 79, -4, 4 },
+  { 114, 85, -5184, 9216, 11, -40, 11, 69, 7, 79, 16, -15 },
+  { 114, 92, 0, 6720, 11, -54, 11, 80, 7, 79, 16, -15 },
+  { 81, 95, 0, 6720, -2, -54, -1, 80, 19, 79, -4, -15 },
+  { 57, 95, 0, 4160, -2, -40, -1, 69, 19, 79, 16, -33 },
+  { 32, 106, 0, 13824, -83, 15, 23, 14, 7, 31, 16, 22 },
+  { 32, 110, 0, 15936, -83, 1, 34, -9, 19, 7, 16, 22 },
+  { 32, 110, -5184, 9216, -83, 1, 34, -9, 7, 31, 16, 22 },
+  { 32, 106, 0, 17856, -29, -26, 23, -20, 31, 79, -24, -33 },
+  { 15, 106, -5184, 19648, -56, -12, -12, -9, 43, 55, -24, -15 },
+  { 5, 102, 0, 22656, -43, -12, -24, -20, 55, 31, -44, -15 },
+  { 0, 102, 0, 22656, -43, -12, -24, -20, 55, 31, -44, -15 },
+  // Word 10
+  { 7, 0, 18368, -6272, -43, 1, 0, 0, 0, 0, 0, 0 },
+  { 7, 0, 18368, -6272, -43, 1, 0, 0, 0, 0, 0, 0 },
+  { 114, 51, -10048, 13824, -56, -26, -1, 36, 31, 55, -24, 4 },
+  { 114, 57, 5184, 15936, 25, -26, -24, 25, -5, 102, 37, 22 },
+  { 114, 57, -5184, 9216, -2, -26, 11, 58, 19, 102, -4, 4 },
+  { 114, 59, -10048, 4160, 11, -26, 23, 69, 19, 102, -4, 4 },
+  { 114, 63, -5184, 4160, 38, -26, -1, 58, -5, 79, -4, 4 },
+  { 114, 81, -14528, 4160, 38, -40, 23, 36, 7, 102, -4, 4 },
+  { 81, 81, -10048, 6720, -56, 15, 34, -20, 43, 7, 16, 22 },
+  { 41, 92, 0, 6720, -70, 1, 34, -20, 19, -16, 16, 22 },
+  { 57, 99, 0, 4160, -56, -12, 34, -20, 7, 7, -4, 32 },
+  { 32, 106, 5184, 6720, -56, -40, 46, -9, 7, 7, -24, 32 },
+  { 32, 106, -5184, 1536, -56, -12, 57, -20, 7, 7, -4, 32 },
+  { 32, 106, -5184, 1536, -56, -12, 57, -20, 7, 7, -4, 32 },
+  { 20, 110, 0, -1088, -56, -40, 57, 14, -5, 7, -4, 32 },
+  { 0, 110, 0, -1088, -56, -40, 57, 14, -5, 7, -4, 32 },
+};
+
+static const uint16_t bank_1_boundaries[] = {
+  0, 24, 44, 61, 84, 104, 132, 155, 174, 189, 213, 229
+};
+
+static const LPCSpeechSynth::Frame bank_2_frames[] = {
+  // Word 0
+  { 41, 87, -14528, 9216, -70, 1, 46, 58, 67, 55, -4, 4 },
+  { 161, 73, 5184, 21248, -2, -54, -24, 25, 31, 79, -4, 22 },
+  { 161, 66, 5184, 21248, -2, -54, -24, 25, 31, 79, -4, 22 },
+  { 161, 63, 5184, 21248, -2, -54, -24, 25, 31, 79, -4, 22 },
+  { 161, 63, 5184, 21248, -2, -54, -24, 25, 31, 79, -4, 22 },
+  { 161, 66, 5184, 21248, -2, -54, -24, 25, 31, 79, -4, 22 },
+  { 161, 66, 5184, 21248, -2, -54, -24, 25, 31, 79, -4, 22 },
+  { 161, 71, 5184, 21248, -2, -54, -24, 25, 31, 79, -4, 22 },
+  { 114, 73, 10048, 15936, 25, -82, -59, 58, 31, 79, 37, 4 },
+  { 114, 79, 10048, 15936, 25, -82, -59, 58, 31, 79, 37, 4 },
+  { 114, 81, 10048, 15936, 25, -82, -59, 58, 31, 79, 37, 4 },
+  { 114, 85, 10048, 15936, 25, -82, -59, 58, 31, 79, 37, 4 },
+  { 81, 87, 10048, 15936, 25, -82, -59, 58, 31, 79, 37, 4 },
+  { 81, 92, 10048, 15936, 25, -82, -59, 58, 31, 79, 37, 4 },
+  { 57, 95, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 41, 99, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 41, 102, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 32, 110, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 0, 110, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  // Word 1
+  { 10, 73, -14528, 1536, 38, -26, -82, 14, -29, 79, 37, 22 },
+  { 81, 57, 0, 17856, 38, -26, -82, 14, -29, 79, 37, 22 },
+  { 81, 54, 14528, 21248, 25, -68, -82, 14, 7, 102, 37, 22 },
+  { 81, 54, 14528, 21248, 25, -68, -82, 14, 7, 102, 37, 22 },
+  { 81, 53, 14528, 21248, 25, -68, -82, 14, 7, 102, 37, 22 },
+  { 81, 57, 14528, 21248, 25, -68, -82, 14, 7, 102, 37, 22 },
+  { 81, 63, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 81, 69, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 57, 81, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 57, 85, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 41, 99, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 41, 102, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 41, 102, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 41, 110, 10048, 22656, 38, -54, -82, 3, 7, 79, 37, 22 },
+  { 32, 119, 10048, 22656, 38, -54, -82, 3, 7, 79, 37, 22 },
+  { 20, 123, 10048, 22656, 38, -54, -82, 3, 7, 79, 37, 22 },
+  { 20, 128, 10048, 22656, 38, -54, -82, 3, 7, 79, 37, 22 },
+  { 0, 128, 10048, 22656, 38, -54, -82, 3, 7, 79, 37, 22 },
+  // Word 2
+  { 3, 0, 27968, 22656, 38, 29, 0, 0, 0, 0, 0, 0 },
+  { 4, 0, 27968, 22656, 38, 29, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, 27968, 22656, 38, 29, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 27968, 22656, 38, 29, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, 27968, 22656, 38, 29, 0, 0, 0, 0, 0, 0 },
+  { 20, 0, 27968, 22656, 38, 29, 0, 0, 0, 0, 0, 0 },
+  { 114, 43, 0, 13824, -29, -40, -35, -9, 7, 79, 16, 22 },
+  { 114, 54, 10048, 22656, 25, -54, -70, -9, 7, 79, 37, 22 },
+  { 114, 54, 10048, 22656, 25, -54, -70, -9, 7, 79, 37, 22 },
+  { 114, 54, 10048, 22656, 25, -54, -70, -9, 7, 79, 37, 22 },
+  { 81, 57, 10048, 24000, -2, -82, -70, 14, 31, 102, 37, 4 },
+  { 81, 59, 10048, 24000, -2, -82, -70, 14, 31, 102, 37, 4 },
+  { 81, 66, 10048, 24000, -29, -82, -59, 25, 43, 79, 16, -15 },
+  { 81, 77, 10048, 24000, -29, -82, -59, 25, 43, 79, 16, -15 },
+  { 57, 85, 10048, 24000, -29, -82, -59, 25, 43, 79, 16, -15 },
+  { 57, 87, 10048, 24000, -29, -82, -59, 25, 43, 79, 16, -15 },
+  { 57, 95, 10048, 24000, -29, -82, -59, 25, 43, 79, 16, -15 },
+  { 32, 106, 10048, 25152, 11, -82, -82, 25, 43, 102, 37, 4 },
+  { 32, 110, 10048, 25152, 11, -82, -82, 25, 43, 102, 37, 4 },
+  { 32, 110, 10048, 25152, 11, -82, -82, 25, 43, 102, 37, 4 },
+  { 32, 115, 10048, 25152, 11, -82, -82, 25, 43, 102, 37, 4 },
+  { 32, 115, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 32, 119, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 32, 119, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 0, 119, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  // Word 3
+  { 2, 0, -31552, 4160, 38, 1, 0, 0, 0, 0, 0, 0 },
+  { 2, 0, -31552, 4160, 38, 1, 0, 0, 0, 0, 0, 0 },
+  { 57, 92, 21632, -8768, 11, -12, -24, -20, -17, 31, 57, 22 },
+  { 81, 77, -5184, 15936, -43, -40, -24, -9, 19, 102, 16, 22 },
+  { 81, 73, 0, 13824, -56, -54, -24, 25, 31, 102, -4, 4 },
+  { 81, 77, 5184, 11584, -29, -82, -47, 47, 31, 102, 16, 4 },
+  { 57, 77, 10048, 11584, -16, -82, -47, 58, 43, 79, -4, 4 },
+  { 57, 81, 10048, 15936, -16, -82, -47, 58, 31, 79, -4, -15 },
+  { 57, 85, 10048, 4160, -16, -68, -35, 69, 31, 79, 16, -15 },
+  { 0, 85, 10048, 4160, -16, -68, -35, 69, 31, 79, 16, -15 },
+  // Word 4
+  { 5, 73, 14528, 24000, -70, -68, -35, 58, 55, 79, 16, 4 },
+  { 57, 69, 14528, 24000, -70, -68, -35, 58, 55, 79, 16, 4 },
+  { 114, 66, 14528, 22656, -16, -68, -82, 25, 31, 79, 16, 22 },
+  { 114, 66, 14528, 22656, -16, -68, -82, 25, 31, 79, 16, 22 },
+  { 114, 63, 14528, 22656, -16, -68, -82, 25, 31, 79, 16, 22 },
+  { 114, 63, 10048, 21248, -16, -82, -59, 36, 43, 79, 16, 22 },
+  { 114, 66, 10048, 21248, -16, -82, -59, 36, 43, 79, 16, 22 },
+  { 114, 69, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 114, 71, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 114, 73, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 114, 77, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 114, 79, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 114, 81, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 114, 92, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 114, 92, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 114, 99, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 81, 99, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 57, 106, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 57, 106, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 57, 110, 10048, 22656, 38, -54, -82, 3, 7, 79, 37, 22 },
+  { 0, 110, 10048, 22656, 38, -54, -82, 3, 7, 79, 37, 22 },
+  // Word 5
+  { 114, 73, 5184, 15936, 52, -12, -47, 14, -5, 79, 37, 22 },
+  { 161, 81, 5184, 15936, 52, -12, -47, 14, -5, 79, 37, 22 },
+  { 161, 73, 0, 13824, 38, -54, -1, 14, 31, 79, 37, 4 },
+  { 161, 73, -5184, 6720, 65, -40, 11, 25, 7, 102, 37, 4 },
+  { 161, 73, -5184, 6720, 65, -40, 11, 25, 7, 102, 37, 4 },
+  { 161, 81, -5184, 6720, 65, -40, 11, 25, 7, 102, 37, 4 },
+  { 114, 92, -10048, 15936, -16, 1, 34, -31, 31, 102, -4, 32 },
+  { 57, 95, -10048, 11584, -16, -12, 57, 3, -29, 79, -44, 22 },
+  { 4, 0, 5184, 6720, 11, 15, 57, 3, -29, 79, -44, 22 },
+  { 7, 0, 5184, 6720, 11, 15, 57, 3, -29, 79, -44, 22 },
+  { 10, 0, 5184, 6720, 11, 15, 57, 3, -29, 79, -44, 22 },
+  { 10, 0, 5184, 6720, 11, 15, 57, 3, -29, 79, -44, 22 },
+  { 7, 0, 10048, 9216, 38, 15, 57, 3, -29, 79, -44, 22 },
+  { 7, 0, 10048, 9216, 38, 15, 57, 3, -29, 79, -44, 22 },
+  { 5, 0, 10048, 9216, 38, 15, 57, 3, -29, 79, -44, 22 },
+  { 5, 0, 10048, 9216, 38, 15, 57, 3, -29, 79, -44, 22 },
+  { 4, 0, 10048, 9216, 38, 15, 57, 3, -29, 79, -44, 22 },
+  { 3, 0, -10048, 15936, -43, 1, 57, 3, -29, 79, -44, 22 },
+  { 0, 0, -10048, 15936, -43, 1, 57, 3, -29, 79, -44, 22 },
+  // Word 6
+  { 15, 102, 21632, 19648, 11, 1, -59, -31, -41, -16, 16, 59 },
+  { 81, 102, 21632, 19648, 11, 1, -59, -31, -41, -16, 16, 59 },
+  { 20, 0, 14528, 22656, -16, -54, -59, -31, -41, -16, 16, 59 },
+  { 41, 61, 21632, 24000, 79, 71, 23, 3, -29, -64, -24, 32 },
+  { 161, 57, 5184, 24000, 11, -26, -70, -9, -17, 79, 57, 32 },
+  { 114, 54, 5184, 24000, 11, -26, -70, -9, -17, 79, 57, 32 },
+  { 114, 54, 5184, 24000, 11, -26, -70, -9, -17, 79, 57, 32 },
+  { 114, 53, 5184, 24000, 11, -26, -70, -9, -17, 79, 57, 32 },
+  { 114, 54, 5184, 22656, 11, -68, -59, 36, 31, 79, 37, 4 },
+  { 114, 57, 5184, 22656, 11, -68, -59, 36, 31, 79, 37, 4 },
+  { 114, 61, 5184, 22656, 11, -68, -59, 36, 31, 79, 37, 4 },
+  { 114, 71, 5184, 22656, 11, -68, -59, 36, 31, 79, 37, 4 },
+  { 81, 81, 10048, 22656, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 81, 87, 10048, 22656, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 81, 87, 10048, 22656, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 57, 99, 10048, 22656, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 41, 99, 10048, 22656, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 41, 115, 10048, 22656, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 41, 115, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 20, 123, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 20, 123, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 0, 123, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  // Word 7
+  { 41, 81, 5184, 25152, 52, -68, -47, 3, 19, 79, 37, 22 },
+  { 114, 71, 5184, 25152, 52, -68, -47, 3, 19, 79, 37, 22 },
+  { 161, 66, 5184, 25152, 52, -68, -47, 3, 19, 79, 37, 22 },
+  { 161, 63, 5184, 25152, 52, -68, -47, 3, 19, 79, 37, 22 },
+  { 161, 61, 5184, 25152, 52, -68, -47, 3, 19, 79, 37, 22 },
+  { 114, 69, 5184, 25152, 52, -68, -47, 3, 19, 79, 37, 22 },
+  { 81, 81, 10048, 17856, -29, -82, -59, 80, 43, 79, 16, 4 },
+  { 32, 95, 10048, 17856, -29, -82, -59, 80, 43, 79, 16, 4 },
+  { 10, 110, 10048, 17856, -29, -82, -59, 80, 43, 79, 16, 4 },
+  { 15, 102, -5184, 13824, -83, -68, 23, 58, 43, 31, -4, 32 },
+  { 3, 102, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 102, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 102, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 102, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 102, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 4, 0, 14528, 21248, -2, -26, -1, -20, -29, -16, -4, 4 },
+  { 15, 0, 14528, 21248, 65, 71, -1, -20, -29, -16, -4, 4 },
+  { 20, 0, 14528, 21248, 65, 71, -1, -20, -29, -16, -4, 4 },
+  { 10, 0, 14528, 21248, 65, 71, -1, -20, -29, -16, -4, 4 },
+  { 10, 0, 14528, 21248, 65, 71, -1, -20, -29, -16, -4, 4 },
+  { 10, 0, 14528, 21248, 65, 71, -1, -20, -29, -16, -4, 4 },
+  { 10, 0, 14528, 21248, 65, 71, -1, -20, -29, -16, -4, 4 },
+  { 7, 0, 14528, 21248, 65, 71, -1, -20, -29, -16, -4, 4 },
+  { 7, 0, 14528, 21248, 65, 71, -1, -20, -29, -16, -4, 4 },
+  { 3, 0, -5184, 30080, 11, 1, -1, -20, -29, -16, -4, 4 },
+  { 0, 0, -5184, 30080, 11, 1, -1, -20, -29, -16, -4, 4 },
+  // Word 8
+  { 7, 63, -24256, 27072, 52, -54, 34, 47, 43, 79, -4, -15 },
+  { 114, 81, -14528, 1536, 79, 43, 11, 25, -17, 79, 57, 4 },
+  { 161, 69, -14528, 1536, 79, 43, 11, 25, -17, 79, 57, 4 },
+  { 161, 61, -14528, 1536, 79, 43, 11, 25, -17, 79, 57, 4 },
+  { 161, 61, -14528, 1536, 79, 43, 11, 25, -17, 79, 57, 4 },
+  { 161, 63, -14528, 1536, 79, 43, 11, 25, -17, 79, 57, 4 },
+  { 161, 63, -14528, 1536, 79, 43, 11, 25, -17, 79, 57, 4 },
+  { 161, 63, -10048, 9216, 52, -12, 34, 25, -17, 79, 16, 4 },
+  { 161, 66, -10048, 9216, 52, -12, 34, 25, -17, 79, 16, 4 },
+  { 114, 69, -10048, 9216, 52, -12, 34, 25, -17, 79, 16, 4 },
+  { 114, 79, -10048, 9216, 52, -12, 34, 25, -17, 79, 16, 4 },
+  { 114, 81, -10048, 9216, 52, -12, 34, 25, -17, 79, 16, 4 },
+  { 114, 87, -5184, 11584, 25, -26, 34, 36, -5, 79, 16, 4 },
+  { 114, 95, -5184, 11584, 25, -26, 34, 36, -5, 79, 16, 4 },
+  { 57, 95, -10048, 21248, -16, -26, 34, 14, 43, 102, 16, 4 },
+  { 57, 95, 0, 17856, -2, -40, -12, 14, -29, 102, 16, 4 },
+  { 57, 95, 0, 17856, -2, -40, -12, 14, -29, 102, 16, 4 },
+  { 41, 99, 0, 17856, -2, -40, -12, 14, -29, 102, 16, 4 },
+  { 41, 99, 0, 17856, -2, -40, -12, 14, -29, 102, 16, 4 },
+  { 32, 102, 5184, 22656, 11, -68, -35, 14, -29, 102, 16, 4 },
+  { 32, 106, 5184, 22656, 11, -68, -35, 14, -29, 102, 16, 4 },
+  { 32, 110, 5184, 22656, 11, -68, -35, 14, -29, 102, 16, 4 },
+  { 0, 110, 5184, 22656, 11, -68, -35, 14, -29, 102, 16, 4 },
+  // Word 9
+  { 15, 77, 14528, 15936, -16, -40, -59, -9, -29, 31, 57, 59 },
+  { 5, 0, 14528, -1088, -83, -54, -59, -9, -29, 31, 57, 59 },
+  { 15, 0, 18368, 17856, -43, 1, -59, -9, -29, 31, 57, 59 },
+  { 20, 0, 18368, 22656, 52, 43, -59, -9, -29, 31, 57, 59 },
+  { 81, 73, 0, 17856, -43, -54, -35, 14, 19, 55, 57, 4 },
+  { 161, 57, 0, 22656, -2, -26, -24, 3, 19, 79, 37, 4 },
+  { 161, 57, 0, 22656, -2, -26, -24, 3, 19, 79, 37, 4 },
+  { 161, 57, 0, 22656, -2, -26, -24, 3, 19, 79, 37, 4 },
+  { 161, 57, 0, 22656, -2, -26, -24, 3, 19, 79, 37, 4 },
+  { 161, 61, 0, 22656, -2, -26, -24, 3, 19, 79, 37, 4 },
+  { 161, 61, 0, 22656, -2, -26, -24, 3, 19, 79, 37, 4 },
+  { 161, 66, 0, 22656, -2, -26, -24, 3, 19, 79, 37, 4 },
+  { 114, 73, 0, 22656, -2, -26, -24, 3, 19, 79, 37, 4 },
+  { 81, 87, 5184, 25152, 25, -54, -47, 3, 7, 102, 37, 22 },
+  { 41, 102, 5184, 25152, 25, -54, -47, 3, 7, 102, 37, 22 },
+  { 57, 106, 5184, 25152, 25, -54, -47, 3, 7, 102, 37, 22 },
+  { 57, 115, 10048, 22656, 52, -40, -70, 3, -5, 79, 57, 22 },
+  { 41, 115, 10048, 22656, 52, -40, -70, 3, -5, 79, 57, 22 },
+  { 32, 119, 5184, 21248, 38, -68, -70, 25, 7, 102, 57, 22 },
+  { 32, 110, 5184, 21248, 38, -68, -70, 25, 7, 102, 57, 22 },
+  { 32, 110, 5184, 21248, 38, -68, -70, 25, 7, 102, 57, 22 },
+  { 0, 110, 5184, 21248, 38, -68, -70, 25, 7, 102, 57, 22 },
+  // Word 10
+  { 20, 0, 5184, 17856, -70, -40, 0, 0, 0, 0, 0, 0 },
+  { 41, 0, -5184, 1536, -83, -12, 0, 0, 0, 0, 0, 0 },
+  { 20, 0, -5184, 1536, -83, -12, 0, 0, 0, 0, 0, 0 },
+  { 114, 51, -5184, 21248, -70, -26, -1, 14, 31, 55, -4, 4 },
+  { 161, 57, 0, 19648, -2, -54, -12, 25, 19, 79, 16, 22 },
+  { 161, 57, 0, 19648, -2, -54, -12, 25, 19, 79, 16, 22 },
+  { 161, 57, 0, 19648, -2, -54, -12, 25, 19, 79, 16, 22 },
+  { 161, 57, 0, 19648, -2, -54, -12, 25, 19, 79, 16, 22 },
+  { 161, 57, 0, 19648, -2, -54, -12, 25, 19, 79, 16, 22 },
+  { 161, 69, 5184, 11584, -2, -68, -24, 58, 31, 79, 37, 4 },
+  { 114, 77, 5184, 11584, -2, -68, -24, 58, 31, 79, 37, 4 },
+  { 114, 77, 5184, 11584, -2, -68, -24, 58, 31, 79, 37, 4 },
+  { 114, 87, 5184, 11584, -2, -68, -24, 58, 31, 79, 37, 4 },
+  { 57, 99, 5184, 17856, 25, -82, -70, 47, 31, 102, 37, 22 },
+  { 57, 99, 5184, 17856, 25, -82, -70, 47, 31, 102, 37, 22 },
+  { 57, 99, 10048, 22656, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 41, 110, 10048, 22656, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 32, 110, 10048, 22656, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 32, 115, 10048, 22656, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 32, 115, 5184, 27072, -56, -54, -24, 25, 55, 55, -4, 22 },
+  { 32, 115, 5184, 27072, -56, -54, -24, 25, 55, 55, -4, 22 },
+  { 0, 115, 5184, 27072, -56, -54, -24, 25, 55, 55, -4, 22 },
+  // Word 11
+  { 114, 71, -5184, 11584, -2, -40, -12, 47, 31, 79, 57, 4 },
+  { 161, 69, -5184, 11584, -2, -40, -12, 47, 31, 79, 57, 4 },
+  { 161, 69, -5184, 11584, -2, -40, -12, 47, 31, 79, 57, 4 },
+  { 161, 69, -10048, 15936, -2, 15, 34, -20, 7, 79, 16, 4 },
+  { 161, 69, -10048, 15936, -2, 15, 34, -20, 7, 79, 16, 4 },
+  { 161, 69, -10048, 15936, -2, 15, 34, -20, 7, 79, 16, 4 },
+  { 161, 71, -18368, 1536, 65, 29, -1, 3, -29, 55, 57, 4 },
+  { 161, 71, -18368, 1536, 65, 29, -1, 3, -29, 55, 57, 4 },
+  { 114, 77, -10048, -13440, 65, 43, 23, 3, -41, 31, 77, 22 },
+  { 81, 85, -5184, -19328, 11, 85, 34, 36, -53, 7, 57, 32 },
+  { 57, 85, -5184, -19328, 11, 85, 34, 36, -53, 7, 57, 32 },
+  { 41, 95, -10048, -20992, 38, 99, 11, -9, -41, 7, 77, 22 },
+  { 20, 95, -10048, -20992, 38, 99, 11, -9, -41, 7, 77, 22 },
+  { 20, 99, -14528, -19328, 52, 71, 57, -20, -53, 7, 77, 22 },
+  { 20, 99, -5184, -20992, -2, 85, 23, 25, -29, -16, 57, 22 },
+  { 20, 99, -5184, -20992, -2, 85, 23, 25, -29, -16, 57, 22 },
+  { 0, 99, -5184, -20992, -2, 85, 23, 25, -29, -16, 57, 22 },
+  // Word 12
+  { 32, 54, 0, 22656, -29, -40, -1, 36, 67, 79, 16, 4 },
+  { 81, 54, 0, 22656, -29, -40, -1, 36, 67, 79, 16, 4 },
+  { 161, 73, 0, 22656, -29, -40, -1, 36, 67, 79, 16, 4 },
+  { 161, 66, 0, 22656, -29, -40, -1, 36, 67, 79, 16, 4 },
+  { 161, 63, 0, 22656, -29, -40, -1, 36, 67, 79, 16, 4 },
+  { 161, 61, 0, 13824, 38, -26, -1, 25, 7, 79, 37, 4 },
+  { 161, 61, 0, 13824, 38, -26, -1, 25, 7, 79, 37, 4 },
+  { 161, 63, 0, 13824, 38, -26, -1, 25, 7, 79, 37, 4 },
+  { 114, 66, 0, 13824, 38, -26, -1, 25, 7, 79, 37, 4 },
+  { 81, 73, -10048, 17856, 11, -40, 11, 3, -29, 7, -24, 4 },
+  { 57, 81, -10048, 17856, 11, -40, 11, 3, -29, 7, -24, 4 },
+  { 57, 87, -10048, 17856, 11, -40, 11, 3, -29, 7, -24, 4 },
+  { 57, 92, -5184, 17856, 11, -40, 11, 3, -29, 7, -24, 4 },
+  { 41, 95, -5184, 17856, 11, -40, 11, 3, -29, 7, -24, 4 },
+  { 41, 95, -5184, 17856, 11, -40, 11, 3, -29, 7, -24, 4 },
+  { 32, 95, -10048, -3712, 11, -40, 46, -42, -29, 7, -4, 32 },
+  { 20, 99, -10048, -3712, 11, -40, 46, -42, -29, 7, -4, 32 },
+  { 10, 99, -10048, -3712, 11, -40, 46, -42, -29, 7, -4, 32 },
+  { 10, 99, -10048, -3712, 11, -40, 46, -42, -29, 7, -4, 32 },
+  { 10, 102, -10048, -3712, 11, -40, 46, -42, -29, 7, -4, 32 },
+  { 20, 102, -14528, 17856, 25, 29, -1, -20, -17, 55, 16, 22 },
+  { 20, 106, -14528, 17856, 25, 29, -1, -20, -17, 55, 16, 22 },
+  { 20, 110, -14528, 17856, 25, 29, -1, -20, -17, 55, 16, 22 },
+  { 0, 110, -14528, 17856, 25, 29, -1, -20, -17, 55, 16, 22 },
+  // Word 13
+  { 20, 28, 0, 17856, -29, -54, -1, 36, 43, 79, 16, 4 },
+  { 114, 69, 0, 17856, -29, -54, -1, 36, 43, 79, 16, 4 },
+  { 161, 63, 5184, 11584, 38, -54, -12, 25, 19, 102, 16, 4 },
+  { 161, 61, 5184, 11584, 38, -54, -12, 25, 19, 102, 16, 4 },
+  { 161, 61, 5184, 11584, 38, -54, -12, 25, 19, 102, 16, 4 },
+  { 161, 61, 5184, 11584, 38, -54, -12, 25, 19, 102, 16, 4 },
+  { 114, 66, 5184, 11584, 38, -54, -12, 25, 19, 102, 16, 4 },
+  { 114, 66, 14528, -1088, 38, -40, 11, 36, -53, 79, 16, 4 },
+  { 114, 81, 14528, -1088, 38, -40, 11, 36, -53, 79, 16, 4 },
+  { 81, 87, 5184, 13824, -83, -40, 11, 3, 19, 7, 16, 32 },
+  { 81, 87, 5184, 13824, -83, -40, 11, 3, 19, 7, 16, 32 },
+  { 57, 92, 5184, 13824, -83, -40, 11, 3, 19, 7, 16, 32 },
+  { 41, 102, 5184, 13824, -83, -40, 11, 3, 19, 7, 16, 32 },
+  { 20, 102, 5184, 9216, -56, -40, 11, 3, 7, 31, -24, 32 },
+  { 20, 102, 5184, 9216, -56, -40, 11, 3, 7, 31, -24, 32 },
+  { 20, 106, 5184, 9216, -56, -40, 11, 3, 7, 31, -24, 32 },
+  { 20, 110, 5184, 9216, -56, -40, 11, 3, 7, 31, -24, 32 },
+  { 20, 115, 5184, 9216, -56, -40, 11, 3, 7, 31, -24, 32 },
+  { 32, 115, 0, 6720, 25, -26, 11, 14, -17, 79, -4, 4 },
+  { 20, 115, 10048, 6720, 38, -12, -12, 25, -41, 79, 57, 4 },
+  { 0, 115, 10048, 6720, 38, -12, -12, 25, -41, 79, 57, 4 },
+  // Word 14
+  { 81, 69, -5184, -11200, 25, 71, 46, 3, -53, 7, 57, 59 },
+  { 114, 66, -10048, -13440, 11, 71, 46, 25, -53, 7, 57, 59 },
+  { 114, 61, -10048, -13440, 11, 71, 46, 25, -53, 7, 57, 59 },
+  { 114, 57, -10048, -13440, 11, 71, 46, 25, -53, 7, 57, 59 },
+  { 81, 57, -14528, -15552, 38, 71, 46, -20, -41, 7, 77, 77 },
+  { 81, 59, -14528, -15552, 38, 71, 46, -20, -41, 7, 77, 77 },
+  { 81, 77, -14528, -15552, 38, 71, 46, -20, -41, 7, 77, 77 },
+  { 81, 79, -14528, -15552, 38, 71, 46, -20, -41, 7, 77, 77 },
+  { 41, 92, -24256, -8768, 11, 85, 57, -31, -29, 7, 77, 59 },
+  { 20, 99, -28480, 6720, 38, 71, 11, -53, -29, 31, 57, 22 },
+  { 20, 106, -28480, 6720, 38, 71, 11, -53, -29, 31, 57, 22 },
+  { 15, 106, -28480, 6720, 38, 71, 11, -53, -29, 31, 57, 22 },
+  { 10, 110, -28480, 6720, 38, 71, 11, -53, -29, 31, 57, 22 },
+  { 15, 119, -28480, 6720, 38, 71, 11, -53, -29, 31, 57, 22 },
+  { 0, 119, -28480, 6720, 38, 71, 11, -53, -29, 31, 57, 22 },
+  // Word 15
+  { 5, 0, -24256, 6720, -2, -12, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, -5184, 27840, 25, 1, 0, 0, 0, 0, 0, 0 },
+  { 57, 57, -5184, 19648, -43, -82, -35, 25, 31, 55, 37, 4 },
+  { 81, 59, -5184, 13824, -97, -12, 23, 47, 67, 55, -44, 4 },
+  { 81, 59, 10048, 22656, -2, -82, -59, 36, 19, 102, 16, 4 },
+  { 81, 61, 10048, 22656, -2, -82, -59, 36, 19, 102, 16, 4 },
+  { 81, 66, 10048, 22656, -2, -82, -59, 36, 19, 102, 16, 4 },
+  { 57, 66, 10048, 21248, -2, -82, -82, 47, 31, 102, 37, 4 },
+  { 57, 71, 10048, 21248, -2, -82, -82, 47, 31, 102, 37, 4 },
+  { 57, 71, 14528, 11584, -29, -82, -59, 80, 43, 79, 37, 4 },
+  { 57, 79, 14528, 11584, -29, -82, -59, 80, 43, 79, 37, 4 },
+  { 57, 85, 14528, 11584, -29, -82, -59, 80, 43, 79, 37, 4 },
+  { 41, 99, 14528, 11584, -29, -82, -59, 80, 43, 79, 37, 4 },
+  { 41, 106, 14528, 11584, -29, -82, -59, 80, 43, 79, 37, 4 },
+  { 32, 119, 14528, 11584, -29, -82, -59, 80, 43, 79, 37, 4 },
+  { 32, 119, 14528, 11584, -29, -82, -59, 80, 43, 79, 37, 4 },
+  { 20, 123, 14528, 11584, -29, -82, -59, 80, 43, 79, 37, 4 },
+  { 0, 123, 14528, 11584, -29, -82, -59, 80, 43, 79, 37, 4 },
+  // Word 16
+  { 15, 0, 10048, 24000, -29, -54, 0, 0, 0, 0, 0, 0 },
+  { 20, 0, 10048, 24000, -29, -54, 0, 0, 0, 0, 0, 0 },
+  { 20, 0, 10048, 24000, -29, -54, 0, 0, 0, 0, 0, 0 },
+  { 81, 59, 10048, 21248, -29, -54, -70, 36, 19, 102, 37, 22 },
+  { 114, 59, 10048, 21248, -29, -54, -70, 36, 19, 102, 37, 22 },
+  { 161, 59, 5184, 15936, 11, -40, -59, 36, -53, 79, 57, 22 },
+  { 161, 63, 5184, 15936, 11, -40, -59, 36, -53, 79, 57, 22 },
+  { 114, 66, 5184, 15936, 11, -40, -59, 36, -53, 79, 57, 22 },
+  { 114, 69, -14528, -1088, -16, 1, 23, 36, -65, 55, 57, 4 },
+  { 114, 71, -14528, -1088, -16, 1, 23, 36, -65, 55, 57, 4 },
+  { 57, 81, -28480, 6720, 25, 15, 11, 25, -53, 79, 77, 4 },
+  { 41, 87, -28480, 6720, 25, 15, 11, 25, -53, 79, 77, 4 },
+  { 20, 95, -28480, 6720, 25, 15, 11, 25, -53, 79, 77, 4 },
+  { 32, 102, -28480, 6720, 25, 15, 11, 25, -53, 79, 77, 4 },
+  { 20, 106, -29376, 17856, -2, 29, 34, -53, -29, 79, 57, 22 },
+  { 15, 110, -29376, 17856, -2, 29, 34, -53, -29, 79, 57, 22 },
+  { 15, 119, -29376, 17856, -2, 29, 34, -53, -29, 79, 57, 22 },
+  { 0, 119, -29376, 17856, -2, 29, 34, -53, -29, 79, 57, 22 },
+  // Word 17
+  { 114, 57, -18368, -1088, 65, 43, 23, 36, -41, 55, 57, 22 },
+  { 161, 71, -18368, -1088, 65, 43, 23, 36, -41, 55, 57, 22 },
+  { 161, 69, -18368, -1088, 65, 43, 23, 36, -41, 55, 57, 22 },
+  { 161, 66, -18368, -1088, 65, 43, 23, 36, -41, 55, 57, 22 },
+  { 161, 63, -18368, -1088, 65, 43, 23, 36, -41, 55, 57, 22 },
+  { 81, 69, -21632, 17856, 65, -26, 34, 58, -53, 79, 57, -15 },
+  { 81, 71, -21632, 17856, 65, -26, 34, 58, -53, 79, 57, -15 },
+  { 57, 85, -21632, 15936, 65, -40, 11, 91, -65, 55, 77, 4 },
+  { 57, 92, -21632, 15936, 65, -40, 11, 91, -65, 55, 77, 4 },
+  { 57, 99, -21632, 15936, 65, -40, 11, 91, -65, 55, 77, 4 },
+  { 41, 102, -18368, 9216, 79, -40, -59, 102, -53, 31, 77, 32 },
+  { 32, 106, -21632, 22656, 38, -82, -1, 102, -53, 55, 57, 22 },
+  { 20, 110, -21632, 22656, 38, -82, -1, 102, -53, 55, 57, 22 },
+  { 0, 110, -21632, 22656, 38, -82, -1, 102, -53, 55, 57, 22 },
+  // Word 18
+  { 114, 87, -5184, 21248, -29, -12, 11, 3, 67, 79, -4, 22 },
+  { 161, 69, -5184, 21248, -29, -12, 11, 3, 67, 79, -4, 22 },
+  { 161, 69, -5184, 21248, -29, -12, 11, 3, 67, 79, -4, 22 },
+  { 161, 66, -5184, 21248, -29, -12, 11, 3, 67, 79, -4, 22 },
+  { 161, 66, -5184, 21248, -29, -12, 11, 3, 67, 79, -4, 22 },
+  { 161, 79, -10048, 13824, -2, -12, 34, -42, 79, 79, 16, 22 },
+  { 114, 92, -10048, 13824, -2, -12, 34, -42, 79, 79, 16, 22 },
+  { 81, 99, -10048, 19648, -43, 43, -35, -9, 90, 7, 16, 4 },
+  { 57, 106, 5184, 19648, 11, -12, 23, -42, -41, 31, 37, -15 },
+  { 10, 0, 27968, 19648, 11, 1, 23, -42, -41, 31, 37, -15 },
+  { 15, 0, 27968, 19648, 11, 1, 23, -42, -41, 31, 37, -15 },
+  { 15, 0, 27968, 19648, 11, 1, 23, -42, -41, 31, 37, -15 },
+  { 7, 0, 27968, 19648, 11, 1, 23, -42, -41, 31, 37, -15 },
+  { 7, 0, 27968, 19648, 11, 1, 23, -42, -41, 31, 37, -15 },
+  { 5, 0, 27968, 19648, 11, 1, 23, -42, -41, 31, 37, -15 },
+  { 4, 0, 27968, 19648, 11, 1, 23, -42, -41, 31, 37, -15 },
+  { 4, 0, 27968, 19648, 11, 1, 23, -42, -41, 31, 37, -15 },
+  { 2, 0, 27968, 19648, 11, 1, 23, -42, -41, 31, 37, -15 },
+  { 0, 0, 27968, 19648, 11, 1, 23, -42, -41, 31, 37, -15 },
+  // Word 19
+  { 20, 0, 18368, 9216, 38, 15, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, 26368, 15936, 38, 85, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, 14528, 24000, 52, -12, 0, 0, 0, 0, 0, 0 },
+  { 81, 59, 10048, 11584, 11, -54, -70, 3, 7, 79, 16, 22 },
+  { 161, 59, 5184, 21248, -56, -54, -47, 36, 43, 79, -4, 22 },
+  { 81, 59, 10048, 22656, -2, -82, -59, 36, 19, 102, 16, 4 },
+  { 81, 59, 10048, 22656, -2, -82, -59, 36, 19, 102, 16, 4 },
+  { 81, 59, 10048, 22656, -2, -82, -59, 36, 19, 102, 16, 4 },
+  { 57, 61, 10048, 22656, -2, -82, -59, 36, 19, 102, 16, 4 },
+  { 57, 71, 10048, 22656, -2, -82, -59, 36, 19, 102, 16, 4 },
+  { 57, 79, 10048, 22656, -2, -82, -59, 36, 19, 102, 16, 4 },
+  { 41, 85, 10048, 22656, -2, -82, -59, 36, 19, 102, 16, 4 },
+  { 57, 95, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 41, 102, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 41, 106, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 41, 115, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 41, 119, 14528, 17856, -16, -68, -70, 47, 43, 79, 16, 4 },
+  { 32, 123, 14528, 17856, -16, -68, -70, 47, 43, 79, 16, 4 },
+  { 0, 123, 14528, 17856, -16, -68, -70, 47, 43, 79, 16, 4 },
+  // Word 20
+  { 20, 79, 10048, -6272, -83, -12, -59, 36, 67, 79, -24, -15 },
+  { 81, 73, 18368, 15936, -43, -12, -82, -20, 19, 102, 16, 4 },
+  { 81, 69, 18368, 15936, -43, -12, -82, -20, 19, 102, 16, 4 },
+  { 81, 66, 18368, 15936, -43, -12, -82, -20, 19, 102, 16, 4 },
+  { 161, 63, 0, 15936, -2, -40, -47, 14, -53, 79, 57, 22 },
+  { 161, 63, 0, 15936, -2, -40, -47, 14, -53, 79, 57, 22 },
+  { 161, 63, -5184, 1536, -43, -54, -12, 58, -29, 79, 77, 22 },
+  { 161, 66, -5184, 1536, -43, -54, -12, 58, -29, 79, 77, 22 },
+  { 114, 79, -21632, -3712, -16, 1, 23, 36, -65, 55, 57, 4 },
+  { 57, 85, -21632, -3712, -16, 1, 23, 36, -65, 55, 57, 4 },
+  { 57, 92, -21632, -3712, -16, 1, 23, 36, -65, 55, 57, 4 },
+  { 20, 95, -28928, 1536, 52, 1, 34, 3, -77, 102, 37, 4 },
+  { 15, 106, -28928, 1536, 52, 1, 34, 3, -77, 102, 37, 4 },
+  { 10, 110, -30016, 1536, 52, 15, 46, 3, -65, 55, 37, 59 },
+  { 7, 119, -30336, 11584, 79, -12, 11, -20, -41, 79, 16, 22 },
+  { 0, 119, -30336, 11584, 79, -12, 11, -20, -41, 79, 16, 22 },
+  // Word 21
+  { 10, 92, -27968, -1088, -29, -40, 23, 25, -17, 31, 57, 22 },
+  { 10, 92, -27968, -1088, -29, -40, 23, 25, -17, 31, 57, 22 },
+  { 20, 87, -5184, 4160, -16, -26, -47, 25, -41, 7, 37, 32 },
+  { 20, 87, 5184, 11584, -2, -40, -35, 3, -29, 7, 37, 4 },
+  { 32, 85, 5184, 9216, 38, 15, -24, -31, -41, -16, 37, 22 },
+  { 81, 77, 0, 13824, -2, -26, -47, 3, -41, 31, 57, 22 },
+  { 161, 63, 10048, 17856, 38, -26, -82, 14, -29, 79, 37, 22 },
+  { 161, 53, 10048, 17856, 38, -26, -82, 14, -29, 79, 37, 22 },
+  { 114, 51, 14528, 21248, 25, -68, -82, 14, 7, 102, 37, 22 },
+  { 114, 51, 14528, 21248, 25, -68, -82, 14, 7, 102, 37, 22 },
+  { 114, 49, 14528, 21248, 25, -68, -82, 14, 7, 102, 37, 22 },
+  { 114, 53, 14528, 21248, 25, -68, -82, 14, 7, 102, 37, 22 },
+  { 114, 59, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 81, 66, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 57, 77, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 57, 81, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 41, 92, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 41, 95, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 41, 99, 14528, 17856, 11, -82, -82, 47, 43, 79, 16, 4 },
+  { 41, 106, 10048, 22656, 38, -54, -82, 3, 7, 79, 37, 22 },
+  { 41, 106, 10048, 22656, 38, -54, -82, 3, 7, 79, 37, 22 },
+  { 32, 119, 10048, 22656, 38, -54, -82, 3, 7, 79, 37, 22 },
+  { 32, 123, 10048, 22656, 38, -54, -82, 3, 7, 79, 37, 22 },
+  { 32, 123, 10048, 17856, 25, -68, -70, 36, 31, 102, 37, 22 },
+  { 0, 123, 10048, 17856, 25, -68, -70, 36, 31, 102, 37, 22 },
+  // Word 22
+  { 20, 63, 18368, -3712, -29, -26, -35, 25, -5, 7, 77, 22 },
+  { 161, 59, 5184, -3712, -2, 15, -35, 25, -29, 79, 37, 32 },
+  { 161, 57, -10048, -6272, 38, 43, -1, 25, -29, 55, 77, 22 },
+  { 161, 51, -10048, -6272, 38, 43, -1, 25, -29, 55, 77, 22 },
+  { 114, 51, -21632, -3712, 65, 43, -1, 14, -29, 55, 77, 4 },
+  { 57, 51, -21632, -6272, 38, 43, -24, 14, -29, 7, 37, -15 },
+  { 7, 63, -30336, -17536, 11, 71, -1, 14, -41, 7, 37, 4 },
+  { 81, 63, -10048, -13440, -2, 43, 23, 25, -41, 31, 57, 59 },
+  { 161, 69, -10048, -13440, -2, 43, 23, 25, -41, 31, 57, 59 },
+  { 114, 79, -10048, -13440, -2, 43, 23, 25, -41, 31, 57, 59 },
+  { 81, 81, -5184, -13440, 11, -12, -12, 36, -41, 79, 57, 4 },
+  { 81, 81, 5184, 6720, 11, -54, -70, 25, 19, 79, 57, 22 },
+  { 81, 85, 5184, 6720, 11, -54, -70, 25, 19, 79, 57, 22 },
+  { 57, 87, 5184, 6720, 11, -54, -70, 25, 19, 79, 57, 22 },
+  { 57, 87, -5184, 19648, -43, -54, -35, 36, 19, 79, 57, 4 },
+  { 57, 92, -5184, 19648, -43, -54, -35, 36, 19, 79, 57, 4 },
+  { 41, 95, -10048, 19648, -83, -26, -1, 14, 19, 102, 57, 4 },
+  { 41, 106, -14528, 15936, -56, -12, -1, 14, -5, 79, 57, -15 },
+  { 32, 115, -21632, 6720, -43, 15, 23, 25, -41, 55, 77, 22 },
+  { 20, 115, -21632, 6720, -43, 15, 23, 25, -41, 55, 77, 22 },
+  { 32, 123, -21632, 6720, -43, 15, 23, 25, -41, 55, 77, 22 },
+  { 10, 123, -28480, 15936, -2, 43, 34, -31, -41, 55, 77, 4 },
+  { 10, 128, -28480, 15936, -2, 43, 34, -31, -41, 55, 77, 4 },
+  { 0, 128, -28480, 15936, -2, 43, 34, -31, -41, 55, 77, 4 },
+  // Word 23
+  { 57, 79, -5184, 19648, -16, -26, -12, 36, 19, 79, 37, 4 },
+  { 161, 87, -5184, 19648, -16, -26, -12, 36, 19, 79, 37, 4 },
+  { 161, 85, -5184, 19648, 38, -40, -1, 25, 7, 79, 37, 4 },
+  { 161, 85, -5184, 19648, 38, -40, -1, 25, 7, 79, 37, 4 },
+  { 161, 92, -5184, 19648, 38, -40, -1, 25, 7, 79, 37, 4 },
+  { 161, 115, -5184, 27072, -2, -68, 23, 3, 19, 79, 37, 4 },
+  { 81, 119, -5184, 27072, -2, -68, 23, 3, 19, 79, 37, 4 },
+  { 20, 123, -5184, 26176, -29, -54, -1, 3, 7, 31, 37, 22 },
+  { 2, 18, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 18, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 18, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 18, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 7, 0, -10048, 21248, 52, 1, -1, -20, -29, -16, -4, 4 },
+  { 15, 0, -10048, 21248, 52, 1, -1, -20, -29, -16, -4, 4 },
+  { 7, 0, -10048, 21248, 52, 1, -1, -20, -29, -16, -4, 4 },
+  { 10, 0, 27968, 25152, 52, 1, -1, -20, -29, -16, -4, 4 },
+  { 15, 0, 27968, 25152, 52, 1, -1, -20, -29, -16, -4, 4 },
+  { 15, 0, 27968, 25152, 52, 1, -1, -20, -29, -16, -4, 4 },
+  { 10, 0, 27968, 25152, 52, 1, -1, -20, -29, -16, -4, 4 },
+  { 7, 0, 27968, 25152, 52, 1, -1, -20, -29, -16, -4, 4 },
+  { 4, 0, 27968, 25152, 52, 1, -1, -20, -29, -16, -4, 4 },
+  { 0, 0, 27968, 25152, 52, 1, -1, -20, -29, -16, -4, 4 },
+  // Word 24
+  { 7, 85, -28928, -3712, 38, 85, 46, -9, -53, 31, 37, 22 },
+  { 10, 85, -28928, -3712, 38, 85, 46, -9, -53, 31, 37, 22 },
+  { 32, 73, -28928, -3712, 38, 85, 46, -9, -53, 31, 37, 22 },
+  { 81, 66, -14528, -1088, 25, 71, 57, 14, -65, 31, 57, 32 },
+  { 161, 63, -14528, -1088, 25, 71, 57, 14, -65, 31, 57, 32 },
+  { 161, 61, -14528, 1536, 65, 43, 34, 36, -29, 79, 37, 22 },
+  { 161, 61, -14528, 1536, 65, 43, 34, 36, -29, 79, 37, 22 },
+  { 161, 61, -14528, 1536, 65, 43, 34, 36, -29, 79, 37, 22 },
+  { 161, 66, -14528, 1536, 65, 43, 34, 36, -29, 79, 37, 22 },
+  { 114, 69, -14528, 1536, 65, 43, 34, 36, -29, 79, 37, 22 },
+  { 114, 69, -14528, 1536, 65, 43, 34, 36, -29, 79, 37, 22 },
+  { 114, 73, -14528, 13824, 38, 1, 34, 3, 7, 102, 37, 22 },
+  { 114, 85, -14528, 13824, 38, 1, 34, 3, 7, 102, 37, 22 },
+  { 81, 85, -5184, 4160, 25, -26, 23, 69, -17, 102, 57, 4 },
+  { 57, 92, -5184, 4160, 25, -26, 23, 69, -17, 102, 57, 4 },
+  { 57, 92, 0, 17856, -2, -26, -12, 14, -29, 102, 16, 4 },
+  { 57, 92, 0, 17856, -2, -26, -12, 14, -29, 102, 16, 4 },
+  { 57, 99, 0, 17856, -2, -26, -12, 14, -29, 102, 16, 4 },
+  { 41, 102, 5184, 22656, 25, -54, -35, 14, -29, 102, 16, 4 },
+  { 41, 106, 5184, 22656, 25, -54, -35, 14, -29, 102, 16, 4 },
+  { 32, 106, 5184, 22656, 25, -54, -35, 14, -29, 102, 16, 4 },
+  { 32, 106, 5184, 22656, 25, -54, -35, 14, -29, 102, 16, 4 },
+  { 0, 106, 5184, 22656, 25, -54, -35, 14, -29, 102, 16, 4 },
+  // Word 25
+  { 57, 85, 27968, 6720, -29, 15, -24, -9, -41, -16, 37, 59 },
+  { 57, 85, 27968, 6720, -29, 15, -24, -9, -41, -16, 37, 59 },
+  { 10, 0, 27968, 6720, -29, 15, -24, -9, -41, -16, 37, 59 },
+  { 114, 85, 27968, 6720, -29, 15, -24, -9, -41, -16, 37, 59 },
+  { 114, 66, 21632, 1536, 38, -26, -24, -20, -53, 7, 77, 32 },
+  { 114, 66, 5184, 24000, -16, -54, -47, -9, 7, 102, 37, 22 },
+  { 114, 59, 5184, 24000, -16, -54, -47, -9, 7, 102, 37, 22 },
+  { 114, 57, 5184, 24000, -16, -54, -47, -9, 7, 102, 37, 22 },
+  { 114, 57, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 81, 61, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 81, 61, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 81, 77, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 81, 85, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 81, 92, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 57, 99, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 57, 99, 10048, 21248, 11, -82, -70, 25, 43, 79, 16, 4 },
+  { 41, 102, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 41, 102, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 41, 106, 14528, 22656, 25, -68, -82, 14, 31, 79, 37, 22 },
+  { 32, 110, 14528, 15936, 11, -82, -82, 58, 43, 79, 37, 4 },
+  { 32, 110, 14528, 15936, 11, -82, -82, 58, 43, 79, 37, 4 },
+  { 0, 110, 14528, 15936, 11, -82, -82, 58, 43, 79, 37, 4 },
+};
+
+static const uint16_t bank_2_boundaries[] = {
+  0, 19, 37, 62, 72, 93, 112, 134, 160, 183, 205, 227,
+  244, 268, 289, 304, 322, 340, 354, 373, 392, 408, 433, 457,
+  479, 502, 524
+};
+
+static const LPCSpeechSynth::Frame bank_3_frames[] = {
+  // Word 0
+  { 81, 95, -10048, 15936, -2, -12, 34, 14, 19, 79, 16, 4 },
+  { 114, 71, -14528, 15936, 25, -12, 34, 25, 7, 79, 37, 22 },
+  { 114, 66, -14528, 11584, 38, 1, 23, 25, -17, 102, 37, 22 },
+  { 114, 63, -21632, 13824, 65, 29, 34, 14, -17, 102, 16, 22 },
+  { 114, 61, -18368, -3712, 92, 71, -24, 36, -41, 79, 37, 4 },
+  { 114, 63, -14528, -11200, 79, 85, -12, 25, -41, 55, 57, 22 },
+  { 114, 63, -21632, -3712, 79, 71, 11, 3, -53, 31, 57, 22 },
+  { 41, 69, -14528, -6272, 25, 71, 11, 3, -29, 7, 16, -15 },
+  { 5, 0, -10048, 6720, 25, 1, 11, 3, -29, 7, 16, -15 },
+  { 5, 0, -5184, 4160, 25, 29, 11, 3, -29, 7, 16, -15 },
+  { 5, 0, -5184, 6720, 11, 29, 11, 3, -29, 7, 16, -15 },
+  { 5, 0, 0, 4160, -16, 29, 11, 3, -29, 7, 16, -15 },
+  { 114, 69, -14528, -3712, 38, 57, -24, 14, -53, 55, 37, 22 },
+  { 114, 69, -10048, -6272, 38, 71, -24, 25, -41, 79, 77, 32 },
+  { 114, 95, -5184, -8768, 25, 71, -24, 25, -41, 79, 77, 32 },
+  { 114, 115, -5184, -8768, 25, 71, -12, 25, -41, 79, 57, 22 },
+  { 81, 106, -14528, 1536, 38, 29, 11, 14, -41, 79, 57, 4 },
+  { 41, 119, -14528, 1536, 38, 29, 11, 14, -41, 79, 57, 4 },
+  { 32, 123, -14528, 1536, 38, 29, 11, 14, -41, 79, 57, 4 },
+  { 0, 123, -14528, 1536, 38, 29, 11, 14, -41, 79, 57, 4 },
+  // Word 1
+  { 5, 0, -30592, -8768, -2, -12, 0, 0, 0, 0, 0, 0 },
+  { 20, 71, -29376, 4160, 65, -26, -35, 80, -29, 7, -4, 59 },
+  { 32, 69, -26368, 27840, -43, 1, -1, 58, -29, -40, 77, 59 },
+  { 81, 66, -24256, 26176, -2, -26, 46, 25, -17, -16, 16, 77 },
+  { 114, 63, -18368, 11584, 52, 29, 23, 14, -17, 79, 37, 4 },
+  { 114, 61, -18368, 11584, 52, 29, 23, 14, -17, 79, 37, 4 },
+  { 114, 61, -18368, 11584, 52, 29, 23, 14, -17, 79, 37, 4 },
+  { 81, 63, -18368, 11584, 52, 29, 23, 14, -17, 79, 37, 4 },
+  { 41, 71, -24256, 11584, 25, 29, 23, 14, -17, 79, 37, 4 },
+  { 20, 77, -24256, 11584, 25, 29, 23, 14, -17, 79, 37, 4 },
+  { 20, 81, 0, 13824, -2, -12, -12, 14, -17, -16, -4, 4 },
+  { 20, 81, 0, 13824, -2, -12, -12, 14, -17, -16, -4, 4 },
+  { 41, 81, -26368, 19648, 25, 43, -24, -9, -29, 79, 37, -15 },
+  { 81, 71, -10048, -13440, 25, 71, -1, 14, -29, 7, 77, 32 },
+  { 114, 81, -5184, -17536, 11, 57, 46, 25, -29, -16, 37, 77 },
+  { 81, 87, -5184, -17536, 11, 57, 46, 25, -29, -16, 37, 77 },
+  { 57, 92, -14528, -13440, 38, 57, 57, 14, -53, 7, 37, 77 },
+  { 57, 102, -14528, -13440, 38, 57, 57, 14, -53, 7, 37, 77 },
+  { 41, 102, -14528, -13440, 38, 57, 57, 14, -53, 7, 37, 77 },
+  { 20, 102, -27968, 13824, 38, 43, 11, -31, -29, 55, 77, 22 },
+  { 20, 110, -27968, 13824, 38, 43, 11, -31, -29, 55, 77, 22 },
+  { 20, 115, -27968, 13824, 38, 43, 11, -31, -29, 55, 77, 22 },
+  { 0, 115, -27968, 13824, 38, 43, 11, -31, -29, 55, 77, 22 },
+  // Word 2
+  { 10, 0, 18368, 25152, -2, 1, 0, 0, 0, 0, 0, 0 },
+  { 32, 0, 10048, 21248, 38, 15, 0, 0, 0, 0, 0, 0 },
+  { 32, 0, 10048, 21248, 38, 15, 0, 0, 0, 0, 0, 0 },
+  { 57, 45, -14528, 11584, 52, -26, -35, 80, -41, 7, 57, 59 },
+  { 57, 53, -14528, 13824, 65, 1, -35, 91, -65, 31, 77, 59 },
+  { 57, 54, -18368, 21248, 52, -40, -1, 91, -53, 55, 57, 22 },
+  { 81, 54, -18368, 21248, 38, -40, 11, 91, -53, 55, 57, 22 },
+  { 81, 57, -18368, 17856, 52, -12, -12, 91, -41, 31, 57, 59 },
+  { 81, 66, -24256, 15936, 52, 43, -1, 14, -5, 31, 37, 32 },
+  { 41, 81, -10048, -17536, 38, 85, -12, 47, -65, 31, 57, 22 },
+  { 32, 95, 5184, -19328, -2, 85, -35, -9, -5, 7, 57, 77 },
+  { 114, 102, -10048, -1088, 38, 1, -12, 25, -5, 79, 37, 4 },
+  { 81, 110, 5184, -6272, 38, -12, -47, 47, 7, 79, 57, 4 },
+  { 81, 115, 0, -1088, 11, -54, -12, 47, 19, 79, 57, 4 },
+  { 41, 119, 5184, 6720, 11, -54, -35, 36, 19, 79, 37, 4 },
+  { 32, 119, 5184, 6720, -2, -68, -47, 58, 31, 79, 57, 4 },
+  { 20, 123, 0, 9216, -16, -68, -24, 69, 31, 79, 37, 4 },
+  { 0, 123, 0, 9216, -16, -68, -24, 69, 31, 79, 37, 4 },
+  // Word 3
+  { 7, 0, -14528, -19328, -2, 1, 0, 0, 0, 0, 0, 0 },
+  { 114, 95, 5184, 13824, 11, -12, -24, -20, -41, 55, 57, 32 },
+  { 114, 71, 0, 4160, 25, -26, -35, 14, 7, 79, 57, 32 },
+  { 114, 63, 0, -6272, 52, 15, -24, 36, -5, 79, 57, 22 },
+  { 114, 63, -18368, -3712, 65, 43, 11, -9, 7, 55, 77, 4 },
+  { 114, 69, -18368, -8768, 65, 57, 23, -20, -5, 31, 77, 32 },
+  { 114, 69, -18368, -3712, -2, 71, 34, -20, -41, 31, 37, 22 },
+  { 41, 81, 10048, -1088, -70, 1, 34, 25, -17, -40, 16, 22 },
+  { 3, 0, -18368, -1088, -29, -26, 34, 25, -17, -40, 16, 22 },
+  { 15, 0, 14528, 1536, -43, 43, 34, 25, -17, -40, 16, 22 },
+  { 20, 0, 14528, 1536, 38, 1, 34, 25, -17, -40, 16, 22 },
+  { 114, 73, -10048, 6720, -2, 15, 11, 3, 7, 79, 57, 22 },
+  { 114, 85, -10048, 6720, -2, 15, 11, 3, 7, 79, 57, 22 },
+  { 81, 87, -5184, 1536, 25, 43, -1, 25, -29, 55, 57, 32 },
+  { 57, 87, -5184, 1536, 25, 43, -1, 25, -29, 55, 57, 32 },
+  { 81, 106, -10048, 1536, 52, 1, -1, 36, -29, 55, 57, 4 },
+  { 57, 110, -10048, 1536, 52, 1, -1, 36, -29, 55, 57, 4 },
+  { 0, 110, -10048, 1536, 52, 1, -1, 36, -29, 55, 57, 4 },
+  // Word 4
+  { 114, 57, -5184, 17856, 38, -40, -1, 36, -5, 79, 57, 4 },
+  { 161, 71, -5184, 17856, 38, -40, -1, 36, -5, 79, 57, 4 },
+  { 161, 69, -5184, 17856, 38, -40, -1, 36, -5, 79, 57, 4 },
+  { 161, 66, -5184, 17856, 38, -40, -1, 36, -5, 79, 57, 4 },
+  { 3, 61, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 61, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 61, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 20, 0, -14528, 15936, 65, -12, -1, -20, -29, -16, -4, 4 },
+  { 7, 0, -18368, 27840, 79, -12, -1, -20, -29, -16, -4, 4 },
+  { 41, 63, -24256, 6720, 25, -12, -12, 36, -17, 7, 57, 4 },
+  { 161, 71, -21632, 1536, 38, 29, 34, 14, -29, 31, 77, 77 },
+  { 114, 81, -21632, 1536, 38, 29, 34, 14, -29, 31, 77, 77 },
+  { 81, 81, -21632, 1536, 38, 29, 34, 14, -29, 31, 77, 77 },
+  { 81, 81, -18368, -3712, 25, 43, 46, 14, -29, 7, 57, 77 },
+  { 81, 92, -18368, -3712, 25, 43, 46, 14, -29, 7, 57, 77 },
+  { 81, 92, -18368, -3712, 25, 43, 46, 14, -29, 7, 57, 77 },
+  { 32, 95, -27968, 15936, 38, 43, 11, -31, -5, 31, 77, 32 },
+  { 32, 102, -27968, 15936, 38, 43, 11, -31, -5, 31, 77, 32 },
+  { 20, 110, -28480, 9216, 25, 43, 34, -9, -29, 7, 37, 22 },
+  { 20, 110, -28480, 9216, 25, 43, 34, -9, -29, 7, 37, 22 },
+  { 0, 110, -28480, 9216, 25, 43, 34, -9, -29, 7, 37, 22 },
+  // Word 5
+  { 3, 0, 5184, 9216, 25, 29, 0, 0, 0, 0, 0, 0 },
+  { 3, 0, 10048, 13824, 25, 29, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, 10048, 11584, 11, 15, 0, 0, 0, 0, 0, 0 },
+  { 81, 66, -24256, 17856, 25, 57, 11, -9, -41, 79, 16, 4 },
+  { 81, 66, -21632, 13824, 52, 43, 23, 3, -41, 79, 37, 22 },
+  { 81, 69, -21632, 19648, 38, 43, 11, -9, -17, 102, 16, 22 },
+  { 81, 69, -21632, 25152, 11, 43, 11, -20, 31, 79, 16, 4 },
+  { 81, 73, -21632, 26176, -16, 43, 23, -20, 31, 79, 37, -15 },
+  { 5, 0, -28480, 17856, -16, -54, 23, -20, 31, 79, 37, -15 },
+  { 5, 0, -28480, 17856, -16, -54, 23, -20, 31, 79, 37, -15 },
+  { 3, 0, -18368, 11584, -16, -40, 23, -20, 31, 79, 37, -15 },
+  { 4, 0, 26368, 6720, -16, -12, 23, -20, 31, 79, 37, -15 },
+  { 4, 0, 27968, 19648, 11, -26, 23, -20, 31, 79, 37, -15 },
+  { 7, 0, 27968, 25152, 25, -12, 23, -20, 31, 79, 37, -15 },
+  { 10, 0, 27968, 25152, 25, -12, 23, -20, 31, 79, 37, -15 },
+  { 2, 18, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 0, 18, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 5, 0, 5184, 6720, -83, 15, -24, -20, -53, 55, -4, -51 },
+  { 7, 0, 5184, 19648, 52, 57, -24, -20, -53, 55, -4, -51 },
+  { 20, 0, 5184, 9216, -2, 15, -24, -20, -53, 55, -4, -51 },
+  { 57, 69, -21632, 26176, -56, 43, -24, 14, -29, 55, 37, 22 },
+  { 57, 87, -24256, 26176, -16, 29, 11, 25, -53, 79, 37, 32 },
+  { 57, 110, -21632, 9216, 52, 57, -24, 58, -53, 79, 77, 32 },
+  { 57, 115, -18368, 11584, 52, 43, -1, 36, -41, 102, 57, 22 },
+  { 57, 133, -18368, 11584, 52, 29, -12, 36, -17, 79, 37, 22 },
+  { 57, 133, -18368, 11584, 52, 29, -12, 36, -17, 79, 37, 22 },
+  { 57, 149, -21632, 17856, 38, 15, -1, 36, 7, 102, 16, -15 },
+  { 20, 160, -24256, 26176, -29, 15, 34, 25, 55, 79, -24, 4 },
+  { 7, 160, -5184, 1536, -16, 29, 11, 25, 7, 55, 57, 32 },
+  { 2, 18, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 18, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 18, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 18, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 5, 0, 21632, -3712, -70, 29, -1, -20, -29, -16, -4, 4 },
+  { 10, 0, 14528, 9216, 52, 57, -1, -20, -29, -16, -4, 4 },
+  { 0, 0, 14528, 9216, 52, 57, -1, -20, -29, -16, -4, 4 },
+  // Word 6
+  { 7, 0, -24256, 15936, 38, -68, 0, 0, 0, 0, 0, 0 },
+  { 114, 63, -14528, -11200, 38, 57, 11, 36, -29, 7, 77, 77 },
+  { 161, 61, -14528, -11200, 38, 57, 11, 36, -29, 7, 77, 77 },
+  { 161, 57, -14528, -11200, 38, 57, 11, 36, -29, 7, 77, 77 },
+  { 114, 57, -18368, -13440, 79, 71, 46, -9, -41, 31, 77, 32 },
+  { 114, 57, -18368, -13440, 79, 71, 46, -9, -41, 31, 77, 32 },
+  { 114, 66, -18368, -13440, 79, 71, 46, -9, -41, 31, 77, 32 },
+  { 114, 77, -18368, -13440, 79, 71, 46, -9, -41, 31, 77, 32 },
+  { 81, 87, -18368, -13440, 79, 71, 46, -9, -41, 31, 77, 32 },
+  { 57, 95, -24256, 1536, 25, 85, 57, 3, -53, 7, 37, 22 },
+  { 41, 110, -24256, 1536, 25, 85, 57, 3, -53, 7, 37, 22 },
+  { 32, 115, -24256, 1536, 25, 85, 57, 3, -53, 7, 37, 22 },
+  { 10, 123, -24256, -1088, 11, 85, 57, 3, -53, 7, 37, 22 },
+  { 4, 123, -24256, -1088, 11, 85, 57, 3, -53, 7, 37, 22 },
+  { 3, 0, 10048, -11200, 11, 15, 57, 3, -53, 7, 37, 22 },
+  { 10, 0, 10048, -11200, 11, 15, 57, 3, -53, 7, 37, 22 },
+  { 15, 0, 10048, -1088, 11, 15, 57, 3, -53, 7, 37, 22 },
+  { 7, 0, 10048, -1088, 11, 15, 57, 3, -53, 7, 37, 22 },
+  { 5, 0, 10048, -1088, 11, 15, 57, 3, -53, 7, 37, 22 },
+  { 4, 0, 10048, -1088, 11, 15, 57, 3, -53, 7, 37, 22 },
+  { 0, 0, 10048, -1088, 11, 15, 57, 3, -53, 7, 37, 22 },
+  // Word 7
+  { 2, 0, -18368, 1536, -56, 1, 0, 0, 0, 0, 0, 0 },
+  { 2, 0, -14528, 6720, 38, 57, 0, 0, 0, 0, 0, 0 },
+  { 3, 0, -10048, -1088, 25, 71, 0, 0, 0, 0, 0, 0 },
+  { 81, 85, -5184, -11200, 25, 71, 46, 3, -53, 7, 57, 59 },
+  { 114, 77, -10048, -13440, 11, 71, 46, 25, -53, 7, 57, 59 },
+  { 114, 73, -10048, -13440, 11, 71, 46, 25, -53, 7, 57, 59 },
+  { 81, 73, -14528, -15552, 38, 71, 46, -20, -41, 7, 77, 77 },
+  { 57, 73, -14528, -15552, 38, 71, 46, -20, -41, 7, 77, 77 },
+  { 41, 81, -14528, -15552, 38, 71, 46, -20, -41, 7, 77, 77 },
+  { 2, 17, -30592, 15936, -16, 15, -35, -20, -29, -16, -4, 4 },
+  { 0, 17, -30592, 15936, -16, 15, -35, -20, -29, -16, -4, 4 },
+  { 0, 17, -30592, 15936, -16, 15, -35, -20, -29, -16, -4, 4 },
+  { 5, 0, 0, -11200, -43, 1, -35, -20, -29, -16, -4, 4 },
+  { 20, 0, -10048, 6720, -2, 1, -35, -20, -29, -16, -4, 4 },
+  { 20, 0, 10048, 1536, -29, 1, -35, -20, -29, -16, -4, 4 },
+  { 161, 66, -5184, 11584, -29, 1, -12, -31, 31, 79, 37, 22 },
+  { 161, 66, -10048, 13824, -16, 1, -24, -9, 43, 102, -4, 22 },
+  { 161, 66, -14528, 13824, -16, -12, -1, 3, 55, 79, 16, 4 },
+  { 161, 73, -14528, 13824, 11, 1, 11, 3, 31, 79, 16, 4 },
+  { 161, 77, -14528, 1536, 38, 15, 23, 14, -29, 102, 57, 4 },
+  { 161, 95, -14528, -1088, 65, 43, -1, 25, -41, 102, 37, 22 },
+  { 114, 115, -10048, -15552, 52, 85, 23, 25, -65, 55, 57, 22 },
+  { 41, 128, -21632, -11200, 52, 85, 34, 3, -65, 55, 37, 22 },
+  { 32, 133, -27968, 4160, 38, 85, 11, -42, -41, 79, 16, 22 },
+  { 15, 133, -27968, 4160, 38, 85, 11, -42, -41, 79, 16, 22 },
+  { 15, 133, -28480, 1536, 79, 57, 34, -53, -29, 55, 37, 22 },
+  { 0, 133, -28480, 1536, 79, 57, 34, -53, -29, 55, 37, 22 },
+  // Word 8
+  { 81, 69, 10048, 9216, -16, -40, -59, 36, 31, 79, 16, 4 },
+  { 81, 66, 10048, 15936, 38, -26, -70, 14, 7, 79, 37, 22 },
+  { 114, 66, 5184, 11584, 25, -26, -35, 3, -17, 102, -4, 22 },
+  { 114, 61, 5184, 11584, 25, -26, -35, 3, -17, 102, -4, 22 },
+  { 81, 57, 0, 11584, -97, 1, 23, 25, 31, 7, 16, 22 },
+  { 81, 57, 0, 11584, -97, 1, 23, 25, 31, 7, 16, 22 },
+  { 57, 57, -10048, 1536, -110, 43, 34, 25, 19, 7, 16, 22 },
+  { 15, 61, -10048, 1536, -110, 43, 34, 25, 19, 7, 16, 22 },
+  { 114, 71, 10048, 15936, 25, -26, -35, -42, -41, 79, 77, 4 },
+  { 114, 73, 10048, 13824, 25, -54, -70, 25, 7, 79, 57, 22 },
+  { 114, 73, 10048, 13824, 25, -54, -70, 25, 7, 79, 57, 22 },
+  { 114, 77, 10048, 13824, 25, -54, -70, 25, 7, 79, 57, 22 },
+  { 81, 87, -5184, 9216, -56, -26, 11, 36, 19, 102, 16, 4 },
+  { 81, 99, -10048, 9216, -2, -26, -12, 36, -5, 102, 37, 4 },
+  { 81, 106, -21632, 11584, -16, 15, 23, 36, 19, 79, 16, 4 },
+  { 57, 115, -18368, 13824, 11, 1, 11, 25, -5, 102, 37, -15 },
+  { 41, 123, -21632, 15936, 11, 15, 11, 14, -5, 102, 57, 4 },
+  { 32, 128, -18368, 19648, -2, 15, 11, -9, 19, 79, 37, 4 },
+  { 15, 133, -21632, 17856, 11, 15, 11, -9, 19, 79, 37, -15 },
+  { 0, 133, -21632, 17856, 11, 15, 11, -9, 19, 79, 37, -15 },
+  // Word 9
+  { 20, 110, 14528, 9216, -70, -54, -35, -9, 19, 31, 37, 32 },
+  { 20, 0, 18368, 17856, -2, -26, -35, -9, 19, 31, 37, 32 },
+  { 32, 0, 18368, 17856, -2, -26, -35, -9, 19, 31, 37, 32 },
+  { 81, 79, 10048, 26176, 65, -26, -59, -42, -17, 31, 37, 59 },
+  { 81, 73, -10048, 6720, -83, 1, -12, 36, -5, 79, 37, 22 },
+  { 81, 69, -18368, 9216, -56, 1, 11, 36, -41, 79, 37, 22 },
+  { 81, 69, -18368, 9216, -56, 1, 11, 36, -41, 79, 37, 22 },
+  { 57, 66, -14528, 1536, -29, 15, -24, 58, -41, 31, 37, 77 },
+  { 57, 69, 5184, 1536, -56, -26, -47, 80, -65, 7, 37, 32 },
+  { 114, 66, 0, 11584, -43, 1, -24, 3, -5, 31, 16, 32 },
+  { 114, 69, 0, 11584, -43, 1, -24, 3, -5, 31, 16, 32 },
+  { 114, 79, 0, 19648, 25, -68, -24, 14, -17, 79, 57, 32 },
+  { 114, 85, 0, 19648, 25, -68, -24, 14, -17, 79, 57, 32 },
+  { 114, 92, 0, 19648, 25, -68, -24, 14, -17, 79, 57, 32 },
+  { 114, 95, -5184, 13824, -2, -54, 23, 14, 19, 102, 57, 32 },
+  { 114, 110, -5184, 13824, -2, -54, 23, 14, 19, 102, 57, 32 },
+  { 114, 110, -5184, 11584, -2, -26, 46, 25, -5, 79, 57, 4 },
+  { 81, 119, -5184, 11584, -2, -26, 46, 25, -5, 79, 57, 4 },
+  { 57, 119, -5184, 11584, -2, -26, 46, 25, -5, 79, 57, 4 },
+  { 32, 128, -5184, 11584, -2, -26, 46, 25, -5, 79, 57, 4 },
+  { 2, 16, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 16, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 16, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 16, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 15, 0, 10048, 4160, 11, 29, -1, -20, -29, -16, -4, 4 },
+  { 20, 0, 14528, 6720, 65, 71, -1, -20, -29, -16, -4, 4 },
+  { 10, 0, 14528, 6720, 65, 71, -1, -20, -29, -16, -4, 4 },
+  { 5, 0, -14528, 13824, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 2, 0, -14528, 13824, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 0, -14528, 13824, 25, 15, -1, -20, -29, -16, -4, 4 },
+  // Word 10
+  { 10, 0, 0, -1088, -97, -40, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 0, -1088, -97, -40, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, 0, -1088, -97, -40, 0, 0, 0, 0, 0, 0 },
+  { 57, 45, 10048, 17856, -29, -68, -59, 58, 43, 102, 37, 32 },
+  { 81, 47, 10048, 17856, -29, -68, -59, 58, 43, 102, 37, 32 },
+  { 81, 45, 10048, 17856, -29, -68, -59, 58, 43, 102, 37, 32 },
+  { 81, 45, 10048, 11584, -43, -54, -59, 47, 7, 31, -4, 59 },
+  { 81, 49, 10048, 11584, -43, -54, -59, 47, 7, 31, -4, 59 },
+  { 114, 53, 14528, -6272, -29, 29, -24, 36, -53, 31, 57, 59 },
+  { 114, 79, 14528, -6272, -29, 29, -24, 36, -53, 31, 57, 59 },
+  { 114, 81, -10048, -6272, -16, 43, 57, 14, -53, 55, 77, 32 },
+  { 114, 92, -10048, -6272, -16, 43, 57, 14, -53, 55, 77, 32 },
+  { 114, 92, -14528, -8768, 11, 43, 34, 47, -41, 55, 77, 32 },
+  { 114, 99, -14528, -8768, 11, 43, 34, 47, -41, 55, 77, 32 },
+  { 57, 106, -21632, 6720, 25, 43, 46, -9, -53, 55, 77, 32 },
+  { 57, 106, -21632, 6720, 25, 43, 46, -9, -53, 55, 77, 32 },
+  { 41, 115, -27968, 17856, 25, 43, 46, -53, -17, 79, 37, 22 },
+  { 20, 115, -27968, 17856, 25, 43, 46, -53, -17, 79, 37, 22 },
+  { 20, 119, -27968, 17856, 25, 43, 46, -53, -17, 79, 37, 22 },
+  { 20, 123, -26368, 1536, 52, 57, 23, 25, -53, 7, 77, 32 },
+  { 15, 133, -21632, -3712, 52, 15, 34, 25, -53, -16, 77, 59 },
+  { 0, 133, -21632, -3712, 52, 15, 34, 25, -53, -16, 77, 59 },
+  // Word 11
+  { 20, 87, 14528, -19328, -83, 71, 34, -64, 7, 79, 37, 32 },
+  { 32, 87, 5184, -20992, -56, 85, -24, -64, 43, 55, 16, 32 },
+  { 57, 71, 18368, -8768, -56, 43, -47, 3, -5, 7, 57, 22 },
+  { 114, 61, 5184, 21248, -16, -40, -47, -9, 7, 102, 37, 22 },
+  { 114, 57, 5184, 21248, -16, -40, -47, -9, 7, 102, 37, 22 },
+  { 81, 53, 5184, 21248, -16, -40, -47, -9, 7, 102, 37, 22 },
+  { 81, 54, 0, 15936, -43, -68, -24, 58, 19, 79, -4, 4 },
+  { 57, 61, 0, 15936, -43, -68, -24, 58, 19, 79, -4, 4 },
+  { 41, 69, 0, 15936, -43, -68, -24, 58, 19, 79, -4, 4 },
+  { 57, 71, -18368, 1536, -70, -40, 46, 36, 7, 31, -4, 32 },
+  { 41, 71, -18368, 1536, -70, -40, 46, 36, 7, 31, -4, 32 },
+  { 41, 77, -18368, 1536, -70, -40, 46, 36, 7, 31, -4, 32 },
+  { 81, 77, -5184, -6272, 25, 43, 23, 47, -53, 55, 57, 4 },
+  { 114, 81, -5184, -6272, 25, 43, 23, 47, -53, 55, 57, 4 },
+  { 114, 106, -5184, -6272, 25, 43, 23, 47, -53, 55, 57, 4 },
+  { 81, 115, -18368, 1536, 65, 29, 23, 25, -17, 79, 37, -15 },
+  { 57, 128, -18368, 1536, 65, 29, 23, 25, -17, 79, 37, -15 },
+  { 41, 133, -18368, 1536, 65, 29, 23, 25, -17, 79, 37, -15 },
+  { 41, 133, -18368, 1536, 65, 29, 23, 25, -17, 79, 37, -15 },
+  { 0, 133, -18368, 1536, 65, 29, 23, 25, -17, 79, 37, -15 },
+  // Word 12
+  { 10, 106, -29376, -6272, -2, 15, 57, 36, -17, 31, -4, 22 },
+  { 20, 99, -29376, -6272, -2, 15, 57, 36, -17, 31, -4, 22 },
+  { 114, 87, -14528, -6272, 25, 43, 11, 3, -53, 31, 37, -15 },
+  { 161, 81, -10048, 1536, 79, 29, -24, 36, -5, 55, 57, 4 },
+  { 161, 77, -10048, 1536, 79, 29, -24, 36, -5, 55, 57, 4 },
+  { 161, 71, -10048, 9216, 65, -12, 11, 36, -5, 79, 37, 4 },
+  { 161, 66, -10048, 9216, 65, -12, 11, 36, -5, 79, 37, 4 },
+  { 114, 69, 0, 22656, -2, -54, 11, 14, 19, 79, 16, -15 },
+  { 114, 77, 0, 22656, -2, -54, 11, 14, 19, 79, 16, -15 },
+  { 41, 79, 5184, 26176, -16, -68, -12, 58, 31, 102, -4, 4 },
+  { 20, 81, 5184, 26176, -16, -68, -12, 58, 31, 102, -4, 4 },
+  { 2, 81, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 81, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 81, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 81, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 4, 0, -5184, 13824, -83, -54, -1, -20, -29, -16, -4, 4 },
+  { 15, 0, -5184, 22656, -2, -26, -1, -20, -29, -16, -4, 4 },
+  { 10, 0, -5184, 22656, -2, -26, -1, -20, -29, -16, -4, 4 },
+  { 5, 0, -18368, 11584, -56, -40, -1, -20, -29, -16, -4, 4 },
+  { 0, 0, -18368, 11584, -56, -40, -1, -20, -29, -16, -4, 4 },
+  // Word 13
+  { 10, 95, -14528, -3712, -110, 29, 69, 47, -17, 31, -4, 32 },
+  { 81, 92, 0, 4160, -2, -26, -1, 14, -41, 55, 37, 22 },
+  { 114, 63, -10048, -3712, 25, 43, -47, 25, -17, 79, 57, 22 },
+  { 114, 61, -14528, -8768, 11, 57, -12, 36, -41, 55, 57, 32 },
+  { 114, 61, -21632, -6272, 38, 71, -12, 14, -53, 55, 77, 32 },
+  { 57, 63, -24256, -3712, 52, 57, -12, 3, -41, 55, 77, 22 },
+  { 32, 66, -26368, 1536, 52, 57, -35, 14, -41, 55, 37, -15 },
+  { 20, 73, -21632, -3712, 25, 43, -24, 14, -53, 31, 16, 4 },
+  { 15, 81, 5184, -1088, -2, 1, -12, -9, -17, 7, -24, 4 },
+  { 57, 95, -5184, 1536, 25, 15, -12, -9, -29, -16, 16, 4 },
+  { 114, 63, -14528, 13824, 11, -26, -12, 25, -17, 55, 37, 4 },
+  { 114, 61, -14528, 11584, 25, -12, -12, 47, -17, 79, 37, 4 },
+  { 114, 61, -14528, 6720, 25, -12, -12, 58, -5, 55, 37, 4 },
+  { 114, 61, -18368, 13824, 25, 1, -12, 47, -5, 31, 37, 22 },
+  { 57, 61, -21632, 15936, -16, 1, 46, 3, -53, 7, -4, 22 },
+  { 41, 63, -21632, 17856, -83, 1, 46, 3, -17, -16, -4, 32 },
+  { 7, 81, -27968, 17856, -43, -12, 34, 25, -17, -40, -4, 59 },
+  { 4, 0, -27968, 6720, -2, 1, 34, 25, -17, -40, -4, 59 },
+  { 32, 87, -21632, 25152, -43, -54, 46, 47, -65, 102, 37, 22 },
+  { 41, 95, -14528, 15936, 65, -26, -70, 80, -65, 31, 77, 59 },
+  { 57, 110, -14528, 17856, 52, -40, -59, 80, -65, 55, 77, 59 },
+  { 32, 115, -14528, 19648, 52, -40, -59, 80, -53, 55, 77, 32 },
+  { 32, 123, -14528, 13824, 38, -54, -59, 91, -53, 79, 77, 59 },
+  { 32, 123, -14528, 21248, 11, -68, -24, 91, -53, 55, 57, 22 },
+  { 20, 123, -14528, 17856, 38, -68, -47, 91, -53, 79, 77, 22 },
+  { 0, 123, -14528, 17856, 38, -68, -47, 91, -53, 79, 77, 22 },
+  // Word 14
+  { 114, 81, -18368, -3712, 79, 43, 34, 25, -29, 55, 57, 4 },
+  { 161, 69, -18368, -3712, 79, 43, 34, 25, -29, 55, 57, 4 },
+  { 161, 61, -18368, -3712, 79, 43, 34, 25, -29, 55, 57, 4 },
+  { 161, 59, -21632, 11584, 38, 15, 57, -20, 7, 79, 16, 4 },
+  { 57, 57, -21632, 17856, -16, 57, 23, -42, 55, 7, -4, 4 },
+  { 10, 0, 21632, -20992, -70, 1, 23, -42, 55, 7, -4, 4 },
+  { 10, 0, 27968, 27840, -16, 1, 23, -42, 55, 7, -4, 4 },
+  { 15, 0, 27968, 27840, -16, 1, 23, -42, 55, 7, -4, 4 },
+  { 15, 0, 27968, 27840, -16, 1, 23, -42, 55, 7, -4, 4 },
+  { 15, 0, 24256, 13824, -43, 71, 23, -42, 55, 7, -4, 4 },
+  { 2, 16, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 0, 16, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 3, 0, -5184, 1536, 79, 57, -24, -20, -53, 55, -4, -51 },
+  { 10, 102, -5184, 1536, 79, 57, 11, 47, -17, 31, -4, 32 },
+  { 32, 77, -14528, 11584, 52, 43, -59, 3, -29, -16, 16, 32 },
+  { 57, 73, -18368, 19648, 25, -54, -12, 69, -41, 31, 77, 32 },
+  { 81, 77, -18368, 19648, 25, -54, -12, 69, -41, 31, 77, 32 },
+  { 81, 85, -18368, 19648, 25, -54, -12, 69, -41, 31, 77, 32 },
+  { 57, 95, -18368, 25152, -29, -68, 34, 58, -29, 55, 77, 4 },
+  { 81, 102, -18368, 25152, -29, -68, 34, 58, -29, 55, 77, 4 },
+  { 41, 106, -18368, 25152, -29, -68, 34, 58, -29, 55, 77, 4 },
+  { 41, 115, -18368, 25152, -29, -68, 34, 58, -29, 55, 77, 4 },
+  { 32, 123, -14528, 17856, 52, -68, -24, 69, 31, -16, 77, 32 },
+  { 32, 138, -14528, 17856, 52, -68, -24, 69, 31, -16, 77, 32 },
+  { 20, 143, -14528, 25152, 25, -54, -24, 69, -41, 31, 57, 22 },
+  { 0, 143, -14528, 25152, 25, -54, -24, 69, -41, 31, 57, 22 },
+  // Word 15
+  { 7, 0, -14528, 9216, -43, -40, 0, 0, 0, 0, 0, 0 },
+  { 57, 66, -14528, 1536, 25, 29, 11, 3, -29, 31, -4, -33 },
+  { 161, 66, -18368, 11584, 38, 43, 11, 3, -29, 79, 16, 22 },
+  { 161, 69, -18368, 11584, 52, 29, 23, 14, -17, 79, 37, 4 },
+  { 161, 69, -18368, 11584, 52, 29, 23, 14, -17, 79, 37, 4 },
+  { 81, 69, -18368, 11584, 52, 29, 23, 14, -17, 79, 37, 4 },
+  { 2, 17, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 17, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 17, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 4, 0, -29376, 13824, 11, 15, -1, -20, -29, -16, -4, 4 },
+  { 114, 79, -18368, 6720, 38, 29, 11, -9, -5, 79, 57, 4 },
+  { 161, 99, -18368, 6720, 38, 29, 11, -9, -5, 79, 57, 4 },
+  { 161, 102, -10048, -3712, 38, 43, 11, 14, -17, 55, 77, 22 },
+  { 81, 128, -18368, 4160, 65, 29, -1, 3, 7, 79, 77, 4 },
+  { 57, 160, -18368, 19648, 25, 29, 11, -20, 7, 79, -4, 4 },
+  { 41, 160, -18368, 19648, 25, 29, 11, -20, 7, 79, -4, 4 },
+  { 0, 160, -18368, 19648, 25, 29, 11, -20, 7, 79, -4, 4 },
+  // Word 16
+  { 4, 0, -24256, 13824, 52, 1, 0, 0, 0, 0, 0, 0 },
+  { 3, 0, -24256, 13824, 52, 1, 0, 0, 0, 0, 0, 0 },
+  { 41, 71, -26368, 17856, 11, 15, -12, 14, -29, 31, 57, 22 },
+  { 114, 77, -18368, 9216, -16, 43, 23, 36, -41, 55, 77, 32 },
+  { 114, 85, -18368, 9216, -16, 43, 23, 36, -41, 55, 77, 32 },
+  { 57, 85, -18368, 9216, -16, 43, 23, 36, -41, 55, 77, 32 },
+  { 32, 115, -29376, 1536, 11, 1, 69, 14, -17, 31, 16, 4 },
+  { 20, 115, -29376, 1536, 11, 1, 69, 14, -17, 31, 16, 4 },
+  { 81, 85, -10048, 17856, -56, 15, -1, 3, 7, 79, 57, 22 },
+  { 114, 79, -10048, 17856, -56, 15, -1, 3, 7, 79, 57, 22 },
+  { 161, 77, -10048, 15936, -56, 15, 23, 36, 31, 102, 16, 4 },
+  { 161, 77, -10048, 15936, -56, 15, 23, 36, 31, 102, 16, 4 },
+  { 114, 85, -10048, 15936, -56, 15, 23, 36, 31, 102, 16, 4 },
+  { 81, 99, -10048, 15936, -56, 15, 23, 36, 31, 102, 16, 4 },
+  { 57, 110, -5184, 21248, -16, -26, 11, 25, 31, 79, 57, -15 },
+  { 32, 119, -5184, 21248, -16, -26, 11, 25, 31, 79, 57, -15 },
+  { 2, 16, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 16, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 0, 16, -30592, 15936, 25, 15, -1, -20, -29, -16, -4, 4 },
+  { 5, 0, 0, 26176, 25, 1, -1, -20, -29, -16, -4, 4 },
+  { 7, 0, -10048, 22656, -83, -26, -1, -20, -29, -16, -4, 4 },
+  { 3, 0, -10048, 22656, -83, -26, -1, -20, -29, -16, -4, 4 },
+  { 0, 0, -10048, 22656, -83, -26, -1, -20, -29, -16, -4, 4 },
+  // Word 17
+  { 5, 66, -29696, 21248, -2, -40, 11, 47, -5, 7, -4, 77 },
+  { 10, 87, -29696, 21248, -2, -40, 11, 47, -5, 7, -4, 77 },
+  { 41, 81, -26368, 22656, -29, -12, -12, 47, 7, -16, 16, 77 },
+  { 161, 71, -24256, 13824, -29, 43, -1, 36, -5, -16, 16, 59 },
+  { 161, 63, 0, -13440, -16, 57, 23, 69, -53, -16, 57, 77 },
+  { 161, 57, -14528, -8768, 11, 71, 34, 36, -65, 31, 57, 22 },
+  { 114, 53, -14528, -8768, 11, 71, 34, 36, -65, 31, 57, 22 },
+  { 41, 53, -5184, 6720, -83, -26, 57, 3, -29, 7, -24, 59 },
+  { 57, 57, -5184, 6720, -83, -26, 57, 3, -29, 7, -24, 59 },
+  { 161, 61, -5184, 9216, -2, -12, -1, 25, -53, 79, 57, 4 },
+  { 114, 77, 10048, 11584, 38, -26, -82, 47, -17, 79, 77, 22 },
+  { 114, 77, 10048, 11584, 38, -26, -82, 47, -17, 79, 77, 22 },
+  { 114, 81, 10048, 11584, 38, -26, -82, 47, -17, 79, 77, 22 },
+  { 114, 87, 10048, 11584, 38, -26, -82, 47, -17, 79, 77, 22 },
+  { 114, 92, -10048, 1536, 11, -12, -24, 69, -5, 79, 57, 22 },
+  { 114, 99, -18368, 13824, -2, 15, 23, 3, -29, 79, 57, 4 },
+  { 41, 99, -24256, 15936, 11, 43, 34, -9, -17, 102, 77, 4 },
+  { 32, 106, -26368, 15936, 38, 43, 11, -31, -5, 31, 77, 32 },
+  { 32, 106, -26368, 15936, 38, 43, 11, -31, -5, 31, 77, 32 },
+  { 20, 110, -26368, 15936, 38, 43, 11, -31, -5, 31, 77, 32 },
+  { 15, 119, -26368, 9216, 25, 43, 34, -9, -29, 7, 37, 22 },
+  { 15, 119, -26368, 9216, 25, 43, 34, -9, -29, 7, 37, 22 },
+  { 0, 119, -26368, 9216, 25, 43, 34, -9, -29, 7, 37, 22 },
+  // Word 18
+  { 4, 0, 27968, 25152, 25, -12, 0, 0, 0, 0, 0, 0 },
+  { 7, 0, 27968, 25152, 25, -12, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 27968, 25152, 11, -12, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, 27968, 22656, 25, 1, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, 27968, 21248, 25, 1, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 27968, 21248, 25, 1, 0, 0, 0, 0, 0, 0 },
+  { 57, 53, 0, 11584, -43, -54, -24, 14, 7, 79, 37, 4 },
+  { 114, 57, 5184, 17856, -29, -68, -47, 36, 19, 79, 37, 4 },
+  { 81, 59, 5184, 17856, -29, -82, -47, 47, 55, 79, 57, -15 },
+  { 81, 61, 5184, 19648, -43, -68, -47, 58, 43, 79, 37, -15 },
+  { 81, 63, 5184, 13824, -43, -68, -35, 80, 31, 102, 16, 22 },
+  { 114, 66, 5184, 11584, -16, -54, -47, 69, 19, 102, 16, 4 },
+  { 161, 66, 5184, 6720, -2, -54, -35, 69, -5, 102, 37, 4 },
+  { 161, 63, -5184, 11584, 11, -40, -1, 69, -5, 102, 37, 4 },
+  { 161, 63, -14528, 15936, 11, -40, 23, 69, -29, 102, 37, 4 },
+  { 114, 61, -21632, 25152, -56, 1, 23, 58, -41, 79, 37, 22 },
+  { 81, 63, -21632, 26176, -56, 29, -1, 58, -53, 31, 77, 22 },
+  { 81, 71, -21632, 27840, -43, 29, -12, 58, -53, 31, 77, 22 },
+  { 81, 79, -21632, 24000, -29, 29, -24, 69, -53, 55, 77, 22 },
+  { 114, 99, -21632, 17856, -16, 43, -12, 36, -17, 31, 77, 22 },
+  { 161, 99, -18368, 11584, 52, 1, -1, 25, -17, 55, 77, 22 },
+  { 114, 106, -14528, 4160, 52, 15, -1, 36, -29, 79, 57, 4 },
+  { 81, 110, -21632, 17856, 38, -12, 11, 14, 7, 102, 37, -15 },
+  { 57, 119, -21632, 17856, 38, 1, 11, 3, 7, 79, 37, -15 },
+  { 41, 128, -18368, 17856, 11, 15, 34, -20, 7, 102, 37, -33 },
+  { 32, 133, -18368, 1536, 65, -12, 34, 25, -5, 79, 77, -33 },
+  { 41, 133, -18368, 15936, 25, -12, 34, -9, 19, 79, 37, -33 },
+  { 0, 133, -18368, 15936, 25, -12, 34, -9, 19, 79, 37, -33 },
+  // Word 19
+  { 15, 0, 18368, -6272, -43, 1, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, 18368, -6272, -43, 1, 0, 0, 0, 0, 0, 0 },
+  { 114, 47, -14528, 21248, -29, -12, -1, 25, 31, 55, -24, -15 },
+  { 114, 54, -10048, 19648, -16, -12, -1, 25, 19, 79, 16, 22 },
+  { 114, 57, -5184, 22656, -16, -12, -12, 36, 19, 79, -4, 4 },
+  { 114, 57, -5184, 21248, -29, -12, -1, 36, 31, 79, -4, -15 },
+  { 114, 57, -5184, 17856, -70, -12, 46, 58, -5, 31, -44, 4 },
+  { 57, 59, -10048, 9216, -83, 71, 23, 3, 7, -16, 37, 4 },
+  { 41, 63, -14528, 6720, -83, 85, -1, -9, -17, -16, 37, 4 },
+  { 15, 69, -24256, 1536, -83, 85, 11, 3, -29, 7, 16, 32 },
+  { 41, 81, -10048, 1536, -2, -40, -47, 36, -29, 79, 37, 4 },
+  { 81, 87, -10048, -8768, -2, 1, -35, 69, -17, 79, 77, 22 },
+  { 114, 87, -14528, -1088, 25, 1, -35, 47, -17, 55, 57, 32 },
+  { 81, 85, -18368, 1536, 38, 29, -35, 47, -29, 55, 57, 22 },
+  { 57, 99, -26368, 13824, 38, 29, -12, 36, -29, 55, 57, 4 },
+  { 32, 110, -26368, 17856, 25, 29, -12, 36, -29, 79, 77, 32 },
+  { 41, 119, -26368, 22656, 11, 29, -1, 25, -29, 55, 57, 4 },
+  { 20, 138, -26368, 25152, -2, 15, -12, 3, -29, 79, 37, 4 },
+  { 10, 138, -27968, 24000, 11, 15, -1, -9, -41, 102, 77, 4 },
+  { 7, 138, -27968, 15936, 25, 15, 23, 3, -41, 79, 77, 59 },
+  { 0, 138, -27968, 15936, 25, 15, 23, 3, -41, 79, 77, 59 },
+  // Word 20
+  { 20, 87, 21632, 9216, -56, -40, -59, -9, -5, 79, 57, 32 },
+  { 32, 85, 21632, 9216, -56, -40, -59, -9, -5, 79, 57, 32 },
+  { 57, 77, 21632, 6720, -43, 1, -82, -42, 19, 79, 37, 32 },
+  { 161, 73, 14528, 11584, 11, 1, -82, -20, 19, 31, 57, 77 },
+  { 161, 57, 0, 9216, -2, -40, -70, 36, -5, 31, 57, 77 },
+  { 114, 53, 0, 9216, -2, -40, -70, 36, -5, 31, 57, 77 },
+  { 57, 49, -14528, 6720, -56, 15, 23, 25, -41, 55, 57, 32 },
+  { 32, 49, -18368, 11584, -43, 15, -35, -31, 19, 55, -4, 59 },
+  { 57, 49, -18368, 11584, -43, 15, -35, -31, 19, 55, -4, 59 },
+  { 161, 51, -14528, 4160, -2, 29, 11, -9, -29, 79, 57, 4 },
+  { 114, 57, -14528, 4160, -2, 29, 11, -9, -29, 79, 57, 4 },
+  { 57, 63, -14528, 4160, -2, 29, 11, -9, -29, 79, 57, 4 },
+  { 4, 0, -5184, 13824, 25, -12, 11, -9, -29, 79, 57, 4 },
+  { 7, 0, -5184, 13824, 25, -12, 11, -9, -29, 79, 57, 4 },
+  { 7, 0, -5184, 13824, 25, -12, 11, -9, -29, 79, 57, 4 },
+  { 7, 0, -5184, 13824, 25, -12, 11, -9, -29, 79, 57, 4 },
+  { 41, 69, -26368, 4160, 65, 71, 11, 3, -41, 7, 57, 77 },
+  { 114, 69, -26368, 4160, 65, 71, 11, 3, -41, 7, 57, 77 },
+  { 114, 77, -26368, 4160, 65, 71, 11, 3, -41, 7, 57, 77 },
+  { 161, 79, -18368, -3712, 65, 71, -24, 36, -17, 7, 57, 32 },
+  { 161, 85, -18368, -3712, 65, 71, -24, 36, -17, 7, 57, 32 },
+  { 114, 87, -14528, 1536, 65, 29, -35, 69, -29, 7, 57, 59 },
+  { 81, 102, -14528, 1536, 65, 29, -35, 69, -29, 7, 57, 59 },
+  { 57, 115, -18368, 11584, 38, -12, -12, 69, -41, 55, 77, 32 },
+  { 41, 110, -18368, 19648, 11, -12, -1, 58, -41, 55, 57, 4 },
+  { 15, 110, -21632, 13824, -16, -40, 34, -9, -29, -16, 16, 32 },
+  { 10, 115, -21632, -3712, -2, -54, 11, 14, -5, 31, 16, 32 },
+  { 15, 115, -5184, -3712, 11, -40, 23, -9, -29, -16, -24, 22 },
+  { 20, 119, -5184, -3712, 11, -40, 23, -9, -29, -16, -24, 22 },
+  { 15, 119, -5184, -3712, 11, -40, 23, -9, -29, -16, -24, 22 },
+  { 20, 123, -5184, 9216, 38, 29, -1, 25, -53, 31, 37, 4 },
+  { 20, 123, -5184, 9216, 38, 29, -1, 25, -53, 31, 37, 4 },
+  { 0, 123, -5184, 9216, 38, 29, -1, 25, -53, 31, 37, 4 },
+  // Word 21
+  { 15, 87, -5184, -1088, -43, -12, -24, 3, 7, 7, 37, 22 },
+  { 7, 102, -10048, -6272, -43, -12, -24, -20, 19, 7, 37, 22 },
+  { 15, 102, 10048, 13824, -16, 1, -24, 3, -29, -40, -4, 22 },
+  { 41, 102, 10048, 11584, 11, 1, 11, -9, -41, -16, 16, 32 },
+  { 114, 53, -5184, 11584, 11, 1, -35, 25, -29, 79, 57, 22 },
+  { 114, 54, 0, 9216, 25, -26, -35, 36, -17, 79, 37, 4 },
+  { 114, 57, 0, 15936, -2, -68, -12, 25, -5, 79, 37, 4 },
+  { 0, 57, 0, 15936, -2, -68, -12, 25, -5, 79, 37, 4 },
+  { 4, 0, -10048, -6272, -70, -68, -12, 25, -5, 79, 37, 4 },
+  { 2, 16, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 0, 16, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 0, 16, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 0, 16, 10048, -3712, 25, -12, -24, -20, -53, 55, -4, -51 },
+  { 7, 0, 10048, 19648, -56, 43, -24, -20, -53, 55, -4, -51 },
+  { 15, 0, 10048, 9216, -56, 15, -24, -20, -53, 55, -4, -51 },
+  { 41, 85, -14528, 21248, -29, -40, -35, 58, -29, 55, 57, 22 },
+  { 57, 87, -18368, 17856, 25, -68, -47, 91, -17, 31, 77, 77 },
+  { 41, 102, -14528, 22656, 38, -54, -47, 80, -53, 31, 77, 59 },
+  { 57, 106, -14528, 22656, 38, -54, -47, 80, -41, 31, 57, 59 },
+  { 32, 106, -14528, 24000, 65, -26, -70, 69, -41, 7, 77, 77 },
+  { 41, 110, -14528, 27072, 38, -54, -35, 58, -53, 31, 77, 59 },
+  { 41, 115, -14528, 26176, 25, -68, -24, 47, -29, 7, 77, 22 },
+  { 15, 119, -14528, 30080, -56, -40, 23, 14, -29, 55, 57, -15 },
+  { 0, 119, -14528, 30080, -56, -40, 23, 14, -29, 55, 57, -15 },
+  // Word 22
+  { 3, 0, -24256, 11584, 25, 1, 0, 0, 0, 0, 0, 0 },
+  { 4, 0, -24256, 11584, 25, 1, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, -24256, 11584, 25, 1, 0, 0, 0, 0, 0, 0 },
+  { 20, 47, -24256, 11584, 25, 1, 23, 14, -41, 7, 16, -15 },
+  { 81, 51, -18368, -1088, -2, 29, -1, 47, -77, 55, 57, 32 },
+  { 161, 49, -5184, 4160, -29, -26, -12, 69, -41, 79, 57, 32 },
+  { 161, 49, -5184, 4160, -29, -26, -12, 69, -41, 79, 57, 32 },
+  { 57, 53, -10048, 11584, -43, -26, 23, 14, 19, 102, 16, 22 },
+  { 10, 0, 27968, 25152, 25, 15, 23, 14, 19, 102, 16, 22 },
+  { 15, 0, 27968, 25152, 25, 15, 23, 14, 19, 102, 16, 22 },
+  { 15, 0, 27968, 25152, 25, 15, 23, 14, 19, 102, 16, 22 },
+  { 7, 0, 0, -1088, 79, 57, 23, 14, 19, 102, 16, 22 },
+  { 0, 0, 0, -1088, 79, 57, 23, 14, 19, 102, 16, 22 },
+  { 15, 0, 5184, 27072, -2, 15, 23, 14, 19, 102, 16, 22 },
+  { 10, 0, -26368, -1088, -56, 1, 23, 14, 19, 102, 16, 22 },
+  { 81, 73, 0, 22656, -43, -82, -24, 25, 31, 79, -4, 4 },
+  { 81, 73, 10048, 13824, 38, -54, -82, 36, 7, 79, 57, 22 },
+  { 81, 85, 10048, 13824, 38, -54, -82, 36, 7, 79, 57, 22 },
+  { 57, 106, 10048, 13824, 38, -54, -82, 36, 7, 79, 57, 22 },
+  { 32, 110, 10048, 19648, 38, -82, -70, 25, 7, 102, 57, 22 },
+  { 20, 119, 10048, 19648, 38, -82, -70, 25, 7, 102, 57, 22 },
+  { 32, 123, 5184, 24000, -43, -68, -47, 25, 31, 79, 16, 4 },
+  { 15, 138, 5184, 24000, -43, -68, -47, 25, 31, 79, 16, 4 },
+  { 15, 138, 5184, 29120, 38, -40, -35, -53, -5, 79, 37, 32 },
+  { 0, 138, 5184, 29120, 38, -40, -35, -53, -5, 79, 37, 32 },
+  // Word 23
+  { 114, 57, -10048, 13824, -29, -12, 34, 25, 67, 79, -4, 4 },
+  { 161, 53, -5184, 26176, -29, 15, -12, -9, 55, 55, 16, 22 },
+  { 161, 49, -5184, 22656, -43, -12, 34, 3, 55, 55, -4, 4 },
+  { 10, 0, -21632, 13824, -97, 71, 34, 3, 55, 55, -4, 4 },
+  { 3, 0, -5184, 19648, 52, -54, 34, 3, 55, 55, -4, 4 },
+  { 4, 0, -18368, 19648, 11, -26, 34, 3, 55, 55, -4, 4 },
+  { 15, 0, 26368, 6720, -16, -12, 34, 3, 55, 55, -4, 4 },
+  { 10, 0, 27968, 19648, 11, -26, 34, 3, 55, 55, -4, 4 },
+  { 15, 0, 27968, 25152, 25, -12, 34, 3, 55, 55, -4, 4 },
+  { 15, 0, 27968, 25152, 25, -12, 34, 3, 55, 55, -4, 4 },
+  { 7, 0, -29376, 15936, -29, -12, 34, 3, 55, 55, -4, 4 },
+  { 41, 59, -21632, 26176, -83, 43, -24, 47, -41, 55, 57, 32 },
+  { 81, 63, -21632, 26176, -56, 1, -12, 58, -29, 55, 57, 59 },
+  { 81, 66, -14528, 19648, -2, -12, -24, 58, -29, 79, 77, 59 },
+  { 81, 85, -5184, 1536, 25, 1, -47, 80, -5, 79, 77, 59 },
+  { 81, 87, 5184, 4160, 38, 15, -70, 47, -17, 79, 57, 22 },
+  { 81, 81, 0, 6720, 11, -26, -35, 58, 7, 79, 57, 4 },
+  { 81, 102, 5184, 4160, 11, -26, -59, 58, 19, 79, 37, 4 },
+  { 57, 102, 5184, 6720, 25, -40, -59, 58, 19, 102, 57, 4 },
+  { 57, 119, 0, 21248, -2, -54, -24, 14, 19, 102, 16, 22 },
+  { 20, 123, 0, 22656, -16, -68, -24, 14, 43, 79, -4, 4 },
+  { 20, 123, 0, 27840, -43, -12, -35, -31, 55, 79, -4, 32 },
+  { 0, 123, 0, 27840, -43, -12, -35, -31, 55, 79, -4, 32 },
+  // Word 24
+  { 15, 92, 0, -3712, -56, -40, -35, 80, 55, 55, -4, 4 },
+  { 32, 92, 5184, 4160, -43, -54, -70, 36, 67, 79, 16, -15 },
+  { 114, 92, 5184, 15936, -2, -54, -59, 3, 43, 79, 16, 4 },
+  { 114, 71, 5184, 21248, 25, -54, -35, -9, 19, 102, 37, 22 },
+  { 161, 66, 0, 19648, -16, -54, -1, 25, 43, 102, -4, 4 },
+  { 161, 63, 5184, 24000, 25, -54, -12, 14, 7, 102, 16, -15 },
+  { 114, 59, 5184, 24000, 25, -68, -12, 25, 19, 79, -24, -33 },
+  { 81, 59, 5184, 25152, -97, 15, -24, 58, 43, -16, -24, 22 },
+  { 15, 63, -21632, -1088, -83, 57, 34, -42, 19, 7, 37, 4 },
+  { 5, 79, -10048, 4160, -29, 71, 23, -42, -17, -16, -4, 22 },
+  { 15, 0, 18368, 17856, 11, -40, 23, -42, -17, -16, -4, 22 },
+  { 7, 0, 18368, 17856, 11, -40, 23, -42, -17, -16, -4, 22 },
+  { 32, 66, 10048, 24000, -2, -68, -35, -9, 31, 55, 37, 4 },
+  { 41, 71, 5184, 26176, -83, -40, -35, 25, 67, 79, 16, 4 },
+  { 41, 92, 5184, 25152, -29, -54, -59, 14, 43, 79, 16, 4 },
+  { 41, 92, 5184, 25152, -29, -54, -59, 14, 43, 79, 16, 4 },
+  { 32, 110, 5184, 27072, -83, -54, -35, 36, 79, 55, -4, 4 },
+  { 20, 115, 5184, 27072, -83, -54, -35, 36, 79, 55, -4, 4 },
+  { 15, 119, 5184, 27072, -83, -54, -35, 36, 79, 55, -4, 4 },
+  { 0, 119, 5184, 27072, -83, -54, -35, 36, 79, 55, -4, 4 },
+  // Word 25
+  { 57, 92, 27968, 13824, -29, -26, -12, -20, -5, -40, -4, 59 },
+  { 7, 0, 5184, -20992, -70, 57, -12, -20, -5, -40, -4, 59 },
+  { 15, 0, 5184, -20992, -70, 57, -12, -20, -5, -40, -4, 59 },
+  { 161, 57, 14528, 1536, -56, 15, -59, 47, -41, 31, 37, 59 },
+  { 161, 53, 14528, 1536, -56, 15, -59, 47, -41, 31, 37, 59 },
+  { 114, 51, 0, -11200, -56, 15, -24, 69, -41, 7, 16, 59 },
+  { 114, 51, 0, -11200, -56, 15, -24, 69, -41, 7, 16, 59 },
+  { 81, 53, 14528, 1536, -56, -26, -47, 80, -65, 7, 37, 32 },
+  { 57, 59, 14528, 1536, -56, -26, -47, 80, -65, 7, 37, 32 },
+  { 81, 71, 5184, -6272, -16, 15, -1, 25, -65, 55, 77, 59 },
+  { 114, 81, -14528, -1088, -16, 1, 23, -9, -29, 102, 57, 22 },
+  { 81, 87, -21632, 6720, -29, 15, 34, 3, -17, 55, 77, 22 },
+  { 41, 102, -21632, 6720, -29, 15, 34, 3, -17, 55, 77, 22 },
+  { 32, 115, -21632, 6720, -29, 15, 34, 3, -17, 55, 77, 22 },
+  { 20, 115, -26368, 9216, -29, 15, 57, -9, -29, 79, 77, 32 },
+  { 20, 123, -26368, 4160, 11, 15, -1, 36, -41, 31, 77, 22 },
+  { 20, 123, -26368, 4160, 11, 15, -1, 36, -41, 31, 77, 22 },
+  { 15, 143, -26368, 4160, 11, 15, -1, 36, -41, 31, 77, 22 },
+  { 0, 143, -26368, 4160, 11, 15, -1, 36, -41, 31, 77, 22 },
+};
+
+static const uint16_t bank_3_boundaries[] = {
+  0, 20, 43, 61, 79, 100, 136, 157, 184, 204, 234, 256,
+  276, 296, 322, 348, 365, 388, 411, 439, 460, 493, 517, 542,
+  565, 585, 604
+};
+
+static const LPCSpeechSynth::Frame bank_4_frames[] = {
+  // Word 0
+  { 161, 69, -10048, 17856, -43, 29, -1, 58, 19, -16, -24, 22 },
+  { 161, 66, -10048, 21248, -29, 15, -1, 25, 43, 7, -4, 22 },
+  { 161, 66, -10048, 17856, -43, 29, -1, 47, 31, -16, -4, 4 },
+  { 161, 61, -10048, 19648, -29, 1, -1, 25, 31, -16, -24, 4 },
+  { 161, 59, -10048, 13824, -43, 43, -12, 58, 19, -16, -4, 4 },
+  { 161, 59, -14528, 13824, -43, 15, -1, 25, 43, 7, -24, 22 },
+  { 161, 61, -18368, 6720, -56, 71, -24, 36, 19, -16, -4, 22 },
+  { 81, 63, -26368, 4160, -43, 71, -24, 25, -5, 7, 16, 22 },
+  { 57, 63, -27968, 4160, -43, 71, -35, 25, 19, 31, 16, 32 },
+  { 81, 66, -27968, 6720, -43, 71, -12, 3, -5, 7, 16, 22 },
+  { 114, 69, -27968, 9216, -2, 43, -12, -9, -5, 7, 16, 4 },
+  { 81, 73, -27968, 24000, -2, 29, -59, 3, 31, 31, 37, 4 },
+  { 81, 77, -27968, 24000, 11, 15, -47, -20, 31, 31, 16, 4 },
+  { 57, 77, -28928, 17856, 65, 1, -47, -20, 19, 79, -24, 32 },
+  { 57, 85, -28480, 6720, 79, 15, -47, -20, 7, 79, -4, 22 },
+  { 81, 85, -28928, 15936, 65, 15, -47, -31, 43, 55, -24, 22 },
+  { 161, 85, -24256, 11584, 65, 43, -24, -31, 31, 31, -24, 59 },
+  { 161, 87, -24256, 11584, 65, 43, -24, -42, 43, 79, -44, 4 },
+  { 161, 87, -24256, 15936, 65, 29, -24, -31, 43, 55, -24, 22 },
+  { 161, 87, -21632, 11584, 79, 29, -24, -31, 31, 79, -44, -15 },
+  { 161, 92, -21632, 15936, 79, 29, -12, -31, 31, 79, -44, 22 },
+  { 161, 92, -21632, 13824, 79, 29, -24, -20, 7, 79, -24, 4 },
+  { 161, 95, -24256, 22656, 65, -12, -12, 3, 7, 79, -24, 4 },
+  { 161, 95, -21632, 11584, 79, 29, -12, 3, -17, 79, -4, 4 },
+  { 161, 95, -14528, 6720, 52, 43, 11, -9, -29, 79, -4, 22 },
+  { 161, 102, -14528, 1536, 25, 29, 34, -9, -29, 79, -4, 4 },
+  { 161, 110, -14528, -1088, 11, -12, 34, -31, -29, 79, -4, 22 },
+  { 41, 115, -24256, 9216, -29, 1, 23, -64, 43, 79, -4, 32 },
+  { 7, 115, -31872, 19648, -16, 113, -35, -9, 7, 7, -4, 22 },
+  { 10, 115, -31872, 19648, 25, 85, 23, -31, -29, 31, -24, 4 },
+  { 7, 0, -28480, -3712, -70, 85, 23, -31, -29, 31, -24, 4 },
+  { 3, 0, -30592, -3712, -83, 113, 23, -31, -29, 31, -24, 4 },
+  { 0, 0, -30592, -3712, -83, 113, 23, -31, -29, 31, -24, 4 },
+  { 0, 0, -30592, -3712, -83, 113, 23, -31, -29, 31, -24, 4 },
+  { 0, 0, -30592, -3712, -83, 113, 23, -31, -29, 31, -24, 4 },
+  { 0, 0, -30592, -3712, -83, 113, 23, -31, -29, 31, -24, 4 },
+  // Word 1
+  { 4, 0, 10048, -1088, 38, 1, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, 21632, 1536, -2, 15, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, 21632, 4160, 11, 29, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, 26368, 15936, 11, 29, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, 27968, 9216, -16, 15, 0, 0, 0, 0, 0, 0 },
+  { 20, 0, 24256, 4160, -29, 15, 0, 0, 0, 0, 0, 0 },
+  { 41, 0, -10048, -13440, -43, 15, 0, 0, 0, 0, 0, 0 },
+  { 161, 71, -21632, 11584, -43, 15, 23, 14, 31, 31, -4, 4 },
+  { 161, 71, -21632, 17856, -56, 15, 34, 25, -5, 55, 16, -15 },
+  { 161, 73, -21632, 22656, -83, 15, 34, 14, -5, 55, 16, 4 },
+  { 161, 73, -21632, 22656, -70, -12, 57, 14, -41, 79, 16, 22 },
+  { 114, 77, -24256, 24000, -83, -12, 69, 3, -29, 79, -24, 22 },
+  { 81, 77, -18368, 27840, -97, 29, 57, -53, 19, 79, -44, 4 },
+  { 57, 81, -18368, 29120, -97, 15, 57, -42, 19, 79, -4, -15 },
+  { 3, 0, -30848, 19648, -97, 71, 57, -42, 19, 79, -4, -15 },
+  { 3, 0, -30016, 22656, -97, 57, 57, -42, 19, 79, -4, -15 },
+  { 0, 0, -30016, 22656, -97, 57, 57, -42, 19, 79, -4, -15 },
+  { 7, 0, -10048, 6720, -43, -26, 57, -42, 19, 79, -4, -15 },
+  { 10, 0, -26368, -1088, -56, 43, 57, -42, 19, 79, -4, -15 },
+  { 161, 87, 0, 9216, -70, -26, -1, 36, 31, 31, -24, 4 },
+  { 161, 92, -5184, 11584, -56, -26, -24, 36, 31, 55, -4, 22 },
+  { 161, 102, -5184, 9216, -56, -12, -12, 36, 31, 55, -24, 4 },
+  { 161, 106, -5184, 13824, -56, 1, -12, 36, 43, 55, -24, 32 },
+  { 161, 110, -10048, 13824, -70, 15, -1, 47, 43, 31, -44, 32 },
+  { 161, 110, -10048, 6720, -56, 1, 11, 25, 43, 55, -24, 4 },
+  { 161, 115, -10048, 6720, -43, -12, 11, 36, 43, 55, -44, 4 },
+  { 57, 106, -24256, -3712, -29, 57, 46, 36, -5, 7, -44, -15 },
+  { 3, 0, -28480, -15552, -2, 85, 46, 36, -5, 7, -44, -15 },
+  { 3, 0, 5184, -15552, -83, 57, 46, 36, -5, 7, -44, -15 },
+  { 57, 57, 18368, 13824, -29, -12, 11, 36, 19, 31, -4, -15 },
+  { 114, 57, 14528, 1536, -43, 1, -1, 36, 31, 31, -24, 4 },
+  { 10, 36, -5184, -3712, -2, -40, 46, 58, 43, 55, -4, -15 },
+  { 0, 36, -5184, -3712, -2, -40, 46, 58, 43, 55, -4, -15 },
+  { 0, 36, -5184, -3712, -2, -40, 46, 58, 43, 55, -4, -15 },
+  { 0, 36, -5184, -3712, -2, -40, 46, 58, 43, 55, -4, -15 },
+  { 0, 36, -5184, -3712, -2, -40, 46, 58, 43, 55, -4, -15 },
+  // Word 2
+  { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+  { 7, 0, -14528, 30080, -43, 29, 0, 0, 0, 0, 0, 0 },
+  { 7, 0, -21632, 29120, -83, 43, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, -18368, 30080, -16, -12, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, -21632, 6720, 65, -54, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, -24256, 4160, 38, -40, 0, 0, 0, 0, 0, 0 },
+  { 7, 0, -30016, 9216, 38, -12, 0, 0, 0, 0, 0, 0 },
+  { 57, 77, -29376, 15936, 65, 1, -24, -9, 31, 7, -4, 59 },
+  { 41, 77, -29376, 24000, 52, 1, -47, -9, 67, 7, -4, 22 },
+  { 57, 73, -28480, 25152, 25, -54, -12, -9, 55, 7, -24, 59 },
+  { 81, 73, -27968, 27072, -2, -12, -24, -9, 55, 7, 16, 22 },
+  { 114, 73, -24256, 27840, 11, 29, -35, 14, 79, -16, 16, 32 },
+  { 114, 79, -24256, 28544, -2, 43, -47, 36, 67, -16, 16, 4 },
+  { 161, 85, -24256, 27840, -2, 43, -47, 36, 55, -16, 16, 4 },
+  { 161, 92, -24256, 29120, -16, 57, -35, 58, 19, 7, 16, 22 },
+  { 114, 102, -24256, 29632, -16, 29, -1, 14, 43, -16, -4, 22 },
+  { 57, 115, -24256, 24000, -2, 43, -24, -31, 19, 7, -24, 22 },
+  { 57, 128, -18368, 19648, -2, 57, -1, -42, 19, 7, -24, 4 },
+  { 81, 160, -10048, 19648, -29, 85, 11, -31, 19, 31, -24, 4 },
+  { 10, 0, -26368, 13824, -56, -26, 11, -31, 19, 31, -24, 4 },
+  { 5, 0, -26368, 13824, -43, -54, 11, -31, 19, 31, -24, 4 },
+  { 3, 0, -26368, 15936, -56, -82, 11, -31, 19, 31, -24, 4 },
+  { 3, 0, -24256, 21248, -43, -54, 11, -31, 19, 31, -24, 4 },
+  { 3, 0, -28480, -6272, -16, -26, 11, -31, 19, 31, -24, 4 },
+  { 2, 49, -5184, -3712, -16, 1, 11, 47, 7, 31, 16, 4 },
+  { 41, 49, -10048, 25152, 38, -12, 11, 14, 7, 31, -4, 22 },
+  { 57, 49, -5184, 26176, 38, -54, -1, 14, 7, 55, -4, 22 },
+  { 7, 0, -14528, 19648, -29, -12, -1, 14, 7, 55, -4, 22 },
+  { 7, 0, -10048, 22656, -70, -26, -1, 14, 7, 55, -4, 22 },
+  { 4, 0, -14528, 17856, -70, -40, -1, 14, 7, 55, -4, 22 },
+  { 3, 0, -21632, 4160, -43, -54, -1, 14, 7, 55, -4, 22 },
+  { 3, 0, -24256, 6720, -56, -40, -1, 14, 7, 55, -4, 22 },
+  { 0, 0, -24256, 6720, -56, -40, -1, 14, 7, 55, -4, 22 },
+  { 0, 0, -24256, 6720, -56, -40, -1, 14, 7, 55, -4, 22 },
+  { 0, 0, -24256, 6720, -56, -40, -1, 14, 7, 55, -4, 22 },
+  { 0, 0, -24256, 6720, -56, -40, -1, 14, 7, 55, -4, 22 },
+  // Word 3
+  { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+  { 41, 51, -10048, 25152, 65, -26, 23, 36, 7, 31, -4, 22 },
+  { 161, 51, -5184, 15936, 79, -26, -12, 47, 7, 7, -24, 4 },
+  { 161, 59, -5184, 24000, 65, 1, -24, 3, -17, 31, 16, 32 },
+  { 161, 71, -10048, 15936, -43, -12, -1, -9, 7, 55, -4, -15 },
+  { 161, 79, -10048, 17856, -56, -12, -12, 25, 19, 31, -4, -15 },
+  { 161, 79, -10048, 15936, -56, -12, -24, 14, 19, 55, 16, 4 },
+  { 161, 79, -10048, 9216, -83, 15, -47, 25, 31, 31, 16, -33 },
+  { 114, 81, -24256, -1088, -83, 43, 11, 14, 43, 7, -4, 4 },
+  { 81, 79, -24256, 1536, -83, 57, -12, 25, 55, 7, 16, -15 },
+  { 81, 79, -26368, -1088, -70, 43, -24, 36, 67, -16, 16, -15 },
+  { 81, 79, -24256, 4160, -70, 15, -47, 69, 55, 7, 16, -15 },
+  { 57, 79, -27968, 1536, -56, 29, -24, 58, 79, -16, -4, 22 },
+  { 81, 79, -14528, 1536, -97, 1, -12, 36, 31, 31, 16, 32 },
+  { 20, 0, 10048, 22656, -56, -54, -12, 36, 31, 31, 16, 32 },
+  { 20, 0, 10048, 27840, 38, 29, -12, 36, 31, 31, 16, 32 },
+  { 32, 0, 10048, 26176, 52, 15, -12, 36, 31, 31, 16, 32 },
+  { 32, 0, 0, 26176, 11, 1, -12, 36, 31, 31, 16, 32 },
+  { 32, 0, 0, 24000, 11, 1, -12, 36, 31, 31, 16, 32 },
+  { 20, 0, -5184, 19648, -2, 29, -12, 36, 31, 31, 16, 32 },
+  { 161, 61, -5184, 15936, -2, 15, -24, -9, -17, -16, -4, 32 },
+  { 161, 61, -24256, 22656, -70, 29, -12, 25, -5, 7, 37, 32 },
+  { 161, 63, -24256, 26176, -56, 43, -12, 3, -29, 31, 37, 32 },
+  { 161, 69, -24256, 25152, -56, 71, -35, 3, -29, 55, 37, 4 },
+  { 114, 71, -26368, 27072, -29, 43, -35, 3, -17, 55, 37, -15 },
+  { 161, 77, -26368, 25152, 11, 29, -35, 3, -17, 55, 57, -15 },
+  { 161, 81, -26368, 22656, 38, 29, -24, -9, -29, 79, 37, -15 },
+  { 161, 85, -26368, 21248, 52, 29, -47, 14, -17, 79, 16, -33 },
+  { 114, 87, -26368, 19648, 65, 43, -59, 14, -17, 79, 37, -15 },
+  { 114, 87, -26368, 19648, 65, 43, -59, 14, -17, 79, 37, -15 },
+  { 81, 92, -27968, 24000, 52, 15, -59, 14, -5, 79, -4, -33 },
+  { 57, 95, -27968, 30080, -16, -26, -35, 47, 43, 55, -64, 4 },
+  { 57, 95, -28480, 30080, -2, -26, -35, 47, 31, 55, -64, -15 },
+  { 41, 99, -28480, 29632, -2, -54, -35, 69, 7, 31, -44, 4 },
+  { 41, 99, -27968, 26176, 52, 1, -70, 47, 7, 55, -44, -15 },
+  { 41, 102, -28480, 27840, 38, 1, -59, 14, 19, 55, -4, -33 },
+  { 32, 106, -28928, 25152, 52, -12, -82, 47, 19, 55, -4, -33 },
+  { 32, 106, -28928, 19648, 65, 29, -82, 3, 7, 79, -4, -15 },
+  { 32, 110, -29376, 17856, 65, 57, -82, 3, 7, 55, -4, 4 },
+  { 3, 0, -31680, 29120, -16, -40, -82, 3, 7, 55, -4, 4 },
+  { 0, 0, -31680, 29120, -16, -40, -82, 3, 7, 55, -4, 4 },
+  { 0, 0, -31680, 29120, -16, -40, -82, 3, 7, 55, -4, 4 },
+  { 0, 0, -31680, 29120, -16, -40, -82, 3, 7, 55, -4, 4 },
+  // Word 4
+  { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, -21632, -8768, -29, 85, 0, 0, 0, 0, 0, 0 },
+  { 161, 63, 14528, 11584, -43, -40, -12, -9, 31, 31, -4, 22 },
+  { 161, 66, 0, 11584, -56, -40, -24, 25, 67, 31, -4, 22 },
+  { 161, 66, 0, 9216, -43, -40, -12, 14, 55, 55, -24, 22 },
+  { 161, 66, -5184, 9216, -43, -54, -1, 36, 43, 55, -24, 4 },
+  { 161, 66, 0, 9216, -29, -54, -24, 25, 43, 79, -24, 4 },
+  { 161, 66, 0, 9216, -43, -40, -24, 14, 55, 55, -24, 22 },
+  { 57, 66, -18368, -6272, -70, 15, 23, 36, 43, 31, -64, -15 },
+  { 20, 71, -29376, -8768, -16, 57, 23, 69, 19, -16, -64, 22 },
+  { 32, 71, -10048, -15552, -97, 29, 34, 58, 55, 55, -4, 4 },
+  { 57, 61, 14528, 11584, -43, -40, -59, -9, 7, 31, 16, 22 },
+  { 20, 0, -5184, -11200, -97, 1, -59, -9, 7, 31, 16, 22 },
+  { 32, 0, -14528, -13440, -97, 29, -59, -9, 7, 31, 16, 22 },
+  { 161, 79, 5184, 15936, -43, -12, -35, 3, -5, 55, 37, -15 },
+  { 161, 85, -14528, -1088, -43, 1, -12, 36, 43, 31, 37, -15 },
+  { 161, 85, -14528, 1536, -56, 15, -35, 58, 7, 55, 16, 4 },
+  { 20, 0, -30016, 15936, -83, 57, -35, 58, 7, 55, 16, 4 },
+  { 20, 0, -30336, 17856, -70, 71, -35, 58, 7, 55, 16, 4 },
+  { 114, 87, -26368, 21248, -56, 29, -24, 69, 19, 7, 16, 4 },
+  { 161, 92, -27968, 19648, -43, 43, -12, 14, 19, 55, -4, 4 },
+  { 114, 92, -27968, 26176, -43, 1, -12, 58, 31, 31, -24, 22 },
+  { 114, 92, -27968, 21248, 11, 1, -47, 47, 31, 55, -24, -15 },
+  { 81, 92, -27968, 27072, -16, -26, -24, 58, 43, 31, -44, 32 },
+  { 114, 92, -26368, 19648, 25, 29, -59, 14, 43, 79, -44, 4 },
+  { 114, 95, -24256, 9216, 38, 57, -59, -20, 7, 102, -4, 4 },
+  { 114, 95, -24256, 11584, 38, 71, -59, -31, 7, 79, -4, 4 },
+  { 114, 95, -24256, 11584, 52, 57, -47, -31, 7, 79, -24, -15 },
+  { 81, 99, -26368, 9216, 52, 71, -59, -31, 19, 79, -24, 22 },
+  { 81, 99, -26368, 11584, 52, 71, -70, -31, 31, 79, -44, 22 },
+  { 41, 99, -26368, 11584, 52, 85, -70, -31, 31, 102, -44, 32 },
+  { 0, 99, -26368, 11584, 52, 85, -70, -31, 31, 102, -44, 32 },
+  { 0, 99, -26368, 11584, 52, 85, -70, -31, 31, 102, -44, 32 },
+  { 0, 99, -26368, 11584, 52, 85, -70, -31, 31, 102, -44, 32 },
+  { 0, 99, -26368, 11584, 52, 85, -70, -31, 31, 102, -44, 32 },
+  // Word 5
+  { 161, 87, 0, -1088, -16, -26, -1, 14, 7, 55, -24, 4 },
+  { 161, 87, -14528, 13824, -16, -26, -1, 47, 43, 31, -24, 22 },
+  { 161, 85, -14528, 9216, -16, -12, -12, 14, 31, 55, -44, 22 },
+  { 161, 85, -18368, 4160, -16, 29, -24, 3, 43, 79, -24, 22 },
+  { 114, 87, -24256, -6272, -16, 43, -1, -9, 19, 79, -24, 32 },
+  { 81, 87, -26368, -11200, 38, 29, -12, 3, 7, 79, -44, 22 },
+  { 57, 85, -27968, -13440, 65, 43, -47, 47, 19, 55, -4, 4 },
+  { 57, 85, -27968, -11200, 65, 15, -35, 25, 19, 79, -24, 22 },
+  { 114, 81, -26368, 9216, 11, 1, -12, 3, 67, 31, -44, 32 },
+  { 161, 81, -21632, 13824, -16, 1, -24, 25, 67, -16, -24, 22 },
+  { 161, 81, -18368, 17856, -16, 15, -24, 47, 67, -16, -24, 22 },
+  { 161, 81, -14528, 19648, -29, 15, -1, 47, 55, -16, -4, 4 },
+  { 161, 81, -14528, 17856, -43, 29, -12, 36, 43, 7, -24, 4 },
+  { 161, 79, -10048, 19648, -70, 29, -35, 25, 43, -16, -4, 4 },
+  { 20, 77, -18368, 13824, -43, 15, 23, -9, 7, 7, -24, 4 },
+  { 3, 77, -5184, 1536, -29, -12, 23, 47, 19, 31, 37, 22 },
+  { 7, 0, -5184, 11584, -70, -12, 23, 47, 19, 31, 37, 22 },
+  { 4, 0, -18368, -6272, -83, 29, 23, 47, 19, 31, 37, 22 },
+  { 3, 0, -21632, -13440, -83, 29, 23, 47, 19, 31, 37, 22 },
+  { 15, 0, -5184, 6720, -43, 71, 23, 47, 19, 31, 37, 22 },
+  { 32, 0, 14528, 24000, 11, 15, 23, 47, 19, 31, 37, 22 },
+  { 32, 0, 5184, 26176, 52, 57, 23, 47, 19, 31, 37, 22 },
+  { 32, 0, -5184, 25152, 38, 43, 23, 47, 19, 31, 37, 22 },
+  { 32, 0, -18368, 17856, -70, 1, 23, 47, 19, 31, 37, 22 },
+  { 161, 66, -18368, 25152, -70, 15, -1, 36, -5, 7, -4, 22 },
+  { 161, 69, -21632, 25152, -70, 57, 11, 14, -17, 31, 37, 22 },
+  { 161, 69, -21632, 25152, -43, 71, -12, 14, -5, 55, 16, 22 },
+  { 161, 69, -21632, 24000, -16, 71, -1, -9, 19, 79, -24, 22 },
+  { 161, 69, -21632, 24000, 11, 43, 11, -31, 31, 55, -24, 22 },
+  { 161, 71, -21632, 21248, 25, 43, 23, -31, 19, 55, -24, 32 },
+  { 161, 79, -21632, 19648, 25, 43, -1, -20, 31, 31, -24, 22 },
+  { 161, 85, -21632, 25152, -2, 43, -12, 14, 43, -16, -4, 22 },
+  { 161, 87, -21632, 21248, 11, 29, -1, -9, 19, 7, -24, 22 },
+  { 161, 95, -14528, 15936, -2, 57, -24, 25, 7, 7, -24, 4 },
+  { 114, 102, -10048, 9216, -56, 57, -47, 69, -29, 31, -44, 4 },
+  { 57, 115, -26368, 1536, -56, 43, -35, 58, 7, 7, -24, 22 },
+  { 114, 119, -14528, 1536, -29, 57, -24, 47, 19, -16, -44, 4 },
+  { 161, 115, -18368, 6720, -16, 1, 34, 25, 19, -16, -44, 22 },
+  { 161, 119, -10048, 15936, -43, -12, 34, 36, 7, 31, -64, 4 },
+  { 161, 119, -5184, 22656, -56, -12, 11, 25, 7, 31, -44, 4 },
+  { 161, 115, -5184, 25152, -56, -26, -1, 14, 7, 55, -44, 4 },
+  { 5, 0, -28928, 4160, -83, 1, -1, 14, 7, 55, -44, 4 },
+  { 3, 0, -30336, 15936, -16, 15, -1, 14, 7, 55, -44, 4 },
+  { 3, 0, -31424, 9216, 11, 15, -1, 14, 7, 55, -44, 4 },
+  { 32, 24, 0, 27072, 79, 15, 11, 3, -17, -16, 16, 22 },
+  { 41, 24, 0, 25152, 38, -40, -24, 3, 7, 55, 16, 22 },
+  { 7, 0, 0, 17856, -16, -54, -24, 3, 7, 55, 16, 22 },
+  { 7, 0, -5184, 13824, -43, -54, -24, 3, 7, 55, 16, 22 },
+  { 5, 0, -14528, 6720, -70, -40, -24, 3, 7, 55, 16, 22 },
+  { 4, 0, -18368, 1536, -43, -26, -24, 3, 7, 55, 16, 22 },
+  { 3, 0, -18368, 6720, -83, -26, -24, 3, 7, 55, 16, 22 },
+  { 0, 0, -18368, 6720, -83, -26, -24, 3, 7, 55, 16, 22 },
+  { 0, 0, -18368, 6720, -83, -26, -24, 3, 7, 55, 16, 22 },
+  { 0, 0, -18368, 6720, -83, -26, -24, 3, 7, 55, 16, 22 },
+  { 0, 0, -18368, 6720, -83, -26, -24, 3, 7, 55, 16, 22 },
+  // Word 6
+  { 4, 30, 10048, 19648, 52, 57, 23, 14, 19, 31, -4, 22 },
+  { 15, 30, 10048, 13824, 65, 85, 34, 14, 7, 31, -4, 32 },
+  { 7, 0, 5184, 15936, 25, 15, 34, 14, 7, 31, -4, 32 },
+  { 5, 0, 0, 6720, 11, 1, 34, 14, 7, 31, -4, 32 },
+  { 7, 0, 5184, 11584, -16, 1, 34, 14, 7, 31, -4, 32 },
+  { 15, 0, 0, 1536, 11, 1, 34, 14, 7, 31, -4, 32 },
+  { 32, 0, -30336, 1536, -2, 29, 34, 14, 7, 31, -4, 32 },
+  { 161, 69, -14528, 4160, -16, -12, 11, -9, 31, 55, -24, 4 },
+  { 161, 73, -24256, 6720, 52, -12, 11, 14, 31, 55, -64, 22 },
+  { 114, 73, -26368, -1088, 92, 43, -12, -9, -5, 55, -44, -15 },
+  { 114, 73, -21632, -3712, -2, 99, 34, -42, -29, 55, -4, 4 },
+  { 114, 73, -26368, -8768, 65, 71, 11, -31, -29, 55, -24, 22 },
+  { 81, 73, -26368, -6272, 65, 71, 23, -64, -17, 79, -24, 4 },
+  { 41, 73, -27968, -3712, 79, 29, -24, -42, 7, 79, -4, 22 },
+  { 10, 85, -24256, -20992, -2, 43, 23, 14, 19, 7, 16, 32 },
+  { 0, 85, -24256, -20992, -2, 43, 23, 14, 19, 7, 16, 32 },
+  { 15, 0, -5184, -8768, 25, 1, 23, 14, 19, 7, 16, 32 },
+  { 20, 0, 18368, -13440, -29, 15, 23, 14, 19, 7, 16, 32 },
+  { 32, 0, -18368, -15552, -29, 1, 23, 14, 19, 7, 16, 32 },
+  { 161, 87, -18368, 15936, -29, 1, -1, 14, 7, 55, -24, 4 },
+  { 161, 87, -14528, 19648, -56, 29, 11, 25, -17, 31, -4, 22 },
+  { 114, 99, -21632, 22656, -83, 57, 11, 3, -5, 55, -24, 22 },
+  { 114, 102, -21632, 25152, -83, 57, 34, -9, 7, 55, -24, 4 },
+  { 81, 102, -24256, 22656, -70, 43, 46, 14, -29, 79, -24, -15 },
+  { 81, 102, -18368, 24000, -97, 71, 34, -9, -5, 79, -64, 22 },
+  { 57, 102, -18368, 24000, -97, 57, 46, 3, -17, 79, -64, -15 },
+  { 57, 106, -21632, 22656, -83, 43, 34, 3, -17, 31, -24, -51 },
+  { 41, 106, -18368, 22656, -97, 29, 23, 3, -17, 31, -24, -33 },
+  { 32, 110, -18368, 21248, -97, 15, 11, 14, -65, 55, -24, -15 },
+  { 15, 110, -21632, 17856, -97, 29, -1, 3, -53, 55, -24, 22 },
+  { 5, 71, -24256, 15936, -110, 57, -24, 14, -17, 31, -44, 32 },
+  { 5, 102, -18368, 17856, -110, 1, -24, 14, -29, 55, -24, 4 },
+  { 0, 102, -18368, 17856, -110, 1, -24, 14, -29, 55, -24, 4 },
+  { 0, 102, -18368, 17856, -110, 1, -24, 14, -29, 55, -24, 4 },
+  { 0, 102, -18368, 17856, -110, 1, -24, 14, -29, 55, -24, 4 },
+  { 0, 102, -18368, 17856, -110, 1, -24, 14, -29, 55, -24, 4 },
+  // Word 7
+  { 3, 0, 0, 15936, -2, 15, 0, 0, 0, 0, 0, 0 },
+  { 3, 0, 5184, 22656, 25, 15, 0, 0, 0, 0, 0, 0 },
+  { 4, 0, 5184, 13824, -29, 1, 0, 0, 0, 0, 0, 0 },
+  { 10, 0, -10048, 6720, -2, 1, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, 5184, 6720, -2, 29, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, 0, 9216, -2, 15, 0, 0, 0, 0, 0, 0 },
+  { 20, 0, -5184, 1536, -2, 1, 0, 0, 0, 0, 0, 0 },
+  { 15, 0, -5184, 4160, -2, 1, 0, 0, 0, 0, 0, 0 },
+  { 161, 57, -14528, 1536, -2, 15, -1, 14, -5, 7, 16, 22 },
+  { 81, 53, -26368, 27840, -97, 1, 23, 3, -17, 79, 37, 4 },
+  { 114, 51, -24256, 25152, -83, 15, 11, 3, -17, 79, -24, 22 },
+  { 161, 51, -18368, 24000, -83, -12, 11, 14, -17, 79, 16, 4 },
+  { 161, 51, -10048, 24000, -83, -26, -1, 14, -5, 102, -4, 4 },
+  { 161, 53, -10048, 19648, -83, -40, 23, 36, 19, 79, -24, 22 },
+  { 161, 54, -10048, 13824, -83, -40, 57, 36, 31, 79, -44, -15 },
+  { 32, 59, -14528, 13824, -83, -40, 34, -20, 43, 79, -44, 32 },
+  { 4, 69, -31232, 9216, 38, 1, 34, 25, -5, 55, -4, 4 },
+  { 41, 54, -18368, 21248, 25, 1, 46, 25, 7, 31, 16, 22 },
+  { 81, 45, -21632, 19648, 25, 15, 34, -20, -17, 31, -4, 4 },
+  { 57, 66, -18368, 11584, 25, 15, -1, -9, -77, 7, 16, 4 },
+  { 114, 87, -24256, 19648, -29, 29, -12, -53, 19, 79, -4, 22 },
+  { 161, 87, -21632, 9216, -70, 29, 46, -9, -5, 79, -4, 4 },
+  { 161, 87, -14528, 11584, -83, 43, 11, -9, 43, 55, -24, 22 },
+  { 161, 92, -14528, 11584, -83, 15, -1, 14, 67, 31, -24, 22 },
+  { 114, 95, -18368, 6720, -83, 29, 11, 3, 79, 31, -24, 22 },
+  { 81, 95, -24256, 4160, -83, 43, 23, 14, 79, 7, -24, 4 },
+  { 81, 99, -21632, -1088, -83, 29, 69, -9, 67, 7, -44, 32 },
+  { 41, 99, -26368, -1088, -70, 57, 92, -20, 31, -16, -44, 32 },
+  { 81, 95, 0, -13440, -16, -26, -24, 25, 7, 31, 16, 4 },
+  { 7, 0, -14528, -20992, -16, 15, -24, 25, 7, 31, 16, 4 },
+  { 7, 0, 14528, -8768, -2, 15, -24, 25, 7, 31, 16, 4 },
+  { 7, 0, 21632, -1088, -29, 15, -24, 25, 7, 31, 16, 4 },
+  { 7, 0, 14528, -6272, -2, -12, -24, 25, 7, 31, 16, 4 },
+  { 10, 0, 14528, -1088, 11, -12, -24, 25, 7, 31, 16, 4 },
+  { 15, 0, -14528, -15552, -16, -12, -24, 25, 7, 31, 16, 4 },
+  { 32, 0, -30592, 9216, -16, 43, -24, 25, 7, 31, 16, 4 },
+  { 161, 95, 0, 9216, -43, -54, -1, 25, 43, 79, -24, 22 },
+  { 161, 95, 0, 6720, -56, -54, 11, 36, 43, 79, -24, 4 },
+  { 161, 99, 0, 6720, -56, -54, 11, 47, 43, 79, -24, 4 },
+  { 161, 99, 0, 6720, -56, -54, 11, 58, 43, 79, -24, 22 },
+  { 161, 102, -5184, 4160, -70, -40, 23, 58, 67, 55, -44, 32 },
+  { 161, 102, -5184, 6720, -70, -40, 11, 58, 79, 55, -44, 4 },
+  { 81, 106, -14528, -1088, -97, 43, 34, 69, 19, 31, -44, 22 },
+  { 81, 106, 0, 9216, -97, -26, 11, 80, 31, 31, -24, 22 },
+  { 81, 106, 5184, 9216, -97, -40, -1, 80, 55, 31, -44, 22 },
+  { 57, 106, 5184, 6720, -110, -26, -12, 80, 43, 31, -44, 32 },
+  { 41, 106, 0, 6720, -110, -12, -1, 91, 43, 31, -44, 22 },
+  { 41, 110, -10048, -8768, -83, -12, 46, 91, 7, 31, -44, 22 },
+  { 0, 110, -10048, -8768, -83, -12, 46, 91, 7, 31, -44, 22 },
+  { 0, 110, -10048, -8768, -83, -12, 46, 91, 7, 31, -44, 22 },
+  { 0, 110, -10048, -8768, -83, -12, 46, 91, 7, 31, -44, 22 },
+  { 0, 110, -10048, -8768, -83, -12, 46, 91, 7, 31, -44, 22 },
+  // Word 8
+  { 2, 43, -14528, -15552, -70, 57, -1, 25, 19, -16, -24, 4 },
+  { 10, 0, 10048, 13824, -70, 43, -1, 25, 19, -16, -24, 4 },
+  { 32, 0, 14528, 17856, -56, -12, -1, 25, 19, -16, -24, 4 },
+  { 32, 0, 14528, 26176, 38, 15, -1, 25, 19, -16, -24, 4 },
+  { 41, 0, -18368, -3712, -83, 29, -1, 25, 19, -16, -24, 4 },
+  { 161, 61, -14528, 13824, -70, -12, 11, 58, 31, 55, -24, 4 },
+  { 161, 61, -14528, 13824, -56, -12, 23, 25, 31, 55, -24, -15 },
+  { 161, 61, -18368, 15936, -43, 1, 34, 14, 43, 31, -24, -15 },
+  { 161, 61, -14528, 17856, -29, 1, 46, 3, 31, 31, -24, 4 },
+  { 161, 61, -18368, 17856, -43, 29, 34, 3, 43, 31, -24, 4 },
+  { 161, 63, -18368, 19648, -29, 29, 34, -9, 43, 7, -24, 4 },
+  { 161, 63, -21632, 17856, -43, 43, -12, 14, 19, 7, -4, -15 },
+  { 114, 69, -18368, 13824, -56, 71, -70, 58, -17, 31, -24, -15 },
+  { 161, 69, -18368, 15936, -56, 57, -59, 58, -17, 55, -24, 4 },
+  { 161, 71, -18368, 19648, -56, 43, -35, 69, -41, 55, -64, 32 },
+  { 114, 73, -18368, 22656, -83, 57, -24, 47, -53, 79, -44, 32 },
+  { 114, 79, -21632, 26176, -83, 43, -1, 47, -65, 55, 16, -33 },
+  { 81, 81, -21632, 26176, -97, 85, -12, -9, -5, 55, -4, -51 },
+  { 57, 81, -24256, 26176, -97, 85, -12, -9, -5, 55, -4, -33 },
+  { 57, 85, -24256, 25152, -97, 85, -35, 3, -5, 55, -24, 4 },
+  { 81, 85, -18368, 26176, -97, 43, 11, 14, -5, 79, -64, 22 },
+  { 161, 85, -21632, 17856, -56, 1, 46, 58, -41, 55, -24, -15 },
+  { 161, 85, -18368, 15936, -70, 15, 46, 25, 7, 55, -44, 4 },
+  { 161, 87, -14528, 6720, -56, 29, 46, 25, -5, 31, -44, 22 },
+  { 161, 87, -14528, 6720, -43, -12, 57, 36, -5, 31, -24, 4 },
+  { 161, 87, -18368, 1536, -29, 15, 46, 47, -5, 31, -44, 22 },
+  { 161, 87, -18368, 6720, -29, -12, 46, 36, 7, 7, -44, 22 },
+  { 161, 87, -21632, 6720, -56, 1, 34, 36, 31, 31, -24, -15 },
+  { 161, 87, -14528, 13824, -70, 15, -12, 47, 31, 55, -24, -15 },
+  { 161, 87, -21632, 11584, -56, 43, -1, 58, 7, 7, -4, -15 },
+  { 161, 92, -18368, 21248, -83, 43, -1, 58, 7, 31, -4, -15 },
+  { 114, 92, -21632, 21248, -83, 29, 11, 69, -29, 31, -24, 4 },
+  { 81, 92, -18368, 22656, -97, 43, 23, 58, -29, 79, -24, -15 },
+  { 57, 92, -21632, 21248, -83, 29, 23, 58, -41, 79, -64, 22 },
+  { 57, 92, -18368, 24000, -83, 1, 23, 80, -53, 79, -64, 22 },
+  { 57, 95, -14528, 28544, -97, 43, -1, 25, -17, 102, -64, 32 },
+  { 57, 95, -14528, 28544, -97, 29, -1, 25, -17, 102, -64, 4 },
+  { 41, 95, -14528, 26176, -83, 1, -1, 36, -41, 102, -64, 22 },
+  { 32, 95, -10048, 28544, -97, 43, -35, 3, -5, 79, -64, 32 },
+  { 20, 95, -10048, 21248, -97, 29, -24, 14, -29, 55, -64, 32 },
+  { 15, 106, -14528, 21248, -70, 29, -24, 14, -41, 55, -64, 32 },
+  { 3, 0, -30848, 13824, -97, 57, -24, 14, -41, 55, -64, 32 },
+  { 0, 0, -30848, 13824, -97, 57, -24, 14, -41, 55, -64, 32 },
+  { 0, 0, -30848, 13824, -97, 57, -24, 14, -41, 55, -64, 32 },
+  { 0, 0, -30848, 13824, -97, 57, -24, 14, -41, 55, -64, 32 },
+  { 0, 0, -30848, 13824, -97, 57, -24, 14, -41, 55, -64, 32 },
+  // Word 9
+  { 161, 66, -14528, -3712, -70, 15, 34, 69, 43, 7, -24, 22 },
+  { 161, 66, 5184, -1088, -56, -40, -35, 58, 43, 79, -4, 22 },
+  { 161, 66, 0, 11584, -70, -26, -24, 47, 31, 55, -24, 22 },
+  { 81, 66, -27968, 9216, -70, 43, 46, -9, 55, -40, 16, 32 },
+  { 57, 66, -30336, 9216, -29, 71, -1, 14, 7, -16, 37, 22 },
+  { 114, 61, -18368, -13440, -29, 1, 11, 36, 7, 31, -44, 4 },
+  { 32, 0, -5184, -20992, -97, 29, 11, 36, 7, 31, -44, 4 },
+  { 20, 0, 18368, 11584, -56, -82, 11, 36, 7, 31, -44, 4 },
+  { 20, 0, 26368, 24000, 25, 15, 11, 36, 7, 31, -44, 4 },
+  { 20, 0, 18368, 26176, 52, 15, 11, 36, 7, 31, -44, 4 },
+  { 10, 0, 14528, 25152, 25, 43, 11, 36, 7, 31, -44, 4 },
+  { 7, 0, 5184, 27840, 38, 29, 11, 36, 7, 31, -44, 4 },
+  { 10, 0, 0, 27840, 38, 71, 11, 36, 7, 31, -44, 4 },
+  { 20, 0, 0, 27840, 52, 57, 11, 36, 7, 31, -44, 4 },
+  { 41, 0, 0, 24000, -43, -26, 11, 36, 7, 31, -44, 4 },
+  { 161, 69, -10048, 17856, -43, -12, -35, 25, 7, 31, 37, -15 },
+  { 161, 73, -21632, 21248, -97, 43, 11, 47, 7, 31, 16, 4 },
+  { 161, 77, -21632, 21248, -97, 29, 11, 47, 7, 31, 16, 4 },
+  { 114, 79, -21632, 19648, -83, 43, -12, 25, -17, 55, 16, 4 },
+  { 57, 81, -24256, 11584, -110, 71, -1, 25, 19, 55, -4, 4 },
+  { 57, 81, -21632, 11584, -110, 71, -1, 25, 31, 55, -4, 4 },
+  { 81, 87, -21632, 11584, -110, 57, -24, 25, 43, 31, -4, 4 },
+  { 114, 87, -14528, 13824, -97, 43, -35, 36, 19, 55, -24, 22 },
+  { 161, 87, -14528, 13824, -83, 15, -12, 14, 7, 55, -4, 4 },
+  { 161, 87, -10048, 17856, -29, 1, -24, 14, -5, 55, -4, -15 },
+  { 161, 87, -10048, 21248, -29, 1, -12, 25, 7, 55, -44, 22 },
+  { 161, 92, -10048, 22656, -43, 15, -12, 14, 19, 31, -44, 32 },
+  { 161, 95, -10048, 19648, -29, 1, -24, 25, 31, 7, -44, 4 },
+  { 161, 95, -10048, 19648, -29, 1, -12, 36, 19, 7, -24, 22 },
+  { 161, 95, -5184, 17856, -29, 1, -24, 14, 43, 7, -24, 22 },
+  { 161, 95, -5184, 15936, -29, -12, -24, 3, 43, 7, -24, 22 },
+  { 57, 99, -14528, 9216, -83, 29, -59, 58, 31, -16, -4, -15 },
+  { 57, 95, -14528, 6720, -97, 43, -35, 58, 19, -40, -4, -15 },
+  { 32, 87, -24256, 1536, -97, 43, -24, 69, 55, -16, -4, 4 },
+  { 32, 73, -10048, -6272, -29, 15, 11, 25, -5, 7, -4, 4 },
+  { 161, 59, 14528, 11584, -16, 57, -12, 47, 43, 7, -44, 4 },
+  { 7, 0, -14528, -6272, -2, 29, -12, 47, 43, 7, -44, 4 },
+  { 0, 0, -14528, -6272, -2, 29, -12, 47, 43, 7, -44, 4 },
+  { 0, 0, -14528, -6272, -2, 29, -12, 47, 43, 7, -44, 4 },
+  { 0, 0, -14528, -6272, -2, 29, -12, 47, 43, 7, -44, 4 },
+  { 0, 0, -14528, -6272, -2, 29, -12, 47, 43, 7, -44, 4 },
+  // Word 10
+  { 57, 79, -29376, -1088, -16, 43, 46, -9, 19, 31, -24, 32 },
+  { 41, 77, -30336, -1088, -16, 71, 81, 3, 7, 7, -44, 32 },
+  { 41, 73, -29696, 1536, -56, 85, 23, 36, 43, -40, 16, -33 },
+  { 81, 73, -26368, -6272, -43, 15, 46, 36, 31, 55, -44, -15 },
+  { 161, 69, -21632, 15936, -70, -26, 11, 47, 19, 7, -24, 22 },
+  { 161, 66, -18368, 13824, -43, 29, -12, 36, 31, -16, -24, 4 },
+  { 161, 63, -26368, 24000, -16, 15, -35, 3, 19, -16, -24, 4 },
+  { 161, 63, -24256, 26176, -2, -26, 11, 3, 19, 7, -44, 32 },
+  { 161, 63, -24256, 27072, 11, -54, 11, 36, -5, 7, -44, 22 },
+  { 114, 63, -24256, 28544, -29, -26, 23, 25, 19, -16, -44, 32 },
+  { 114, 63, -24256, 29120, -29, -26, 23, 25, 7, -16, -44, 32 },
+  { 114, 69, -24256, 28544, -29, 1, -35, 47, 7, -16, -24, 22 },
+  { 114, 77, -24256, 27840, -16, 1, -35, 36, 19, -16, -44, 32 },
+  { 161, 79, -21632, 27840, -2, -12, 11, 25, 19, 7, -44, 22 },
+  { 161, 87, -21632, 24000, 25, 29, -12, -9, 43, 31, -44, 32 },
+  { 161, 92, -21632, 21248, 25, 29, 11, -9, 31, 31, -44, 22 },
+  { 161, 92, -21632, 21248, 11, 29, 11, -9, 19, 31, -44, 22 },
+  { 161, 99, -21632, 22656, 25, 29, -1, -9, 31, 31, -44, 22 },
+  { 161, 102, -21632, 19648, 25, 29, 11, -9, 7, 55, -44, 22 },
+  { 161, 102, -21632, 17856, 11, 29, -1, -9, 7, 55, -44, 22 },
+  { 81, 106, -21632, 11584, 11, 43, 11, -9, -17, 79, -44, 22 },
+  { 10, 106, -31552, 15936, -16, 57, -35, -9, 55, 55, -24, 22 },
+  { 10, 99, -30848, 21248, -2, -12, 11, 14, 7, 7, -4, 22 },
+  { 3, 0, -32064, 30464, 11, 1, 11, 14, 7, 7, -4, 22 },
+  { 3, 0, -30336, 17856, -29, 29, 11, 14, 7, 7, -4, 22 },
+  { 3, 0, -30592, 17856, -29, 29, 11, 14, 7, 7, -4, 22 },
+  { 0, 0, -30592, 17856, -29, 29, 11, 14, 7, 7, -4, 22 },
+  { 0, 0, -30592, 17856, -29, 29, 11, 14, 7, 7, -4, 22 },
+  { 0, 0, -30592, 17856, -29, 29, 11, 14, 7, 7, -4, 22 },
+  // Word 11
+  { 57, 73, -21632, 4160, -97, 71, -12, 3, 19, -16, -4, 22 },
+  { 41, 81, -28480, -1088, -83, 99, 23, 14, 43, -16, -4, 22 },
+  { 41, 81, -29376, -1088, -70, 85, 34, 3, 67, 7, -44, 4 },
+  { 57, 81, -26368, 4160, -97, 71, 34, 25, 55, 7, -24, -15 },
+  { 114, 73, -24256, 9216, -83, 57, 23, 36, 7, 55, -44, -33 },
+  { 114, 77, -21632, 6720, -83, 29, 34, 69, -29, 55, -64, 22 },
+  { 161, 77, 0, 15936, -56, -26, -47, 69, -17, 79, -44, 22 },
+  { 20, 0, -27968, -3712, -97, 29, -47, 69, -17, 79, -44, 22 },
+  { 41, 0, 5184, 15936, -56, -54, -47, 69, -17, 79, -44, 22 },
+  { 41, 0, 10048, 27840, 25, 1, -47, 69, -17, 79, -44, 22 },
+  { 32, 0, 10048, 29632, 38, 29, -47, 69, -17, 79, -44, 22 },
+  { 32, 0, 10048, 28544, 65, 43, -47, 69, -17, 79, -44, 22 },
+  { 32, 0, 14528, 29120, 65, 43, -47, 69, -17, 79, -44, 22 },
+  { 32, 0, 10048, 27840, 25, -26, -47, 69, -17, 79, -44, 22 },
+  { 161, 57, 0, 13824, -83, -40, 11, 36, 19, 55, -4, 22 },
+  { 114, 57, -21632, -1088, -70, 15, 57, 80, -5, 31, -44, 4 },
+  { 114, 57, -21632, -1088, -70, 29, 69, 80, -5, -16, -44, -15 },
+  { 114, 59, -18368, -1088, -83, 15, 69, 69, 19, 7, -64, 32 },
+  { 114, 63, -18368, -6272, -70, 15, 69, 80, -29, -16, -44, 22 },
+  { 114, 66, -14528, -3712, -83, 15, 81, 58, -5, -16, -44, 77 },
+  { 161, 66, -5184, 1536, -97, -12, 57, 47, -5, 31, -24, 22 },
+  { 161, 73, 5184, 13824, -83, -40, 23, 47, 19, 7, -24, 32 },
+  { 161, 81, 0, 13824, -97, -12, 23, 25, 19, 7, -4, 32 },
+  { 161, 87, -5184, 4160, -97, 1, 46, 25, 7, -16, -4, 32 },
+  { 161, 92, -14528, -6272, -56, 29, 34, 14, -5, 7, -4, 22 },
+  { 161, 95, 0, 6720, -83, 15, 11, 14, 19, 7, -4, 22 },
+  { 114, 95, -10048, 13824, -83, -12, -24, -9, 55, 7, -4, 22 },
+  { 81, 95, -14528, 11584, -97, 15, -35, 47, 43, 7, -4, 4 },
+  { 57, 95, -18368, 6720, -97, 43, -24, 47, 43, 7, 16, 4 },
+  { 57, 99, -18368, 9216, -97, 29, -24, 58, 43, 7, -4, 4 },
+  { 81, 99, -14528, 11584, -97, 1, -35, 25, 43, 7, 16, -15 },
+  { 32, 99, -26368, 1536, -83, 43, -12, 58, 31, 31, -4, -15 },
+  { 41, 143, -21632, -3712, -97, 57, -1, 69, 43, -40, -4, 4 },
+  { 3, 0, -27968, -6272, -56, 71, -1, 69, 43, -40, -4, 4 },
+  { 0, 0, -27968, -6272, -56, 71, -1, 69, 43, -40, -4, 4 },
+  { 0, 0, -27968, -6272, -56, 71, -1, 69, 43, -40, -4, 4 },
+  { 0, 0, -27968, -6272, -56, 71, -1, 69, 43, -40, -4, 4 },
+  { 0, 0, -27968, -6272, -56, 71, -1, 69, 43, -40, -4, 4 },
+  // Word 12
+  { 57, 77, -24256, 6720, -83, 43, -1, 36, 7, 7, 16, 22 },
+  { 81, 77, -21632, 4160, -83, 1, 11, 14, 43, 31, 16, 22 },
+  { 114, 73, -21632, 1536, -70, 1, 11, -9, 31, 7, 16, 32 },
+  { 114, 71, -26368, -1088, -70, 29, 23, 14, 43, 7, 16, 32 },
+  { 81, 66, -28928, 9216, -43, 15, 11, -9, 31, 31, 16, 59 },
+  { 161, 66, -26368, 15936, -2, 29, -12, -20, -29, 31, -4, 22 },
+  { 161, 57, -21632, 22656, 25, 71, -24, -9, 7, 31, -24, 22 },
+  { 161, 54, -21632, 24000, 11, 71, -35, 14, 19, 31, -24, 22 },
+  { 161, 53, -21632, 25152, 11, 71, -24, 3, 19, 31, -4, 22 },
+  { 161, 53, -21632, 27072, -2, 57, -35, 14, 43, 7, -4, 32 },
+  { 161, 54, -21632, 28544, -2, 43, -24, 14, 55, 7, -24, 22 },
+  { 161, 57, -24256, 27840, -2, 43, -1, -20, 55, 7, -24, 32 },
+  { 161, 61, -21632, 24000, -2, 57, -1, -31, 55, 31, -24, 22 },
+  { 161, 71, -18368, 17856, -43, 71, 11, -20, 55, 31, -24, 22 },
+  { 57, 81, -5184, 19648, -83, 71, -35, -9, -5, 31, 16, 4 },
+  { 114, 95, 14528, 27072, -16, -54, -59, 14, 19, 31, 16, 4 },
+  { 161, 92, 5184, 6720, -70, -40, 11, 58, 19, 31, -4, 4 },
+  { 161, 87, -10048, 1536, -83, 15, -1, 58, 31, 55, 16, -51 },
+  { 114, 87, -21632, -3712, -56, 43, 23, 58, 43, 31, -24, -51 },
+  { 114, 87, -24256, -1088, -29, 43, 11, 69, 31, 55, -44, -15 },
+  { 114, 92, -24256, 1536, -29, 15, 23, 47, 43, 55, -64, 4 },
+  { 114, 92, -26368, 4160, -2, 15, 11, 47, 31, 31, -24, 4 },
+  { 114, 95, -26368, 13824, 11, 29, -47, 3, 31, 55, -24, 22 },
+  { 114, 92, -26368, 15936, 25, 29, -35, 14, 43, 31, -4, 4 },
+  { 114, 92, -24256, 11584, 11, 71, -35, 3, 7, 55, -4, -33 },
+  { 81, 92, -24256, 15936, -2, 57, -24, 14, -17, 31, -4, -33 },
+  { 114, 92, -21632, 11584, -16, 43, -12, 36, -29, 31, 37, -51 },
+  { 81, 92, -18368, 22656, -83, 57, -24, 36, 7, 31, -44, -15 },
+  { 81, 92, -14528, 21248, -70, 15, -1, 36, -29, 79, -44, -15 },
+  { 81, 92, -18368, 17856, -70, 43, 11, 25, -53, 55, -44, 4 },
+  { 81, 95, -14528, 27840, -70, 1, -12, 36, -41, 79, -44, -15 },
+  { 114, 95, -10048, 25152, -70, 29, -12, 25, -41, 55, -24, -33 },
+  { 57, 95, -10048, 26176, -97, 43, -24, 3, -17, 31, -44, 4 },
+  { 41, 99, -14528, 24000, -97, 29, -1, 3, -53, 79, -64, 22 },
+  { 41, 99, -14528, 24000, -97, 15, -12, 3, -41, 79, -64, 22 },
+  { 41, 99, -10048, 26176, -83, 15, -24, -9, -41, 79, -44, 32 },
+  { 20, 92, -10048, 26176, -83, 15, -24, -9, -41, 79, -44, 22 },
+  { 0, 92, -10048, 26176, -83, 15, -24, -9, -41, 79, -44, 22 },
+  { 0, 92, -10048, 26176, -83, 15, -24, -9, -41, 79, -44, 22 },
+  { 0, 92, -10048, 26176, -83, 15, -24, -9, -41, 79, -44, 22 },
+  { 0, 92, -10048, 26176, -83, 15, -24, -9, -41, 79, -44, 22 },
+  // Word 13
+  { 57, 77, -26368, 4160, -83, 43, -1, 36, 7, 7, 16, 22 },
+  { 81, 73, -21632, 4160, -83, 1, 11, 3, 43, 31, 16, 22 },
+  { 161, 73, -21632, 1536, -70, 1, 11, -9, 31, 7, 16, 32 },
+  { 81, 71, -27968, -1088, -56, 29, 34, 3, 43, 31, 16, 59 },
+  { 114, 66, -26368, 1536, -70, 43, 34, 14, 43, 31, 16, 59 },
+  { 114, 63, -29376, 4160, -29, 29, 34, 14, 31, 55, -4, 32 },
+  { 161, 57, -26368, 26176, -16, 57, -47, 14, 19, 7, 16, 22 },
+  { 161, 57, -24256, 27840, -2, 29, -35, 3, 7, 7, -4, 22 },
+  { 161, 54, -21632, 27072, 11, 1, -24, -9, 19, 7, -4, 22 },
+  { 161, 53, -21632, 24000, 38, -26, -12, 3, 7, 31, -24, 22 },
+  { 161, 53, -21632, 27840, -16, 1, -1, 14, -5, 7, -24, 22 },
+  { 161, 54, -21632, 24000, -16, 43, -12, 3, 19, 31, -24, 22 },
+  { 161, 59, -18368, 21248, -43, 71, -35, 14, 43, 7, -24, 22 },
+  { 161, 63, -14528, 17856, -56, 29, -35, 36, 19, 55, -24, 22 },
+  { 57, 79, -21632, 11584, -43, 57, -24, -9, -41, 7, -4, 22 },
+  { 41, 77, -10048, -3712, -43, 15, -24, 25, -5, 7, -24, 4 },
+  { 161, 79, 18368, 28544, 65, 57, -24, -31, -29, -40, -24, 4 },
+  { 161, 85, 14528, 9216, -56, -12, -35, 25, 19, 31, 37, 4 },
+  { 161, 85, -10048, 9216, -56, 1, -1, 36, 31, 31, -4, -15 },
+  { 161, 87, -5184, 17856, -43, 15, -35, 3, 7, 79, -4, -15 },
+  { 161, 87, -10048, 11584, -56, 29, -12, 14, 19, 31, -24, 22 },
+  { 81, 92, -24256, -1088, 25, 57, -24, -31, -5, 79, 16, 22 },
+  { 57, 92, -27968, 17856, 25, 15, -59, 14, 31, 55, -24, 32 },
+  { 81, 87, -26368, 15936, 25, -12, -47, 25, 19, 55, -24, 32 },
+  { 114, 87, -24256, 15936, -2, -12, -12, 14, 7, 55, -24, 32 },
+  { 161, 87, -21632, 15936, -16, 1, -12, 25, 31, 31, -4, 32 },
+  { 161, 87, -10048, 9216, -43, 15, -12, 14, 31, 55, -4, 22 },
+  { 161, 87, -10048, 11584, -56, 1, -1, 25, 43, 55, -24, 32 },
+  { 161, 87, -14528, 13824, -70, 1, 11, 36, 43, 31, -24, 32 },
+  { 161, 92, -14528, 9216, -70, -12, 34, 36, 43, 55, -44, 4 },
+  { 114, 92, -21632, 1536, -56, 15, 69, 47, 19, 31, -44, -33 },
+  { 81, 92, -21632, 4160, -70, 43, 11, 47, 43, 55, -24, -15 },
+  { 81, 92, -18368, 6720, -83, 29, -1, 47, 31, 31, -4, -15 },
+  { 114, 92, -14528, 17856, -83, 29, -12, 58, 7, 55, -4, -15 },
+  { 114, 92, -14528, 19648, -97, 43, -1, 47, 7, 55, -4, -15 },
+  { 114, 92, -14528, 25152, -83, 15, -1, 47, -17, 79, -24, -15 },
+  { 81, 95, -14528, 27072, -97, 43, -12, 14, 7, 79, -24, -15 },
+  { 81, 95, -14528, 27840, -83, 1, 11, 36, -41, 102, -24, -15 },
+  { 57, 95, -14528, 28544, -97, 71, -24, 14, 7, 79, -64, 59 },
+  { 32, 95, -21632, 21248, -83, -12, 23, 69, -65, 55, -24, -15 },
+  { 41, 99, -18368, 19648, -70, -12, -1, 47, -65, 55, -44, -15 },
+  { 20, 95, -14528, 21248, -97, -12, -1, 25, -29, 55, -4, -15 },
+  { 15, 102, -14528, 24000, -83, 29, -24, -20, -5, 7, -24, -15 },
+  { 7, 99, -14528, 24000, -97, 29, -12, 3, -29, 55, -64, 22 },
+  { 3, 0, -31424, 11584, -97, 71, -12, 3, -29, 55, -64, 22 },
+  { 3, 0, -32064, 9216, -56, 57, -12, 3, -29, 55, -64, 22 },
+  { 0, 0, -32064, 9216, -56, 57, -12, 3, -29, 55, -64, 22 },
+  { 0, 0, -32064, 9216, -56, 57, -12, 3, -29, 55, -64, 22 },
+  { 0, 0, -32064, 9216, -56, 57, -12, 3, -29, 55, -64, 22 },
+  { 0, 0, -32064, 9216, -56, 57, -12, 3, -29, 55, -64, 22 },
+  // Word 14
+  { 32, 0, -28480, 26176, -70, 1, 0, 0, 0, 0, 0, 0 },
+  { 20, 0, -26368, 28544, -83, -12, 0, 0, 0, 0, 0, 0 },
+  { 161, 63, -21632, 21248, 25, 43, 23, -20, -5, 55, -24, 22 },
+  { 161, 59, -21632, 26176, -2, 57, -12, -31, 43, 31, -44, 32 },
+  { 161, 57, -21632, 28544, -16, 57, -24, 3, 43, 7, -44, 59 },
+  { 114, 54, -24256, 30464, -29, 1, 11, 14, 19, 31, -44, 22 },
+  { 114, 57, -24256, 30464, -16, -40, 23, 47, -5, 31, -24, 22 },
+  { 57, 57, -26368, 28544, -29, 43, -12, 3, 43, 31, -44, 32 },
+  { 10, 63, -26368, 25152, -83, 43, -35, 25, 19, -16, -24, 22 },
+  { 3, 63, -30016, 11584, 52, 29, -24, -31, -17, 7, 16, 32 },
+  { 4, 0, -14528, 1536, -43, -12, -24, -31, -17, 7, 16, 32 },
+  { 4, 0, -18368, 4160, -43, -12, -24, -31, -17, 7, 16, 32 },
+  { 4, 0, -27968, 6720, -56, 1, -24, -31, -17, 7, 16, 32 },
+  { 57, 73, -24256, 25152, -29, 1, -35, 14, 7, 7, -4, 4 },
+  { 41, 71, -28928, 27072, -70, 15, 11, 47, 7, 7, 16, 22 },
+  { 57, 81, -26368, 29120, -83, 1, 34, 14, 7, 7, -4, 32 },
+  { 41, 81, -28480, 27840, -97, 15, 46, 36, 7, 31, -4, 22 },
+  { 32, 81, -30016, 26176, -83, 43, 34, 36, -5, 31, 37, 4 },
+  { 114, 81, -24256, 24000, -70, 1, 23, 47, -17, 31, 37, 22 },
+  { 41, 85, -28480, 21248, -70, 99, 11, 14, -5, 55, -64, 22 },
+  { 81, 87, -27968, 15936, -16, 29, 46, 47, -53, 55, -24, 4 },
+  { 81, 87, -24256, 15936, -56, -12, 57, 69, -41, 55, -44, 22 },
+  { 161, 87, -10048, 17856, -97, 29, -24, 47, 43, 55, -4, 4 },
+  { 114, 87, -10048, 15936, -97, 29, -12, 47, 55, 55, -24, 4 },
+  { 81, 87, -24256, 11584, -70, 57, 34, 58, 19, 7, -4, -15 },
+  { 81, 92, -21632, 9216, -83, 57, 11, 91, 19, 7, -24, -33 },
+  { 57, 87, -5184, 24000, -70, 15, -59, 3, 7, 55, 16, 4 },
+  { 114, 87, -14528, 11584, -70, 1, -12, 69, 19, 55, -4, -15 },
+  { 81, 92, -24256, 6720, -70, 43, 34, 91, -29, 31, -44, -15 },
+  { 81, 92, -21632, 15936, -83, 15, 23, 69, 7, 79, -4, -33 },
+  { 81, 95, -21632, 17856, -97, 43, 23, 69, -5, 79, -4, -15 },
+  { 57, 95, -24256, 17856, -97, 71, 34, 47, 7, 79, -24, -15 },
+  { 57, 95, -24256, 17856, -97, 43, 46, 58, -5, 79, -4, -33 },
+  { 57, 99, -14528, 27840, -97, 71, -59, 36, 43, 31, -64, 59 },
+  { 57, 99, -14528, 28544, -97, 57, -35, 3, 19, 79, -64, 32 },
+  { 57, 99, -14528, 27072, -97, 57, -24, 3, 19, 55, -44, 4 },
+  { 32, 99, -14528, 27072, -97, 43, -35, 3, 19, 55, -64, 59 },
+  { 10, 102, -18368, 21248, -97, 15, -12, 3, -5, 79, -64, 32 },
+  { 3, 0, -32064, 13824, -83, 85, -12, 3, -5, 79, -64, 32 },
+  { 0, 0, -32064, 13824, -83, 85, -12, 3, -5, 79, -64, 32 },
+  { 0, 0, -32064, 13824, -83, 85, -12, 3, -5, 79, -64, 32 },
+  { 0, 0, -32064, 13824, -83, 85, -12, 3, -5, 79, -64, 32 },
+  { 0, 0, -32064, 13824, -83, 85, -12, 3, -5, 79, -64, 32 },
+  // Word 15
+  { 161, 61, -21632, 22656, 38, 29, 23, 14, 31, 55, -4, 4 },
+  { 161, 61, -21632, 28544, 11, 1, 23, 25, 43, 31, -24, 22 },
+  { 161, 61, -21632, 27072, 25, 29, 11, 3, 43, 31, -24, 22 },
+  { 161, 61, -21632, 27840, -2, 43, -12, 14, 55, 31, -24, 22 },
+  { 161, 57, -24256, 29120, -2, -12, 11, 25, 55, 7, -44, 22 },
+  { 161, 57, -24256, 27840, -16, 29, -12, 25, 55, -16, -24, 32 },
+  { 161, 54, -21632, 21248, -16, 85, -59, 36, 55, -16, -24, 22 },
+  { 5, 0, -31232, -1088, 38, 1, -59, 36, 55, -16, -24, 22 },
+  { 5, 0, 0, -13440, 11, 1, -59, 36, 55, -16, -24, 22 },
+  { 5, 0, 18368, -3712, -2, 15, -59, 36, 55, -16, -24, 22 },
+  { 7, 0, 18368, -3712, -2, 15, -59, 36, 55, -16, -24, 22 },
+  { 7, 0, 21632, -1088, -16, 29, -59, 36, 55, -16, -24, 22 },
+  { 10, 0, 5184, -11200, 38, 1, -59, 36, 55, -16, -24, 22 },
+  { 15, 0, -24256, -3712, -16, 43, -59, 36, 55, -16, -24, 22 },
+  { 161, 81, -26368, 11584, 38, 15, -24, -9, 19, 55, -24, 4 },
+  { 81, 81, -28480, 13824, 52, -26, -1, 3, 19, 55, -4, 32 },
+  { 114, 81, -24256, -1088, 38, 29, -12, -53, 19, 79, -4, 22 },
+  { 114, 81, -21632, -1088, 25, 57, -12, -53, 19, 79, -4, 22 },
+  { 161, 81, -14528, -3712, 25, 29, -1, -31, 7, 55, -4, 32 },
+  { 161, 81, -14528, 1536, 25, 15, -1, -20, 19, 55, -4, 32 },
+  { 161, 81, -10048, 11584, -16, 1, -12, -31, 55, 55, -4, 22 },
+  { 161, 81, -5184, 13824, -29, 1, -1, -31, 55, 55, -24, 32 },
+  { 161, 87, 0, 17856, -43, -40, 11, -9, 43, 79, -24, 22 },
+  { 161, 87, 0, 15936, -29, -54, 11, 14, 31, 79, -24, 22 },
+  { 161, 87, -5184, 19648, -56, -26, 23, 3, 43, 79, -44, 22 },
+  { 161, 87, 0, 17856, -43, -40, 23, 3, 31, 102, -44, 22 },
+  { 114, 87, -10048, 15936, -70, 1, -12, 3, 19, 55, -24, 4 },
+  { 161, 87, -5184, 19648, -70, 1, -24, 47, -5, 79, -4, 4 },
+  { 161, 87, -10048, 22656, -70, -12, -12, 47, -5, 79, 16, -15 },
+  { 161, 87, -10048, 25152, -83, 15, -1, 36, 7, 79, -4, 4 },
+  { 161, 87, -14528, 26176, -97, 1, 23, 25, -17, 79, -4, 4 },
+  { 81, 87, -14528, 26176, -97, 1, 23, 36, -29, 102, -24, 4 },
+  { 114, 87, -14528, 26176, -97, 15, 34, 25, -29, 102, -24, -15 },
+  { 81, 87, -14528, 27072, -97, 29, 11, -9, -5, 79, -44, 22 },
+  { 57, 92, -14528, 28544, -97, 71, -59, 25, 43, 55, -64, 59 },
+  { 57, 92, -14528, 27840, -97, 57, -35, 3, 19, 79, -64, 32 },
+  { 41, 92, -14528, 27072, -110, 57, -35, 14, 19, 55, -64, 59 },
+  { 32, 92, -14528, 26176, -97, 43, -35, 3, 19, 55, -64, 59 },
+  { 10, 95, -18368, 21248, -97, 1, -12, 3, -5, 79, -64, 32 },
+  { 0, 95, -18368, 21248, -97, 1, -12, 3, -5, 79, -64, 32 },
+  { 0, 95, -18368, 21248, -97, 1, -12, 3, -5, 79, -64, 32 },
+  { 0, 95, -18368, 21248, -97, 1, -12, 3, -5, 79, -64, 32 },
+  { 0, 95, -18368, 21248, -97, 1, -12, 3, -5, 79, -64, 32 },
+  { 0, 95, -18368, 21248, -97, 1, -12, 3, -5, 79, -64, 32 },
+  // Word 16
+  { 2, 47, -14528, 1536, -2, 15, 23, 3, -5, 31, 16, 4 },
+  { 2, 47, -24256, 11584, 25, 43, 23, 14, 19, 7, -4, 22 },
+  { 7, 47, 5184, 1536, -16, 15, 11, 14, 31, 7, -24, 22 },
+  { 10, 0, -26368, 6720, -2, 15, 11, 14, 31, 7, -24, 22 },
+  { 20, 0, -24256, 13824, -16, 15, 11, 14, 31, 7, -24, 22 },
+  { 161, 77, -10048, 17856, -56, 43, -1, 3, 7, -16, -24, -15 },
+  { 161, 79, -10048, 17856, -43, 57, -1, 25, 19, -16, -24, 4 },
+  { 161, 79, -10048, 19648, -43, 57, -12, 25, 19, -16, -24, 22 },
+  { 161, 79, -14528, 21248, -43, 71, -12, 36, 19, 7, -24, 4 },
+  { 161, 85, -14528, 24000, -29, 57, -1, 25, 43, 7, -4, 22 },
+  { 161, 87, -14528, 24000, -29, 71, -24, 47, 43, -16, -4, 22 },
+  { 161, 87, -14528, 24000, -29, 71, -24, 47, 43, -16, 16, 4 },
+  { 161, 95, -14528, 24000, -29, 71, -35, 58, 31, -16, 16, 4 },
+  { 161, 102, -14528, 25152, -43, 71, -35, 69, 31, -16, 37, 4 },
+  { 161, 106, -18368, 25152, -43, 85, -35, 80, 7, -16, 37, -15 },
+  { 161, 110, -14528, 22656, -43, 71, -35, 69, 19, -16, 16, 4 },
+  { 161, 128, -10048, 17856, -43, 57, -1, 14, 55, 7, -4, 22 },
+  { 161, 133, -10048, 15936, -43, 43, -24, 36, 43, 7, -24, 4 },
+  { 161, 133, -10048, 6720, -56, 43, -24, 25, 43, 31, -24, 22 },
+  { 32, 110, -18368, 4160, -16, 1, -12, 36, 19, 7, -24, 22 },
+  { 10, 85, -10048, -1088, 25, 85, -12, 3, 7, 31, -4, 22 },
+  { 41, 61, 18368, 22656, 11, 57, -12, 36, 19, 31, -4, 22 },
+  { 15, 0, 14528, 13824, -56, 1, -12, 36, 19, 31, -4, 22 },
+  { 20, 0, 18368, 26176, 38, 1, -12, 36, 19, 31, -4, 22 },
+  { 15, 0, 18368, 29120, 52, 15, -12, 36, 19, 31, -4, 22 },
+  { 15, 0, 18368, 26176, 38, 29, -12, 36, 19, 31, -4, 22 },
+  { 10, 0, 14528, 21248, -56, -68, -12, 36, 19, 31, -4, 22 },
+  { 0, 0, 14528, 21248, -56, -68, -12, 36, 19, 31, -4, 22 },
+  { 0, 0, 14528, 21248, -56, -68, -12, 36, 19, 31, -4, 22 },
+  { 2, 26, 0, 1536, -2, 1, -1, 3, -5, 7, -4, 4 },
+  { 0, 26, 0, 1536, -2, 1, -1, 3, -5, 7, -4, 4 },
+  // Word 17
+  { 20, 33, 24256, 13824, 38, 15, -1, 14, 7, 31, 16, 22 },
+  { 7, 0, 14528, -3712, -43, 1, -1, 14, 7, 31, 16, 22 },
+  { 7, 0, 10048, -1088, -29, -26, -1, 14, 7, 31, 16, 22 },
+  { 7, 0, 14528, 1536, -29, -40, -1, 14, 7, 31, 16, 22 },
+  { 10, 0, 10048, -3712, -16, -26, -1, 14, 7, 31, 16, 22 },
+  { 15, 0, 14528, 11584, -16, -26, -1, 14, 7, 31, 16, 22 },
+  { 20, 0, 10048, 9216, -56, -40, -1, 14, 7, 31, 16, 22 },
+  { 161, 51, -10048, -1088, -70, -12, 23, 25, 55, 7, -24, 22 },
+  { 114, 51, -14528, 1536, -97, 29, 11, 91, 19, -40, 16, 4 },
+  { 161, 51, -5184, 1536, -83, 1, -1, 80, 43, -16, -4, -15 },
+  { 161, 51, -5184, -1088, -83, 1, 11, 91, 43, -16, -4, -15 },
+  { 114, 54, -5184, -8768, -70, -12, 23, 80, 31, 7, -24, 22 },
+  { 114, 61, 0, 13824, -97, -40, 11, 58, 43, 31, -24, 22 },
+  { 81, 63, 0, 15936, -97, -26, -1, 58, 43, 31, -24, 22 },
+  { 5, 0, -30848, 1536, -43, 43, -1, 58, 43, 31, -24, 22 },
+  { 5, 0, -24256, -1088, -70, -40, -1, 58, 43, 31, -24, 22 },
+  { 4, 0, -18368, -6272, -29, -68, -1, 58, 43, 31, -24, 22 },
+  { 3, 0, -27968, 24000, -43, -40, -1, 58, 43, 31, -24, 22 },
+  { 32, 87, -28928, 22656, -70, -12, 23, 36, 7, 55, 16, 4 },
+  { 41, 95, -30016, 22656, -56, 71, -47, 25, 79, 31, -44, 32 },
+  { 41, 95, -30336, 19648, -29, 85, -1, -20, 55, 55, -64, 4 },
+  { 161, 95, -21632, 9216, -43, 15, 34, 3, -17, 79, -4, 4 },
+  { 161, 102, -5184, 15936, -43, -40, -1, 25, 19, 55, -44, 22 },
+  { 161, 102, -14528, 9216, -70, -12, -1, 25, 43, 55, -44, 4 },
+  { 114, 102, -18368, 1536, -97, 1, 46, 25, 43, 55, -4, 4 },
+  { 57, 102, -28480, -1088, -56, 57, 57, 14, 31, 7, -44, 22 },
+  { 57, 102, -28480, -3712, -43, 43, 57, 3, 43, 31, -44, 4 },
+  { 5, 0, -30848, -17536, 52, 71, 57, 3, 43, 31, -44, 4 },
+  { 7, 0, 27968, -1088, -83, -12, 57, 3, 43, 31, -44, 4 },
+  { 15, 0, 26368, 9216, -43, 15, 57, 3, 43, 31, -44, 4 },
+  { 161, 95, 14528, 4160, -56, -12, -24, 47, -5, 31, 37, 4 },
+  { 161, 95, -18368, 9216, -43, 15, -12, 47, 7, 31, 16, -15 },
+  { 81, 102, -29376, 19648, -2, 29, 34, 36, -29, 7, -24, -15 },
+  { 81, 102, -27968, 17856, -43, 57, 34, 47, -53, 7, -4, 4 },
+  { 57, 102, -26368, 22656, -83, 85, 23, 36, -17, 31, -44, -15 },
+  { 81, 102, -21632, 19648, -83, 71, 23, 36, -41, 79, -64, 22 },
+  { 57, 102, -21632, 19648, -83, 71, 23, 36, -41, 79, -64, 32 },
+  { 57, 102, -24256, 19648, -83, 99, -24, 14, 7, 31, -44, 22 },
+  { 81, 110, -18368, 21248, -97, 85, -1, 14, -5, 31, -44, -15 },
+  { 57, 110, -21632, 24000, -97, 85, -24, 25, -5, 31, -64, 32 },
+  { 41, 110, -14528, 25152, -97, 85, -70, 47, 7, -40, -24, 22 },
+  { 20, 102, -14528, 24000, -110, 43, -59, 3, 55, 7, -4, 22 },
+  { 3, 0, -32064, 17856, -83, 99, -59, 3, 55, 7, -4, 22 },
+  { 0, 0, -32064, 17856, -83, 99, -59, 3, 55, 7, -4, 22 },
+  { 0, 0, -32064, 17856, -83, 99, -59, 3, 55, 7, -4, 22 },
+  { 2, 20, 0, -1088, -2, 1, -1, 3, 7, 7, -4, 4 },
+  { 0, 20, 0, -1088, -2, 1, -1, 3, 7, 7, -4, 4 },
+  // Word 18
+  { 4, 0, 0, -3712, -2, -12, 0, 0, 0, 0, 0, 0 },
+  { 7, 0, 10048, -6272, -2, -12, 0, 0, 0, 0, 0, 0 },
+  { 7, 0, 18368, -3712, -16, -12, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, 21632, 9216, -2, 15, 0, 0, 0, 0, 0, 0 },
+  { 5, 0, 24256, -3712, -16, 29, 0, 0, 0, 0, 0, 0 },
+  { 81, 53, 26368, 11584, 11, 1, 11, 14, -17, 31, -4, 4 },
+  { 81, 41, 24256, -3712, -16, 1, -12, -9, -5, 55, -4, 4 },
+  { 161, 54, -21632, 11584, -56, 29, -24, 58, 31, -16, 16, -15 },
+  { 161, 54, -21632, 15936, -70, 29, 23, 36, 55, -40, 37, 4 },
+  { 161, 54, -21632, 17856, -70, 15, 23, 36, 55, -40, 16, 22 },
+  { 32, 57, -28480, 9216, -70, 57, -35, 80, 31, 7, 37, -15 },
+  { 15, 57, -31424, 17856, -16, 71, -12, 14, 31, -16, 37, 4 },
+  { 0, 57, -31424, 17856, -16, 71, -12, 14, 31, -16, 37, 4 },
+  { 0, 57, -31424, 17856, -16, 71, -12, 14, 31, -16, 37, 4 },
+  { 7, 0, -26368, 9216, -29, 29, -12, 14, 31, -16, 37, 4 },
+  { 114, 71, -21632, 11584, -56, 29, -24, 36, 67, -16, -4, 22 },
+  { 161, 73, -18368, 6720, -56, 29, -1, 3, 79, 7, -4, 22 },
+  { 161, 73, -21632, 9216, -56, 15, -12, 14, 90, 7, -4, 22 },
+  { 81, 77, -21632, 9216, -43, 1, -1, 25, 67, 55, -44, 32 },
+  { 7, 0, -30336, -8768, 25, 15, -1, 25, 67, 55, -44, 32 },
+  { 7, 0, -5184, -20992, -16, 15, -1, 25, 67, 55, -44, 32 },
+  { 5, 0, 18368, -8768, -16, -12, -1, 25, 67, 55, -44, 32 },
+  { 7, 0, 18368, -1088, 25, 15, -1, 25, 67, 55, -44, 32 },
+  { 10, 0, 18368, -1088, 25, 15, -1, 25, 67, 55, -44, 32 },
+  { 15, 0, -26368, -6272, 25, 1, -1, 25, 67, 55, -44, 32 },
+  { 161, 79, -14528, 13824, -29, 43, -1, 3, 31, 31, -24, 22 },
+  { 161, 79, -18368, 13824, -16, 43, -1, -9, 43, 31, -24, 22 },
+  { 161, 85, -21632, 17856, 11, 29, 11, -9, 43, 55, -24, 4 },
+  { 161, 85, -21632, 21248, 25, 29, 11, -9, 31, 55, -24, 4 },
+  { 114, 87, -24256, 25152, -2, 71, -35, 25, 55, 7, -24, 32 },
+  { 161, 87, -21632, 17856, -2, 43, 34, -31, 31, 31, -24, 22 },
+  { 114, 87, -24256, 17856, 25, 1, 46, 14, 7, 7, -24, 22 },
+  { 161, 87, -18368, 15936, -16, -12, 34, 3, 31, 31, -44, 4 },
+  { 161, 92, -14528, 13824, -43, 15, 34, 14, 43, 7, -64, 22 },
+  { 161, 92, -14528, 15936, -56, 1, -1, 25, 43, 31, -44, 22 },
+  { 114, 92, -18368, 6720, -29, -12, 23, -9, 67, 31, -44, 22 },
+  { 57, 106, -18368, -6272, -2, -54, 23, 47, 19, 79, -44, -15 },
+  { 10, 0, -24256, -20992, 38, 43, 23, 47, 19, 79, -44, -15 },
+  { 10, 0, 14528, -20992, -70, 1, 23, 47, 19, 79, -44, -15 },
+  { 10, 0, 27968, -1088, -83, 15, 23, 47, 19, 79, -44, -15 },
+  { 20, 0, -14528, -20992, -29, 71, 23, 47, 19, 79, -44, -15 },
+  { 161, 92, -10048, 1536, -16, 1, -24, 25, -5, 31, 16, 4 },
+  { 114, 92, -18368, 15936, -83, 29, 11, 14, 31, 55, 16, -15 },
+  { 81, 92, -21632, 13824, -83, 43, -1, 36, 7, 31, -4, -15 },
+  { 81, 92, -18368, 19648, -97, 43, 11, 36, -5, 55, -4, -15 },
+  { 81, 92, -14528, 22656, -97, 43, -1, 25, -5, 55, -24, 4 },
+  { 57, 92, -18368, 21248, -97, 57, -1, 36, -5, 55, -24, -15 },
+  { 41, 95, -21632, 19648, -97, 57, -1, 14, 7, 31, -24, 4 },
+  { 41, 95, -14528, 24000, -97, 43, -12, 14, -5, 55, -24, -15 },
+  { 41, 95, -10048, 26176, -97, 15, -24, 14, -29, 79, -24, -15 },
+  { 20, 95, -14528, 25152, -83, -12, -24, 14, -17, 31, -4, -51 },
+  { 15, 95, -14528, 19648, -83, -12, -12, 14, -5, 7, -4, -51 },
+  { 15, 102, -10048, 22656, -70, 15, -59, 3, -29, 31, 16, -15 },
+  { 15, 92, -10048, 15936, -16, -12, -47, -20, -17, 7, -4, 22 },
+  { 0, 92, -10048, 15936, -16, -12, -47, -20, -17, 7, -4, 22 },
+  { 0, 92, -10048, 15936, -16, -12, -47, -20, -17, 7, -4, 22 },
+  { 0, 92, -10048, 15936, -16, -12, -47, -20, -17, 7, -4, 22 },
+  { 0, 92, -10048, 15936, -16, -12, -47, -20, -17, 7, -4, 22 },
+  // Word 19
+  { 32, 92, -30592, 9216, -2, 43, 34, 14, -17, 31, -24, -33 },
+  { 32, 92, -27968, 1536, -2, 15, -24, 14, -5, 31, -4, 22 },
+  { 32, 87, -26368, 1536, -29, 1, -24, -9, -17, 7, 37, 22 },
+  { 114, 81, -5184, 21248, -2, -12, -24, -9, -29, 7, -4, 4 },
+  { 114, 66, 0, 17856, 38, -12, -24, -31, -53, 7, -4, 22 },
+  { 161, 63, -10048, 9216, -70, -40, -12, 47, 7, 55, -24, 22 },
+  { 161, 63, -18368, 1536, -70, 1, 23, 69, 31, 31, -44, 22 },
+  { 114, 63, -21632, -3712, -56, 15, 46, 80, 7, 31, -44, 22 },
+  { 114, 66, -14528, 4160, -97, 15, 11, 69, 43, 7, -44, 22 },
+  { 81, 71, -14528, -6272, -97, 43, 46, 69, 43, -16, -24, 4 },
+  { 114, 77, -10048, -6272, -83, 1, 46, 58, 55, -16, -24, 22 },
+  { 114, 79, 5184, 6720, -83, -40, -1, 47, 67, 7, -24, 4 },
+  { 114, 77, 18368, 6720, -2, -54, -35, -9, 19, 31, -4, 4 },
+  { 20, 0, 10048, -6272, -29, -54, -35, -9, 19, 31, -4, 4 },
+  { 10, 0, 18368, 1536, -16, -26, -35, -9, 19, 31, -4, 4 },
+  { 15, 0, 14528, 4160, -16, -26, -35, -9, 19, 31, -4, 4 },
+  { 15, 0, 5184, 11584, 11, -54, -35, -9, 19, 31, -4, 4 },
+  { 20, 0, -31552, 6720, -2, 85, -35, -9, 19, 31, -4, 4 },
+  { 114, 87, -21632, -1088, -83, 43, 46, 69, 43, -40, -4, 4 },
+  { 81, 85, -26368, -8768, -16, 43, 81, 47, 7, -40, -4, 32 },
+  { 81, 85, -24256, -6272, -43, 29, 69, 69, 31, -40, -4, 22 },
+  { 114, 81, -21632, -13440, -43, 43, 57, 58, 43, -16, -24, 32 },
+  { 161, 81, -14528, -8768, -70, -12, 34, 80, 55, -16, -4, 4 },
+  { 161, 79, 0, -6272, -70, -26, 23, 80, 79, 7, -24, 22 },
+  { 161, 79, -5184, 1536, -70, -40, 23, 69, 55, 7, -4, 22 },
+  { 161, 77, 0, 15936, -70, -40, -1, 47, 55, 7, -24, 22 },
+  { 161, 69, 0, 19648, -56, -40, 23, 36, 19, 7, -24, 4 },
+  { 161, 69, 0, 17856, -83, 1, 11, 47, 19, 7, -4, 22 },
+  { 161, 66, 0, 15936, -83, 1, 23, 36, 31, 7, -4, 32 },
+  { 161, 66, 0, 17856, -83, 1, 23, 47, 31, 7, -4, 22 },
+  { 161, 73, 0, 19648, -70, -12, -1, 36, 43, 7, -24, 22 },
+  { 161, 79, 0, 11584, -70, -26, 11, 36, 55, 31, -24, -15 },
+  { 161, 85, 5184, 15936, -56, -40, -12, 36, 43, 55, -24, -15 },
+  { 161, 92, 5184, 15936, -70, -54, -1, 47, 43, 55, -24, -15 },
+  { 161, 99, 0, 13824, -83, -26, -1, 36, 55, 55, -24, -15 },
+  { 161, 110, -5184, 9216, -97, 1, 23, 47, 67, 31, -24, 4 },
+  { 161, 115, -5184, 9216, -97, 1, 34, 47, 55, 31, -24, 4 },
+  { 161, 123, 5184, 19648, -97, -26, -1, 58, 55, 55, -4, -15 },
+  { 32, 87, -5184, 6720, -97, 43, 34, 36, 19, 7, -24, 32 },
+  { 0, 87, -5184, 6720, -97, 43, 34, 36, 19, 7, -24, 32 },
+  { 0, 87, -5184, 6720, -97, 43, 34, 36, 19, 7, -24, 32 },
+  { 0, 87, -5184, 6720, -97, 43, 34, 36, 19, 7, -24, 32 },
+  { 0, 87, -5184, 6720, -97, 43, 34, 36, 19, 7, -24, 32 },
+  // Word 20
+  { 15, 81, -28480, 22656, -43, 43, -82, 69, -41, 7, 37, 22 },
+  { 32, 81, -27968, 21248, -2, 15, -59, 14, -5, 79, -44, 77 },
+  { 32, 79, -26368, 11584, 11, 29, -47, -31, -29, 55, -24, 4 },
+  { 81, 73, 5184, 6720, -2, 15, -24, 14, -29, -16, 16, 4 },
+  { 161, 69, -21632, 13824, 11, 29, -1, 3, -17, 31, -24, 22 },
+  { 161, 71, -24256, 17856, 52, 1, -35, 25, -29, 31, 16, 22 },
+  { 161, 71, -24256, 9216, 52, 43, -24, 3, -29, 79, -4, -15 },
+  { 81, 71, -27968, 17856, 52, 57, -35, -20, 7, 102, -24, -15 },
+  { 81, 71, -28480, 21248, 65, 43, -35, -20, -5, 102, -24, -15 },
+  { 41, 71, -29376, 27072, 52, 43, -70, -20, 31, 79, -44, 4 },
+  { 41, 69, -29696, 25152, 79, 1, -59, -20, 31, 79, -44, -15 },
+  { 41, 71, -30016, 26176, 65, 15, -47, -42, 31, 55, -4, 4 },
+  { 57, 71, -27968, 6720, 65, 29, -12, -42, 19, 31, -24, 32 },
+  { 41, 73, -14528, -15552, 11, 43, 11, -9, -29, 31, 16, 22 },
+  { 0, 73, -14528, -15552, 11, 43, 11, -9, -29, 31, 16, 22 },
+  { 0, 73, -14528, -15552, 11, 43, 11, -9, -29, 31, 16, 22 },
+  { 15, 0, -10048, -8768, 11, -26, 11, -9, -29, 31, 16, 22 },
+  { 15, 0, 21632, -8768, -29, 1, 11, -9, -29, 31, 16, 22 },
+  { 32, 0, -26368, -15552, -16, 1, 11, -9, -29, 31, 16, 22 },
+  { 161, 87, 0, 13824, -43, -12, -1, -9, 7, 79, -4, 4 },
+  { 161, 87, 0, 9216, -43, -26, -12, 25, 7, 79, -4, 4 },
+  { 161, 87, 0, 11584, -43, -26, -12, 25, 7, 79, -24, 22 },
+  { 161, 85, 0, 15936, -56, -26, -12, 14, 19, 79, -4, 4 },
+  { 161, 87, 0, 11584, -43, -12, -24, 14, 19, 79, 16, -15 },
+  { 114, 92, 5184, 19648, -83, -12, -35, -9, 7, 79, 37, -15 },
+  { 81, 92, 5184, 15936, -97, 1, -59, 3, 31, 55, 16, 4 },
+  { 20, 95, -5184, 4160, -110, 43, -24, 36, 67, 55, -24, -33 },
+  { 114, 106, 10048, 11584, -70, 15, -24, 25, -17, -16, -4, 22 },
+  { 15, 0, 10048, 6720, -83, -54, -24, 25, -17, -16, -4, 22 },
+  { 20, 0, 10048, 27840, -16, -54, -24, 25, -17, -16, -4, 22 },
+  { 20, 0, 10048, 27840, 11, -12, -24, 25, -17, -16, -4, 22 },
+  { 20, 0, 14528, 27072, 38, 29, -24, 25, -17, -16, -4, 22 },
+  { 20, 0, 10048, 27072, 11, -12, -24, 25, -17, -16, -4, 22 },
+  { 20, 0, 10048, 25152, 11, -12, -24, 25, -17, -16, -4, 22 },
+  { 15, 0, 10048, 27072, -29, -40, -24, 25, -17, -16, -4, 22 },
+  { 15, 0, 5184, 17856, -56, -40, -24, 25, -17, -16, -4, 22 },
+  { 5, 0, 5184, 21248, -56, -26, -24, 25, -17, -16, -4, 22 },
+  { 0, 0, 5184, 21248, -56, -26, -24, 25, -17, -16, -4, 22 },
+  { 0, 0, 5184, 21248, -56, -26, -24, 25, -17, -16, -4, 22 },
+  { 0, 0, 5184, 21248, -56, -26, -24, 25, -17, -16, -4, 22 },
+  // Word 21
+  { 32, 81, -31232, 27840, -16, 29, -12, 25, -5, 31, -24, 4 },
+  { 15, 81, -31424, 30464, -29, -12, -24, 25, 19, 7, -24, 22 },
+  { 20, 77, -30848, 30080, -70, -12, -12, 25, 31, 7, -24, 22 },
+  { 32, 73, -31232, 27840, -29, 1, -12, -9, 31, 7, -4, 4 },
+  { 57, 69, -30592, 25152, -16, 29, -24, 3, 7, 7, -4, 32 },
+  { 81, 66, -29376, 26176, -29, -54, 34, 69, 31, 31, -4, 4 },
+  { 81, 63, -28928, 24000, -56, 15, 34, 47, 19, 31, -44, 32 },
+  { 114, 57, -27968, 6720, -16, 71, 23, 25, 7, 55, -44, 22 },
+  { 161, 57, -26368, 4160, -43, 43, 34, 25, 19, 55, -44, 32 },
+  { 161, 57, -21632, 1536, -70, 71, 57, 58, 7, 7, -4, 22 },
+  { 161, 51, 0, 19648, -83, -26, -1, 58, 55, 31, -4, 4 },
+  { 161, 51, 0, 17856, -97, -26, 23, 47, 67, 31, -4, 4 },
+  { 161, 54, -5184, 11584, -83, -12, 23, 69, 55, 31, -4, 4 },
+  { 161, 59, -5184, 13824, -97, -26, 34, 47, 67, 31, -4, 22 },
+  { 161, 66, -5184, 15936, -97, -26, 34, 47, 67, 55, -24, 22 },
+  { 57, 69, -18368, 6720, -97, 1, 23, 25, 43, 55, -24, 32 },
+  { 41, 81, -26368, 4160, -43, -12, 34, 36, -5, 55, -24, 22 },
+  { 32, 92, -24256, -3712, -56, -12, 46, 58, -17, 55, -44, 22 },
+  { 57, 92, 5184, 4160, -43, -26, -35, 3, -5, 31, -4, 4 },
+  { 5, 0, -26368, -8768, -56, -12, -35, 3, -5, 31, -4, 4 },
+  { 5, 0, -10048, -3712, -29, -26, -35, 3, -5, 31, -4, 4 },
+  { 5, 0, 0, 6720, -16, -12, -35, 3, -5, 31, -4, 4 },
+  { 41, 73, 5184, 9216, 38, 1, -1, 14, 7, 31, -4, 32 },
+  { 57, 73, -18368, -6272, -29, 29, 11, 36, 7, 31, -24, 22 },
+  { 114, 87, -27968, 15936, 38, 57, -24, 3, -17, 31, 16, 4 },
+  { 57, 92, -28480, 17856, 52, 71, -47, -20, -5, 55, 37, 4 },
+  { 41, 92, -28928, 22656, 65, 57, -59, -20, 7, 55, 37, 22 },
+  { 41, 95, -29376, 24000, 52, 57, -59, -9, 7, 31, 37, 22 },
+  { 57, 95, -27968, 21248, 11, 85, -35, -31, -17, 55, 37, 4 },
+  { 57, 95, -26368, 21248, -16, 99, -59, -20, -17, 55, 16, 4 },
+  { 81, 95, -26368, 27840, -16, 15, -12, -20, 7, 55, 16, -15 },
+  { 81, 99, -24256, 26176, -16, 15, 23, -9, -17, 55, 16, -33 },
+  { 81, 99, -24256, 26176, -29, 29, -1, 3, -29, 55, -24, -15 },
+  { 81, 106, -21632, 17856, -56, 29, 23, 14, -53, 31, 37, -15 },
+  { 81, 106, -24256, 9216, -56, -12, 11, 25, -29, 7, 57, 4 },
+  { 57, 106, -24256, 11584, -70, 1, -1, 25, -41, 31, 37, -15 },
+  { 41, 102, -27968, 9216, -83, 43, 23, 14, -17, 55, 16, 4 },
+  { 41, 106, -21632, 6720, -97, 29, 11, 25, -5, 55, -4, 4 },
+  { 41, 106, -18368, 9216, -97, 1, 11, 47, -5, 55, -4, -33 },
+  { 20, 77, -26368, 1536, -83, 57, 46, 47, -17, 55, 16, -51 },
+  { 10, 106, -29376, 4160, -29, 43, 11, 69, -17, 102, -64, -33 },
+  { 7, 106, -24256, -1088, -56, 15, -1, 69, -17, 79, -44, 4 },
+  { 0, 106, -24256, -1088, -56, 15, -1, 69, -17, 79, -44, 4 },
+  { 0, 106, -24256, -1088, -56, 15, -1, 69, -17, 79, -44, 4 },
+  { 0, 106, -24256, -1088, -56, 15, -1, 69, -17, 79, -44, 4 },
+  { 0, 106, -24256, -1088, -56, 15, -1, 69, -17, 79, -44, 4 },
+};
+
+static const uint16_t bank_4_boundaries[] = {
+  0, 36, 72, 108, 151, 186, 241, 277, 329, 375, 416, 445,
+  483, 524, 574, 617, 661, 692, 739, 797, 840, 880, 926
+};
+
+/* extern */
+const LPCSpeechSynthRawWordBankData decoded_word_banks_[] = {
+  { bank_0_frames, bank_0_boundaries, 229, 7 },
+  { bank_1_frames, bank_1_boundaries, 229, 11 },
+  { bank_2_frames, bank_2_boundaries, 524, 26 },
+  { bank_3_frames, bank_3_boundaries, 604, 26 },
+  { bank_4_frames, bank_4_boundaries, 926, 22 },
+};
+
+}  // namespace plaits
@@ -43,6 +43,10 @@ extern const uint8_t bank_4[4802];
 
 extern const LPCSpeechSynthWordBankData word_banks_[LPC_SPEECH_SYNTH_NUM_WORD_BANKS];
 
+// The same banks as decoded frames (lpc_speech_synth_decoded_words.cc).
+extern const LPCSpeechSynthRawWordBankData decoded_word_banks_[
+    LPC_SPEECH_SYNTH_NUM_WORD_BANKS];
+
 }  // namespace plaits
 
 #endif  // PLAITS_DSP_SPEECH_LPC_SPEECH_SYNTH_WORDS_H_
@@ -0,0 +1,67 @@
+// Copyright 2026 Rubato Audio.
+
+#ifndef PLAITS_DSP_STAGGERED_REFRESH_H_
+#define PLAITS_DSP_STAGGERED_REFRESH_H_
+
+#include "stmlib/stmlib.h"
+
+namespace plaits {
+
+// Spreads the refresh of an engine's num_items coefficient sets (one per
+// voice, partial, grain...) over consecutive blocks, so that no block pays for
+// more than `budget` of them. Every item is refreshed once every num_slices()
+// blocks. The slices differ in size by one item at most: the audio deadline
+// is per block, and the point is the flat load -- refreshing everything on
+// alternate blocks halves the average but leaves the peak block as heavy as
+// before (see "Stagger slow work across blocks" in PERFORMANCE.md).
+//
+//   const int slice = refresh_.Next();
+//   for (int i = refresh_.begin(slice); i < refresh_.end(slice); ++i) {
+//     ... recompute the coefficients of item i ...
+//   }
+class StaggeredRefresh {
+ public:
+  StaggeredRefresh() { }
+  ~StaggeredRefresh() { }
+
+  void Init(int num_items, int budget) {
+    num_items_ = num_items;
+    num_slices_ = (num_items + budget - 1) / budget;
+    Reset();
+  }
+
+  // The next block refreshes the first slice.
+  void Reset() {
+    slice_ = 0;
+  }
+
+  // Returns the slice to refresh in this block, and moves on to the next one.
+  inline int Next() {
+    const int slice = slice_;
+    slice_ = slice + 1 == num_slices_ ? 0 : slice + 1;
+    return slice;
+  }
+
+  inline int begin(int slice) const {
+    return slice * num_items_ / num_slices_;
+  }
+
+  inline int end(int slice) const {
+    return (slice + 1) * num_items_ / num_slices_;
+  }
+
+  inline int num_slices() const {
+    return num_slices_;
+  }
+
+ private:
+  int num_items_;
+  int num_slices_;
+  int slice_;
+
+  DISALLOW_COPY_AND_ASSIGN(StaggeredRefresh);
+};
+
+}  // namespace plaits
+
+#endif  // PLAITS_DSP_STAGGERED_REFRESH_H_
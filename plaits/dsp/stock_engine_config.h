@@ -35,29 +35,30 @@
 #define PLAITS_HAS_USER_DATA_BANK 1
 #define PLAITS_HAS_USER_DATA_BANK_OVERRIDE 0
 
+#define PLAITS_ENGINE_OVERLAY 1
 #define PLAITS_ENGINE_MEMBERS \
-  VirtualAnalogVCFEngine virtual_analog_vcf_engine_; \
-  PhaseDistortionEngine phase_distortion_engine_; \
-  SixOpEngine six_op_engine_; \
-  WaveTerrainEngine wave_terrain_engine_; \
-  StringMachineEngine string_machine_engine_; \
-  ChiptuneEngine chiptune_engine_; \
-  VirtualAnalogEngine virtual_analog_engine_; \
-  WaveshapingEngine waveshaping_engine_; \
-  FMEngine fm_engine_; \
-  GrainEngine grain_engine_; \
-  AdditiveEngine additive_engine_; \
-  WavetableEngine wavetable_engine_; \
-  ChordEngine chord_engine_; \
-  SpeechEngine speech_engine_; \
-  SwarmEngine swarm_engine_; \
-  NoiseEngine noise_engine_; \
-  ParticleEngine particle_engine_; \
-  StringEngine string_engine_; \
-  ModalEngine modal_engine_; \
-  BassDrumEngine bass_drum_engine_; \
-  SnareDrumEngine snare_drum_engine_; \
-  HiHatEngine hi_hat_engine_;
+  PLAITS_ENGINE_MEMBER(VirtualAnalogVCFEngine, virtual_analog_vcf_engine_) \
+  PLAITS_ENGINE_MEMBER(PhaseDistortionEngine, phase_distortion_engine_) \
+  PLAITS_ENGINE_MEMBER(SixOpEngine, six_op_engine_) \
+  PLAITS_ENGINE_MEMBER(WaveTerrainEngine, wave_terrain_engine_) \
+  PLAITS_ENGINE_MEMBER(StringMachineEngine, string_machine_engine_) \
+  PLAITS_ENGINE_MEMBER(ChiptuneEngine, chiptune_engine_) \
+  PLAITS_ENGINE_MEMBER(VirtualAnalogEngine, virtual_analog_engine_) \
+  PLAITS_ENGINE_MEMBER(WaveshapingEngine, waveshaping_engine_) \
+  PLAITS_ENGINE_MEMBER(FMEngine, fm_engine_) \
+  PLAITS_ENGINE_MEMBER(GrainEngine, grain_engine_) \
+  PLAITS_ENGINE_MEMBER(AdditiveEngine, additive_engine_) \
+  PLAITS_ENGINE_MEMBER(WavetableEngine, wavetable_engine_) \
+  PLAITS_ENGINE_MEMBER(ChordEngine, chord_engine_) \
+  PLAITS_ENGINE_MEMBER(SpeechEngine, speech_engine_) \
+  PLAITS_ENGINE_MEMBER(SwarmEngine, swarm_engine_) \
+  PLAITS_ENGINE_MEMBER(NoiseEngine, noise_engine_) \
+  PLAITS_ENGINE_MEMBER(ParticleEngine, particle_engine_) \
+  PLAITS_ENGINE_MEMBER(StringEngine, string_engine_) \
+  PLAITS_ENGINE_MEMBER(ModalEngine, modal_engine_) \
+  PLAITS_ENGINE_MEMBER(BassDrumEngine, bass_drum_engine_) \
+  PLAITS_ENGINE_MEMBER(SnareDrumEngine, snare_drum_engine_) \
+  PLAITS_ENGINE_MEMBER(HiHatEngine, hi_hat_engine_)
 
 #define PLAITS_REGISTER_ENGINES(registry) do { \
   (registry).RegisterInstance(&virtual_analog_vcf_engine_, false, 1.0f, 1.0f); \
@@ -61,13 +61,21 @@ static const float kLinearTzfmHzPerVolt = 1000.0f;
 #endif
 
 void Voice::Init(BufferAllocator* allocator) {
-  engines_.Init();
+#if PLAITS_ENGINE_OVERLAY
+  engines_.Init(&engine_overlay_);
+#else
+  engines_.Init(NULL);
+#endif  // PLAITS_ENGINE_OVERLAY
   PLAITS_REGISTER_ENGINES(engines_);
   
+  // All engines will share the same RAM space. Overlay engines are only
+  // constructed and Init()ed when selected (see Render).
+  allocator_ = allocator;
   for (int i = 0; i < engines_.size(); ++i) {
-    // All engines will share the same RAM space.
-    allocator->Free();
-    engines_.get(i)->Init(allocator);
+    if (engines_.resident(i)) {
+      allocator->Free();
+      engines_.get(i)->Init(allocator);
+    }
   }
 
   square_oscillator_.Init();
@@ -166,8 +174,10 @@ void Voice::Render(
       patch.engine,
       patch.model_cv_option == 0 ? engine_cv_ : 0.0f);
   
-  Engine* e = engines_.get(engine_index);
-  const PostProcessingSettings& pp_s = e->post_processing_settings;
+  // A change of model is handled further down (user data, Reset), but an
+  // overlay engine has to be constructed before anything queries it.
+  Engine* e = engines_.Activate(engine_index, allocator_);
+  const PostProcessingSettings& pp_s = engines_.settings(engine_index);
 
   // LEVEL option 2 is Auto: feed the outer envelope's decay on ordinary
   // oscillator engines, but preserve LEVEL as accent/velocity whenever the
@@ -462,10 +472,12 @@ void Voice::Render(
   if (kSpeechEngineMask & (1u << engine_index)) {
     internal_envelope_amplitude = 2.0f - p.harmonics * 6.0f;
     CONSTRAIN(internal_envelope_amplitude, 0.0f, 1.0f);
-    speech_engine_.set_prosody_amount(
+    // Through e: with the engine overlay, speech_engine_ is only a slot.
+    SpeechEngine* speech_engine = static_cast<SpeechEngine*>(e);
+    speech_engine->set_prosody_amount(
         !modulations.trigger_patched || modulations.frequency_patched ?
             0.0f : patch.frequency_modulation_amount);
-    speech_engine_.set_speed( 
+    speech_engine->set_speed( 
         !modulations.trigger_patched || modulations.morph_patched ?
             0.0f : patch.morph_modulation_amount);
   }
@@ -477,7 +489,7 @@ void Voice::Render(
     // ordinary trigger-driven pitch envelope so this remains a single-purpose
     // gesture; patched FM still modulates pitch normally.
     internal_envelope_amplitude = 0.0f;
-    lpc_speech_engine_.set_prosody_amount(
+    static_cast<LPCSpeechEngine*>(e)->set_prosody_amount(
         !modulations.trigger_patched || modulations.frequency_patched ?
             0.0f : patch.frequency_modulation_amount);
   }
@@ -488,9 +500,9 @@ void Voice::Render(
       // Disable internal envelope on TIMBRE, and enable the envelope generator
       // built into the chiptune engine.
       internal_envelope_amplitude_timbre = 0.0f;
-      chiptune_engine_.set_envelope_shape(patch.timbre_modulation_amount);
+      static_cast<ChiptuneEngine*>(e)->set_envelope_shape(patch.timbre_modulation_amount);
     } else {
-      chiptune_engine_.set_envelope_shape(ChiptuneEngine::NO_ENVELOPE);
+      static_cast<ChiptuneEngine*>(e)->set_envelope_shape(ChiptuneEngine::NO_ENVELOPE);
     }
   }
 #endif
@@ -682,25 +694,20 @@ void Voice::Render(
     lpg_envelope_.Init();
   }
   
-  out_post_processor_.Process(
+  ChannelPostProcessor::Process(
+      &out_post_processor_,
+      &aux_post_processor_,
       pp_s.out_gain,
-      lpg_bypass,
-      lpg_envelope_.gain(),
-      lpg_envelope_.frequency(),
-      lpg_envelope_.hf_bleed(),
-      out_buffer_,
-      &frames->out,
-      size,
-      2);
-
-  aux_post_processor_.Process(
       // A stereo pair must leave with the same gain on both channels.
       stereo_render ? pp_s.out_gain : pp_s.aux_gain,
+      lpg_bypass,
       aux_lpg_bypass,
       lpg_envelope_.gain(),
       lpg_envelope_.frequency(),
       lpg_envelope_.hf_bleed(),
+      out_buffer_,
       aux_buffer_,
+      &frames->out,
       &frames->aux,
       size,
       2);
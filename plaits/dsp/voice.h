@@ -42,6 +42,14 @@
 #else
 #include "plaits/dsp/engine_config.h"
 #endif
+// A config that declares its engines with PLAITS_ENGINE_MEMBER(Class, member)
+// sets this to 1: the voice then holds a one-byte EngineSlot per engine plus
+// one block sized for the largest, and only the selected engine is constructed
+// there (see EngineRegistry). Configs that list plain members keep every
+// engine resident.
+#ifndef PLAITS_ENGINE_OVERLAY
+#define PLAITS_ENGINE_OVERLAY 0
+#endif
 // After the engine config: a generated config may define PLAITS_ENGINE_COUNT,
 // and build_config.h defaults it to 24 otherwise.
 #include "plaits/build_config.h"
@@ -58,6 +66,20 @@
 namespace plaits {
 
 const int kMaxEngines = PLAITS_ENGINE_COUNT;
+
+#if PLAITS_ENGINE_OVERLAY
+// Storage shared by the overlay engines: as large as the largest, aligned for
+// any of them (engines hold floats, integers and pointers).
+#define PLAITS_ENGINE_MEMBER(Class, member) char member[sizeof(Class)];
+union EngineOverlayStorage {
+  PLAITS_ENGINE_MEMBERS
+  double alignment_double;
+  uint64_t alignment_integer;
+  void* alignment_pointer;
+};
+#undef PLAITS_ENGINE_MEMBER
+#endif  // PLAITS_ENGINE_OVERLAY
+
 const int kMaxTriggerDelay = 8;
 const int kTriggerDelay = 5;
 
@@ -106,6 +128,58 @@ class ChannelPostProcessor {
     }
   }
   
+  // OUT and AUX go through gates opened by the same envelope. When neither
+  // bypasses it, both are rendered in one pass (see LowPassGate::Process).
+  static void Process(
+      ChannelPostProcessor* out_processor,
+      ChannelPostProcessor* aux_processor,
+      float out_gain,
+      float aux_gain,
+      bool bypass_out_lpg,
+      bool bypass_aux_lpg,
+      float low_pass_gate_gain,
+      float low_pass_gate_frequency,
+      float low_pass_gate_hf_bleed,
+      float* out_in,
+      float* aux_in,
+      short* out,
+      short* aux,
+      size_t size,
+      size_t stride) {
+    if (bypass_out_lpg || bypass_aux_lpg) {
+      out_processor->Process(
+          out_gain, bypass_out_lpg, low_pass_gate_gain,
+          low_pass_gate_frequency, low_pass_gate_hf_bleed,
+          out_in, out, size, stride);
+      aux_processor->Process(
+          aux_gain, bypass_aux_lpg, low_pass_gate_gain,
+          low_pass_gate_frequency, low_pass_gate_hf_bleed,
+          aux_in, aux, size, stride);
+      return;
+    }
+    if (out_gain < 0.0f) {
+      out_processor->limiter_.Process(-out_gain, out_in, size);
+    }
+    if (aux_gain < 0.0f) {
+      aux_processor->limiter_.Process(-aux_gain, aux_in, size);
+    }
+    const float out_post_gain = (out_gain < 0.0f ? 1.0f : out_gain) * -32767.0f;
+    const float aux_post_gain = (aux_gain < 0.0f ? 1.0f : aux_gain) * -32767.0f;
+    LowPassGate::Process(
+        &out_processor->lpg_,
+        &aux_processor->lpg_,
+        out_post_gain * low_pass_gate_gain,
+        aux_post_gain * low_pass_gate_gain,
+        low_pass_gate_frequency,
+        low_pass_gate_hf_bleed,
+        out_in,
+        aux_in,
+        out,
+        aux,
+        size,
+        stride);
+  }
+  
  private:
   stmlib::Limiter limiter_;
   LowPassGate lpg_;
@@ -270,7 +344,17 @@ class Voice {
     return value;
   }
 
+#if PLAITS_ENGINE_OVERLAY
+#define PLAITS_ENGINE_MEMBER(Class, member) EngineSlot<Class> member;
+  PLAITS_ENGINE_MEMBERS
+#undef PLAITS_ENGINE_MEMBER
+  EngineOverlayStorage engine_overlay_;
+#else
   PLAITS_ENGINE_MEMBERS
+#endif  // PLAITS_ENGINE_OVERLAY
+  // The arena every engine Init()s from. Overlay engines are Init()ed on a
+  // model change, so it has to outlive the voice.
+  stmlib::BufferAllocator* allocator_;
 
   FastSineOscillator sine_oscillator_;
   SquareOscillator square_oscillator_;
@@ -70,6 +70,8 @@ TzfmDiagnostic tzfm_diagnostic;
 #endif
 
 char shared_buffer[16384];
+// Outlives Init(): the voice Inits the selected engine from it on model changes.
+BufferAllocator allocator;
 uint32_t test_ramp;
 
 // Default interrupt handlers.
@@ -213,7 +215,7 @@ void Init() {
   IWDG_WriteAccessCmd(IWDG_WriteAccess_Enable);
   IWDG_SetPrescaler(IWDG_Prescaler_16);
   
-  BufferAllocator allocator(shared_buffer, 16384);
+  allocator.Init(shared_buffer, 16384);
   voice.Init(&allocator);
   user_data_receiver.Init(
       (uint8_t*)(&shared_buffer[16384 - UserData::SIZE]),
@@ -0,0 +1,334 @@
+// Offline batch renderer for the whole Plaits engine catalog.
+//
+// render_model.cc (alt_firmwares/plaits_lab_sdk) renders one engine chosen at
+// compile time, so auditioning a recipe costs one compile and one process per
+// model. This binary links every engine of plaits/dsp/engine and engine2 once
+// and renders a whole batch of jobs in parallel, one job per worker thread at
+// a time, writing one stereo WAV (OUT left, AUX right) per job.
+//
+//   batch_render [-j <threads>] <jobs.txt | ->
+//
+// One job per line, '#' starting a comment. The fields are render_model.cc's
+// arguments preceded by the catalog id, plus an optional user-data bank:
+//   <catalog-id> <output.wav> <seconds> <note> <harmonics_start> <harmonics_end>
+//   <timbre_start> <timbre_end> <morph_start> <morph_end> <macro_start>
+//   <macro_end> <trigger_hz> <out_gain> <aux_gain> [<user_data_bank>]
+// The parameters ramp linearly from start to end over the render, as in
+// render_model.cc, so the same automation produces the same file with either
+// tool. The dx7-bank-* ids load their factory bank unless a bank is given.
+//
+// Jobs are dealt round-robin, longest first, to one queue per worker. A worker
+// takes from the front of its own queue and, once that runs dry, steals from
+// the back of another worker's, so a batch with a few long renders still keeps
+// every core busy until the end. Each job renders into its own engine instance
+// and arena; stmlib::Random is the only state the engines share, so the
+// noise-driven engines are not bit-reproducible across parallel runs. Build/run
+// with `make batch-render JOBS=<file>`.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+#include "plaits/dsp/dsp.h"
+#include "plaits/resources.h"
+#include "plaits/test/engine_catalog.h"
+#include "stmlib/test/wav_writer.h"
+
+using namespace plaits;
+using namespace stmlib;
+
+const int kMaxDuration = 600;
+
+struct Job {
+  std::string engine;
+  std::string output;
+  int duration;
+  float note;
+  float harmonics[2];
+  float timbre[2];
+  float morph[2];
+  float macro[2];
+  float trigger_hz;
+  float out_gain;
+  float aux_gain;
+  int user_data_bank;
+  int line;
+};
+
+class WorkQueue {
+ public:
+  void Push(size_t job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(job);
+  }
+
+  bool Take(size_t* job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (jobs_.empty()) {
+      return false;
+    }
+    *job = jobs_.front();
+    jobs_.pop_front();
+    return true;
+  }
+
+  bool Steal(size_t* job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (jobs_.empty()) {
+      return false;
+    }
+    *job = jobs_.back();
+    jobs_.pop_back();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::deque<size_t> jobs_;
+};
+
+std::vector<Job> jobs;
+std::mutex output_mutex;
+std::atomic<int> num_failures(0);
+std::atomic<int> num_steals(0);
+
+float Interpolate(const float* range, float position) {
+  return range[0] + (range[1] - range[0]) * position;
+}
+
+bool Render(const Job& job) {
+  const EngineEntry* entry = FindEngine(job.engine.c_str());
+  if (!entry) {
+    std::lock_guard<std::mutex> lock(output_mutex);
+    fprintf(stderr, "line %d: unknown engine %s\n", job.line, job.engine.c_str());
+    return false;
+  }
+
+  std::vector<uint64_t> storage;
+  Engine* engine = CreateCatalogEngine(*entry, &storage);
+  const int bank = job.user_data_bank >= 0
+      ? job.user_data_bank
+      : entry->user_data_bank;
+  engine->LoadUserData(bank >= 0 ? fm_patches_table[bank] : NULL);
+  engine->Reset();
+
+  WavWriter writer(2, static_cast<size_t>(kSampleRate), job.duration);
+  if (!writer.Open(job.output.c_str())) {
+    std::lock_guard<std::mutex> lock(output_mutex);
+    perror(job.output.c_str());
+    entry->destroy(engine);
+    return false;
+  }
+
+  EngineParameters parameters;
+  parameters.note = job.note;
+  parameters.accent = 0.8f;
+  parameters.chord_set_option = 0;
+
+  const size_t total_frames = static_cast<size_t>(job.duration * kSampleRate);
+  const size_t trigger_period = job.trigger_hz > 0.0f
+      ? static_cast<size_t>(kSampleRate / job.trigger_hz)
+      : 0;
+  float peak = 0.0f;
+  bool finite = true;
+  for (size_t frame = 0; frame < total_frames && finite; frame += kBlockSize) {
+    const float position =
+        static_cast<float>(frame) / static_cast<float>(total_frames - 1);
+    parameters.harmonics = Interpolate(job.harmonics, position);
+    parameters.timbre = Interpolate(job.timbre, position);
+    parameters.morph = Interpolate(job.morph, position);
+    parameters.macro = Interpolate(job.macro, position);
+    if (!trigger_period) {
+      parameters.trigger = TRIGGER_UNPATCHED;
+    } else {
+      const size_t phase = frame % trigger_period;
+      parameters.trigger = phase < trigger_period / 4
+          ? TRIGGER_HIGH
+          : TRIGGER_LOW;
+      if (phase < kBlockSize) {
+        parameters.trigger |= TRIGGER_RISING_EDGE;
+      }
+    }
+
+    float out[kBlockSize];
+    float aux[kBlockSize];
+    bool already_enveloped = false;
+    engine->Render(parameters, out, aux, kBlockSize, &already_enveloped);
+    for (size_t i = 0; i < kBlockSize; ++i) {
+      if (!std::isfinite(out[i]) || !std::isfinite(aux[i])) {
+        std::lock_guard<std::mutex> lock(output_mutex);
+        fprintf(stderr, "%s: non-finite output at frame %zu\n",
+                job.output.c_str(), frame + i);
+        finite = false;
+        break;
+      }
+      out[i] *= std::fabs(job.out_gain);
+      aux[i] *= std::fabs(job.aux_gain);
+      peak = std::fmax(peak, std::fmax(std::fabs(out[i]), std::fabs(aux[i])));
+    }
+    writer.Write(out, aux, kBlockSize);
+  }
+  entry->destroy(engine);
+  if (finite) {
+    std::lock_guard<std::mutex> lock(output_mutex);
+    printf("rendered %s (%s, %d s, peak %.4f)\n",
+           job.output.c_str(), job.engine.c_str(), job.duration, peak);
+    fflush(stdout);
+  }
+  return finite;
+}
+
+void Work(std::vector<WorkQueue>* queues, size_t self) {
+#if defined(__SSE2__)
+  // The Cortex-M4 FPU flushes denormals in hardware. The MXCSR is per thread,
+  // so every worker sets it for itself.
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+  const size_t num_queues = queues->size();
+  size_t job;
+  while (true) {
+    bool found = (*queues)[self].Take(&job);
+    for (size_t i = 1; i < num_queues && !found; ++i) {
+      found = (*queues)[(self + i) % num_queues].Steal(&job);
+      if (found) {
+        ++num_steals;
+      }
+    }
+    // No job is ever queued after the workers start, so empty queues
+    // everywhere mean the batch is done.
+    if (!found) {
+      return;
+    }
+    if (!Render(jobs[job])) {
+      ++num_failures;
+    }
+  }
+}
+
+bool ParseJobs(FILE* fp) {
+  char line[1024];
+  int line_number = 0;
+  while (fgets(line, sizeof(line), fp)) {
+    ++line_number;
+    char* comment = strchr(line, '#');
+    if (comment) {
+      *comment = '\0';
+    }
+    char engine[128];
+    char output[512];
+    Job job;
+    job.user_data_bank = -1;
+    job.line = line_number;
+    const int num_fields = sscanf(
+        line, "%127s %511s %d %f %f %f %f %f %f %f %f %f %f %f %f %d",
+        engine, output, &job.duration, &job.note,
+        &job.harmonics[0], &job.harmonics[1],
+        &job.timbre[0], &job.timbre[1],
+        &job.morph[0], &job.morph[1],
+        &job.macro[0], &job.macro[1],
+        &job.trigger_hz, &job.out_gain, &job.aux_gain,
+        &job.user_data_bank);
+    if (num_fields <= 0) {
+      continue;
+    }
+    if (num_fields < 15) {
+      fprintf(stderr, "line %d: expected at least 15 fields, got %d\n",
+              line_number, num_fields);
+      return false;
+    }
+    if (job.duration < 1 || job.duration > kMaxDuration) {
+      fprintf(stderr, "line %d: duration must be between 1 and %d seconds\n",
+              line_number, kMaxDuration);
+      return false;
+    }
+    if (job.user_data_bank > 2) {
+      fprintf(stderr, "line %d: no user-data bank %d\n",
+              line_number, job.user_data_bank);
+      return false;
+    }
+    if (!FindEngine(engine)) {
+      fprintf(stderr, "line %d: unknown engine %s\n", line_number, engine);
+      return false;
+    }
+    job.engine = engine;
+    job.output = output;
+    jobs.push_back(job);
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  size_t num_threads = std::thread::hardware_concurrency();
+  int arg = 1;
+  if (arg + 1 < argc && !strcmp(argv[arg], "-j")) {
+    num_threads = atoi(argv[arg + 1]);
+    arg += 2;
+  }
+  if (arg + 1 != argc || num_threads < 1) {
+    fprintf(stderr, "usage: %s [-j <threads>] <jobs.txt | ->\n", argv[0]);
+    return 2;
+  }
+
+  FILE* fp = strcmp(argv[arg], "-") ? fopen(argv[arg], "r") : stdin;
+  if (!fp) {
+    perror(argv[arg]);
+    return 2;
+  }
+  const bool parsed = ParseJobs(fp);
+  if (fp != stdin) {
+    fclose(fp);
+  }
+  if (!parsed) {
+    return 2;
+  }
+
+  std::vector<size_t> order(jobs.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [](size_t a, size_t b) {
+    return jobs[a].duration > jobs[b].duration;
+  });
+  num_threads = std::min(num_threads, std::max(jobs.size(), size_t(1)));
+  std::vector<WorkQueue> queues(num_threads);
+  for (size_t i = 0; i < order.size(); ++i) {
+    queues[i % num_threads].Push(order[i]);
+  }
+
+  const std::chrono::steady_clock::time_point started =
+      std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < num_threads; ++i) {
+    workers.push_back(std::thread(Work, &queues, i));
+  }
+  for (size_t i = 0; i < workers.size(); ++i) {
+    workers[i].join();
+  }
+  const double elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - started).count();
+
+  double audio_seconds = 0.0;
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    audio_seconds += jobs[i].duration;
+  }
+  printf("%zu jobs, %d failed, %zu threads, %d steals: "
+         "%.1f s of audio in %.2f s (%.1fx real time)\n",
+         jobs.size(), num_failures.load(), num_threads, num_steals.load(),
+         audio_seconds, elapsed, elapsed > 0.0 ? audio_seconds / elapsed : 0.0);
+  return num_failures ? 3 : 0;
+}
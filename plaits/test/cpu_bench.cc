@@ -11,10 +11,46 @@
 // The absolute nanoseconds are host x86 numbers, NOT the module's cycle budget
 // — use the RATIOS (stereo/mono, %-of-heaviest, unroll on/off), which are
 // architecture-robust. Build/run with `make cpu-bench` (see plaits/test/makefile).
+//
+// `cpu_bench --sweep [<catalog-id>...]` instead walks each engine across a grid
+// of harmonics/timbre/morph/macro/note and free-running vs struck states, times
+// every block on its own, and prints
+//   <catalog-id> <median_ns> <p99_ns> <worst_ns> h=.. t=.. m=.. x=.. note=.. <trig>
+// where the trailing fields are the grid point that produced the worst block.
+// The audio deadline is per block, so an engine that is cheap on average but
+// spikes at one knob corner shows up here and not in the flat run. Engines
+// that keep derived coefficients in a plaits::ParameterCache append
+//   cache=<hits>/<misses>
+// counted over the whole sweep: the knobs rest for kSweepBlocksPerPoint
+// blocks between moves, so a low hit count means the cache key moves with
+// something other than the knobs. Build/run with `make cpu-bench-sweep`.
+//
+// `cpu_bench --ratios [<catalog-id>...]` prints what the render-cost
+// regression gate (plaits/tools/cpu_regression.py) stores and compares,
+//   <catalog-id> <mono> <stereo> <worst>
+// each the engine's cost over the stock two-op-fm engine's: flat mono, flat
+// stereo, and the confirmed worst sweep block. Build/run with
+// `make cpu-regression`.
+//
+// `cpu_bench --stereo [--limit <x>] [<catalog-id>...]` breaks down the stereo
+// overhead of every stereo_capable() engine, per 12-sample firmware block:
+//   <catalog-id> <mono_ns> <stereo_ns> <stereo/mono>x <fixed_ns> <sample_ns>
+// where fixed_ns is the part of stereo - mono paid once per block (pan and
+// spread gains, coefficient setup) and sample_ns the part that scales with
+// the block (duplicated filters, second voices, decorrelators). A fixed part
+// is cheap to hoist or cache; a per-sample part is what the stereo path
+// actually costs. Either can be negative where the stereo path skips mono-only
+// work (virtual-analog drops its sync oscillator for AUX). Engines whose
+// stereo costs more than <x> (default 2) times mono are marked OVER and the
+// exit status is 1, so a recipe's stereo flags can be checked against the
+// budget. Others print "mono-only". Build/run with `make cpu-bench-stereo`.
+#include <algorithm>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <chrono>
 #include <csignal>
+#include <vector>
 #include <unistd.h>
 #include <sys/wait.h>
 #include <xmmintrin.h>
@@ -22,6 +58,7 @@
 
 #include "plaits/dsp/dsp.h"
 #include "plaits/dsp/engine/engine.h"
+#include "plaits/dsp/parameter_cache.h"
 #include "plaits/dsp/engine/additive_engine.h"
 #include "plaits/dsp/engine/bass_drum_engine.h"
 #include "plaits/dsp/engine/chord_engine.h"
@@ -44,6 +81,7 @@
 #include "plaits/dsp/engine2/chiptune_engine.h"
 #include "plaits/dsp/engine2/gendy_engine.h"
 #include "plaits/dsp/engine2/glisson_engine.h"
+#include "plaits/dsp/engine2/helix_engine.h"
 #include "plaits/dsp/engine2/lockstep_engine.h"
 #include "plaits/dsp/engine2/loopback_engine.h"
 #include "plaits/dsp/engine2/phase_distortion_engine.h"
@@ -54,6 +92,7 @@
 #include "plaits/dsp/engine2/rulefield_engine.h"
 #include "plaits/dsp/engine2/scanned_engine.h"
 #include "plaits/dsp/engine2/sideband_engine.h"
+#include "plaits/dsp/engine2/six_op_engine.h"
 #include "plaits/dsp/engine2/spectral_spiral_engine.h"
 #include "plaits/dsp/engine2/bowed_engine.h"
 #include "plaits/dsp/engine2/question_mark_engine.h"
@@ -106,6 +145,7 @@
 #include "plaits/dsp/engine2/undertow_engine.h"
 #include "plaits/dsp/engine2/virtual_analog_vcf_engine.h"
 #include "plaits/dsp/engine2/wave_terrain_engine.h"
+#include "plaits/resources.h"
 
 using namespace plaits;
 using namespace stmlib;
@@ -113,6 +153,19 @@ static char ram[128 * 1024];
 const size_t B = 24;
 const int N = 120000;
 
+// After Init(), every engine is given its user data and reset, as Voice does
+// on a model change: the six-op engine gets its DX7 bank, the others NULL. For
+// the wavetable engine, NULL selects the built-in waves; without the call it
+// would render from an unset wave map.
+static const uint8_t* user_data = NULL;
+
+template <typename E>
+void init_engine(E* e, BufferAllocator* allocator) {
+  e->Init(allocator);
+  e->LoadUserData(user_data);
+  e->Reset();
+}
+
 template <typename E>
 void bench_one(const char* name) {
   // Flush denormals to zero (both operands and results). The Cortex-M4 FPU
@@ -124,7 +177,7 @@ void bench_one(const char* name) {
   alarm(8);
   BufferAllocator allocator(ram, sizeof(ram));
   E e;
-  e.Init(&allocator);
+  init_engine(&e, &allocator);
   EngineParameters p;
   p.trigger = TRIGGER_UNPATCHED;
   p.note = 36.0f; p.timbre = 0.5f; p.morph = 0.5f; p.harmonics = 0.5f;
@@ -145,21 +198,364 @@ void bench_one(const char* name) {
   printf("%-20s %10.1f %10.1f\n", name, mono, st);
 }
 
+// Knob-sweep grid. Every axis includes both extremes, since the expensive
+// branches of most engines sit at a knob corner rather than at noon.
+const float kSweepLevels[] = { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f };
+const float kSweepMacros[] = { 0.0f, 0.5f, 1.0f };
+const float kSweepNotes[] = { 24.0f, 60.0f, 96.0f };
+const int kNumSweepLevels = sizeof(kSweepLevels) / sizeof(float);
+const int kNumSweepMacros = sizeof(kSweepMacros) / sizeof(float);
+const int kNumSweepNotes = sizeof(kSweepNotes) / sizeof(float);
+// Blocks timed after each move of the knobs. The first blocks include the
+// engine's reaction to the change (chord crossings, table switches, strikes),
+// which is where a per-block deadline is most often missed.
+const int kSweepBlocksPerPoint = 32;
+const int kSweepStrikeBlocks = 8;
+// Candidates re-timed before a worst block is reported, see SweepPoint.
+const size_t kSweepConfirmations = 8;
+const int kSweepRepeats = 3;
+
+struct SweepPoint {
+  float harmonics;
+  float timbre;
+  float morph;
+  float macro;
+  float note;
+  bool strike;
+  double worst_ns;
+};
+
+template <typename E>
+double sweep_point(E* e, SweepPoint* point, std::vector<float>* blocks) {
+  EngineParameters p;
+  p.harmonics = point->harmonics;
+  p.timbre = point->timbre;
+  p.morph = point->morph;
+  p.macro = point->macro;
+  p.note = point->note;
+  p.accent = 0.8f;
+  p.chord_set_option = 0;
+  p.stereo = false;
+  float out[B], aux[B]; bool env;
+  double worst = 0.0;
+  for (int i = 0; i < kSweepBlocksPerPoint; ++i) {
+    if (!point->strike) {
+      p.trigger = TRIGGER_UNPATCHED;
+    } else if (i == 0) {
+      p.trigger = TRIGGER_RISING_EDGE | TRIGGER_HIGH;
+    } else {
+      p.trigger = i < kSweepStrikeBlocks ? TRIGGER_HIGH : TRIGGER_LOW;
+    }
+    auto t0 = std::chrono::high_resolution_clock::now();
+    e->Render(p, out, aux, B, &env);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+    if (blocks) {
+      blocks->push_back(ns);
+    }
+    worst = std::max(worst, ns);
+  }
+  return worst;
+}
+
+// Walks the whole grid, appending every block's time to `blocks`, and returns
+// the confirmed worst grid point.
+template <typename E>
+SweepPoint find_worst(E* e, std::vector<float>* blocks) {
+  std::vector<SweepPoint> points;
+  for (int strike = 0; strike < 2; ++strike) {
+    for (int n = 0; n < kNumSweepNotes; ++n) {
+      for (int x = 0; x < kNumSweepMacros; ++x) {
+        for (int h = 0; h < kNumSweepLevels; ++h) {
+          for (int t = 0; t < kNumSweepLevels; ++t) {
+            for (int m = 0; m < kNumSweepLevels; ++m) {
+              SweepPoint point = {
+                kSweepLevels[h], kSweepLevels[t], kSweepLevels[m],
+                kSweepMacros[x], kSweepNotes[n], strike != 0, 0.0
+              };
+              point.worst_ns = sweep_point(e, &point, blocks);
+              points.push_back(point);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // A single block can be stretched by the host scheduler, which would make
+  // an arbitrary grid point look like the worst one. Re-time the heaviest
+  // candidates a few times (moving the knobs there from noon, so the reaction
+  // to the change is timed again) and keep the smallest maximum each one
+  // reproduces: a genuinely heavy knob corner is heavy every time, a
+  // preemption is not.
+  size_t num_candidates = std::min(kSweepConfirmations, points.size());
+  std::partial_sort(
+      points.begin(), points.begin() + num_candidates, points.end(),
+      [](const SweepPoint& a, const SweepPoint& b) {
+        return a.worst_ns > b.worst_ns;
+      });
+  SweepPoint worst = points[0];
+  worst.worst_ns = 0.0;
+  for (size_t i = 0; i < num_candidates; ++i) {
+    SweepPoint candidate = points[i];
+    SweepPoint noon = { 0.5f, 0.5f, 0.5f, 0.5f, 48.0f, false, 0.0 };
+    double confirmed = candidate.worst_ns;
+    for (int r = 0; r < kSweepRepeats; ++r) {
+      sweep_point(e, &noon, NULL);
+      confirmed = std::min(confirmed, sweep_point(e, &candidate, NULL));
+    }
+    if (confirmed > worst.worst_ns) {
+      worst = candidate;
+      worst.worst_ns = confirmed;
+    }
+  }
+  return worst;
+}
+
+template <typename E>
+void sweep_one(const char* name) {
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+  alarm(60);
+  BufferAllocator allocator(ram, sizeof(ram));
+  E e;
+  init_engine(&e, &allocator);
+  ParameterCacheCounters* cache = parameter_cache_counters();
+  cache->hits = cache->misses = 0;
+
+  std::vector<float> blocks;
+  SweepPoint worst = find_worst(&e, &blocks);
+
+  std::sort(blocks.begin(), blocks.end());
+  double median = blocks[blocks.size() / 2];
+  double p99 = blocks[blocks.size() * 99 / 100];
+  printf("%-20s %10.1f %10.1f %10.1f  h=%.2f t=%.2f m=%.2f x=%.2f "
+         "note=%.0f %s",
+         name, median, p99, worst.worst_ns,
+         worst.harmonics, worst.timbre, worst.morph, worst.macro,
+         worst.note, worst.strike ? "strike" : "free");
+  if (cache->hits || cache->misses) {
+    printf(" cache=%u/%u", cache->hits, cache->misses);
+  }
+  printf("\n");
+}
+
+// Ratio mode. Host speed drifts over seconds on a shared machine -- enough to
+// move one engine's flat figure by a third between two runs -- so the
+// reference engine is timed in the same child, in slices alternating with the
+// measured engine, and each ratio is the median over the slices: a slow
+// stretch of the host then lands on both sides of a ratio.
+const int kRatioSlices = 12;
+const int kRatioBlocksPerSlice = 2000;
+const int kRatioSweeps = 3;
+static char reference_ram[16 * 1024];
+
+template <typename E>
+double time_blocks(
+    E* e, const EngineParameters& p, int num_blocks, size_t size = B) {
+  float out[B], aux[B]; bool env;
+  auto t0 = std::chrono::high_resolution_clock::now();
+  for (int i = 0; i < num_blocks; ++i) e->Render(p, out, aux, size, &env);
+  auto t1 = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double, std::nano>(t1 - t0).count();
+}
+
+double median(double* values, int n) {
+  std::sort(values, values + n);
+  return values[n / 2];
+}
+
 template <typename E>
-void bench(const char* name) {
+void ratio_one(const char* name) {
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+  alarm(60);
+  BufferAllocator allocator(ram, sizeof(ram));
+  E e;
+  init_engine(&e, &allocator);
+  BufferAllocator reference_allocator(reference_ram, sizeof(reference_ram));
+  FMEngine reference;
+  reference.Init(&reference_allocator);
+
+  // Same steady state as bench_one.
+  EngineParameters p;
+  p.trigger = TRIGGER_UNPATCHED;
+  p.note = 36.0f; p.timbre = 0.5f; p.morph = 0.5f; p.harmonics = 0.5f;
+  p.accent = 0.8f; p.macro = 0.5f; p.chord_set_option = 0;
+  p.frequency_offset = NULL;
+  double mono[kRatioSlices];
+  double stereo[kRatioSlices];
+  for (int slice = -1; slice < kRatioSlices; ++slice) {
+    double ratio[2];
+    for (int s = 0; s < 2; ++s) {
+      p.stereo = s != 0;
+      double reference_ns = time_blocks(&reference, p, kRatioBlocksPerSlice);
+      ratio[s] = time_blocks(&e, p, kRatioBlocksPerSlice) / reference_ns;
+    }
+    if (slice >= 0) {  // The first pass only warms both engines up.
+      mono[slice] = ratio[0];
+      stereo[slice] = ratio[1];
+    }
+  }
+
+  double worst[kRatioSweeps];
+  std::vector<float> blocks;
+  for (int i = 0; i < kRatioSweeps; ++i) {
+    double reference_ns = find_worst(&reference, &blocks).worst_ns;
+    worst[i] = find_worst(&e, &blocks).worst_ns / reference_ns;
+    blocks.clear();
+  }
+  printf("%-20s %8.3f %8.3f %8.3f\n", name,
+         median(mono, kRatioSlices), median(stereo, kRatioSlices),
+         median(worst, kRatioSweeps));
+}
+
+// Stereo mode. An engine's stereo overhead splits into work done once per
+// Render call -- pan and spread gains, stereo-only coefficient setup -- and
+// work done for every sample -- duplicated filters, a second voice, a
+// decorrelator on AUX. Timing mono and stereo at two block sizes separates
+// the two: per block, cost = fixed + size * per_sample, and the stereo minus
+// mono difference of each term is that part of the overhead. The slices
+// alternate like the ratio mode's, for the same reason.
+const size_t kStereoSmallBlock = kBlockSize;
+const size_t kStereoLargeBlock = 2 * kBlockSize;
+const int kStereoExitOverLimit = 3;
+static double stereo_limit = 2.0;
+
+template <typename E>
+void stereo_one(const char* name) {
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+  alarm(30);
+  BufferAllocator allocator(ram, sizeof(ram));
+  E e;
+  init_engine(&e, &allocator);
+  if (!e.stereo_capable()) {
+    printf("%-20s mono-only\n", name);
+    return;
+  }
+
+  EngineParameters p;
+  p.trigger = TRIGGER_UNPATCHED;
+  p.note = 36.0f; p.timbre = 0.5f; p.morph = 0.5f; p.harmonics = 0.5f;
+  p.accent = 0.8f; p.macro = 0.5f; p.chord_set_option = 0;
+  p.frequency_offset = NULL;
+  // Per kBlockSize block, the firmware's: mono, stereo, and the fixed and
+  // per-sample parts of their difference.
+  double mono[kRatioSlices];
+  double stereo[kRatioSlices];
+  double fixed[kRatioSlices];
+  double per_sample[kRatioSlices];
+  for (int slice = -1; slice < kRatioSlices; ++slice) {
+    double small[2], large[2];
+    for (int s = 0; s < 2; ++s) {
+      p.stereo = s != 0;
+      small[s] = time_blocks(&e, p, kRatioBlocksPerSlice, kStereoSmallBlock) /
+          kRatioBlocksPerSlice;
+      large[s] = time_blocks(&e, p, kRatioBlocksPerSlice, kStereoLargeBlock) /
+          kRatioBlocksPerSlice;
+    }
+    if (slice < 0) {  // Warm-up.
+      continue;
+    }
+    const double sample_scale = double(kStereoSmallBlock) /
+        double(kStereoLargeBlock - kStereoSmallBlock);
+    const double sample_cost[2] = {
+      (large[0] - small[0]) * sample_scale,
+      (large[1] - small[1]) * sample_scale
+    };
+    mono[slice] = small[0];
+    stereo[slice] = small[1];
+    per_sample[slice] = sample_cost[1] - sample_cost[0];
+    fixed[slice] = (small[1] - sample_cost[1]) - (small[0] - sample_cost[0]);
+  }
+  const double m = median(mono, kRatioSlices);
+  const double st = median(stereo, kRatioSlices);
+  const bool over = st > stereo_limit * m;
+  printf("%-20s %10.1f %10.1f %6.2fx %10.1f %10.1f%s\n", name, m, st, st / m,
+         median(fixed, kRatioSlices), median(per_sample, kRatioSlices),
+         over ? "  OVER" : "");
+  if (over) {
+    fflush(stdout);
+    _exit(kStereoExitOverLimit);
+  }
+}
+
+enum Mode {
+  MODE_FLAT,
+  MODE_SWEEP,
+  MODE_RATIOS,
+  MODE_STEREO
+};
+
+static Mode mode = MODE_FLAT;
+static int num_selected = 0;
+static char** selected = NULL;
+static int num_over_limit = 0;
+
+template <typename E>
+void bench(const char* name, int user_data_bank = -1) {
+  if (num_selected) {
+    bool found = false;
+    for (int i = 0; i < num_selected; ++i) {
+      found = found || !strcmp(selected[i], name);
+    }
+    if (!found) {
+      return;
+    }
+  }
+  user_data = user_data_bank >= 0 ? fm_patches_table[user_data_bank] : NULL;
+  fflush(stdout);
   pid_t pid = fork();
-  if (pid == 0) { bench_one<E>(name); fflush(stdout); _exit(0); }
+  if (pid == 0) {
+    if (mode == MODE_SWEEP) {
+      sweep_one<E>(name);
+    } else if (mode == MODE_RATIOS) {
+      ratio_one<E>(name);
+    } else if (mode == MODE_STEREO) {
+      stereo_one<E>(name);
+    } else {
+      bench_one<E>(name);
+    }
+    fflush(stdout);
+    _exit(0);
+  }
   int status = 0;
   waitpid(pid, &status, 0);
-  if (!(WIFEXITED(status) && WEXITSTATUS(status) == 0)) {
+  if (mode == MODE_STEREO && WIFEXITED(status) &&
+      WEXITSTATUS(status) == kStereoExitOverLimit) {
+    ++num_over_limit;
+  } else if (!(WIFEXITED(status) && WEXITSTATUS(status) == 0)) {
     const char* why = (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM)
         ? "TIMEOUT" : "CRASHED";
-    printf("%-20s %10s %10s\n", name, why, why);
+    if (mode != MODE_FLAT) {
+      printf("%-20s %10s %10s %10s\n", name, why, why, why);
+    } else {
+      printf("%-20s %10s %10s\n", name, why, why);
+    }
     fflush(stdout);
   }
 }
 
-int main() {
+int main(int argc, char** argv) {
+  if (argc > 1 && (!strcmp(argv[1], "--sweep") ||
+                   !strcmp(argv[1], "--ratios"))) {
+    mode = !strcmp(argv[1], "--sweep") ? MODE_SWEEP : MODE_RATIOS;
+    --argc;
+    ++argv;
+  } else if (argc > 1 && !strcmp(argv[1], "--stereo")) {
+    mode = MODE_STEREO;
+    --argc;
+    ++argv;
+    if (argc > 2 && !strcmp(argv[1], "--limit")) {
+      stereo_limit = atof(argv[2]);
+      argc -= 2;
+      argv += 2;
+    }
+  }
+  num_selected = argc - 1;
+  selected = argv + 1;
+
   // Stock Mutable Instruments models.
   bench<VirtualAnalogEngine>("virtual-analog");
   bench<VirtualAnalogDualEngine>("virtual-analog-dual");
@@ -181,12 +577,11 @@ int main() {
   bench<HiHatEngine>("analog-hi-hat");
   bench<VirtualAnalogVCFEngine>("virtual-analog-vcf");
   bench<PhaseDistortionEngine>("phase-distortion");
+  bench<SixOpEngine>("dx7-bank-a", 0);
+  bench<SixOpEngine>("dx7-bank-b", 1);
+  bench<SixOpEngine>("dx7-bank-c", 2);
   bench<WaveTerrainEngine>("wave-terrain");
   bench<StringMachineEngine>("string-machine");
-  // wavetable needs a wavetable loaded via LoadUserData(); chiptune's
-  // arpeggiator wedges under this generic harness with flush-to-zero on. Both
-  // need a bespoke setup — they print CRASHED / TIMEOUT here rather than wedging
-  // the sweep. (chiptune measured ~709/785 ns mono/stereo in an ad-hoc run.)
   bench<ChiptuneEngine>("chiptune");
   // Rubato Lab models.
   bench<FormantSpeechEngine>("formant-speech");
@@ -235,6 +630,7 @@ int main() {
   bench<WavetableScaleStackEngine>("wavetable-scale-stack");
   bench<ShakersEngine>("shakers");
   bench<BrassEngine>("brass");
+  bench<HelixEngine>("helix");
   bench<ClapEngine>("clap");
   bench<AnalogPercussionEngine>("analog-percussion");
   bench<FreshetsFormantEngine>("freshets-formant");
@@ -250,5 +646,9 @@ int main() {
   bench<PhaseFlockEngine>("phase-flock");
   bench<RulefieldEngine>("rulefield");
   bench<SpectralSpiralEngine>("spectral-spiral");
-  return 0;
+  if (num_over_limit) {
+    printf("%d engines over %.2fx mono in stereo\n", num_over_limit,
+           stereo_limit);
+  }
+  return num_over_limit ? 1 : 0;
 }
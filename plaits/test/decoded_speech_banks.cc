@@ -0,0 +1,185 @@
+// Copyright 2026 Rubato Audio.
+//
+// The five stock LPC word banks as decoded frames.
+//
+//   decoded_speech_banks
+//
+// decodes the TI bitstreams of lpc_speech_synth_words.cc and prints them as
+// the decoded_word_banks_ table; `make decoded-speech-banks` writes that to
+// plaits/dsp/speech/lpc_speech_synth_decoded_words.cc.
+//
+//   decoded_speech_banks --check
+//
+// fails unless the table compiled into this binary holds exactly the frames
+// and word boundaries of the bitstreams, and prints, per bank,
+//   <bank> <frames> <words> <decode_ns>
+// with the time LPCSpeechSynthWordBank::Load spends decoding the bank when
+// the firmware keeps the bitstreams. With the decoded table Load only points
+// at the bank. Run with `make decoded-speech-banks-check`.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "plaits/dsp/speech/lpc_speech_synth_words.h"
+
+using namespace plaits;
+
+const LPCSpeechSynthWordBankData kBitstreams[] = {
+  { bank_0, sizeof(bank_0) },
+  { bank_1, sizeof(bank_1) },
+  { bank_2, sizeof(bank_2) },
+  { bank_3, sizeof(bank_3) },
+  { bank_4, sizeof(bank_4) },
+};
+
+LPCSpeechSynth::Frame frames[kLPCSpeechSynthMaxFrames];
+int word_boundaries[kLPCSpeechSynthMaxWordBoundaries];
+
+// The header of lpc_speech_synth_words.cc, where the banks come from.
+const char* const kHeader[] = {
+  "// Copyright 2016 Emilie Gillet.",
+  "//",
+  "// Author: Emilie Gillet (emilie.o.gillet@gmail.com)",
+  "//",
+  "// Permission is hereby granted, free of charge, to any person obtaining a copy",
+  "// of this software and associated documentation files (the \"Software\"), to deal",
+  "// in the Software without restriction, including without limitation the rights",
+  "// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell",
+  "// copies of the Software, and to permit persons to whom the Software is",
+  "// furnished to do so, subject to the following conditions:",
+  "// ",
+  "// The above copyright notice and this permission notice shall be included in",
+  "// all copies or substantial portions of the Software.",
+  "// ",
+  "// THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR",
+  "// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,",
+  "// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE",
+  "// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER",
+  "// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,",
+  "// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN",
+  "// THE SOFTWARE.",
+  "// ",
+  "// See http://creativecommons.org/licenses/MIT/ for more information.",
+  "//",
+  "// -----------------------------------------------------------------------------",
+  "//",
+  "// The LPC10 words of lpc_speech_synth_words.cc, decoded.",
+  "//",
+  "// Automatically generated with:",
+  "// make decoded-speech-banks",
+  "",
+  NULL
+};
+
+void PrintTable() {
+  for (const char* const* line = kHeader; *line; ++line) {
+    printf("%s\n", *line);
+  }
+  printf("#include \"plaits/dsp/speech/lpc_speech_synth_words.h\"\n");
+  printf("\n");
+  printf("namespace plaits {\n");
+  for (int bank = 0; bank < LPC_SPEECH_SYNTH_NUM_WORD_BANKS; ++bank) {
+    int num_words;
+    LPCSpeechSynthWordBank::Decode(
+        kBitstreams[bank], frames, word_boundaries, &num_words);
+    printf("\nstatic const LPCSpeechSynth::Frame bank_%d_frames[] = {\n", bank);
+    for (int word = 0; word < num_words; ++word) {
+      printf("  // Word %d\n", word);
+      for (int i = word_boundaries[word]; i < word_boundaries[word + 1]; ++i) {
+        const LPCSpeechSynth::Frame& f = frames[i];
+        printf("  { %d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d },\n",
+               f.energy, f.period, f.k0, f.k1, f.k2, f.k3,
+               f.k4, f.k5, f.k6, f.k7, f.k8, f.k9);
+      }
+    }
+    printf("};\n");
+    printf("\nstatic const uint16_t bank_%d_boundaries[] = {", bank);
+    for (int word = 0; word <= num_words; ++word) {
+      printf("%s%s%d", word ? "," : "", word % 12 ? " " : "\n  ",
+             word_boundaries[word]);
+    }
+    printf("\n};\n");
+  }
+  printf("\n/* extern */\n");
+  printf("const LPCSpeechSynthRawWordBankData decoded_word_banks_[] = {\n");
+  for (int bank = 0; bank < LPC_SPEECH_SYNTH_NUM_WORD_BANKS; ++bank) {
+    int num_words;
+    const int num_frames = LPCSpeechSynthWordBank::Decode(
+        kBitstreams[bank], frames, word_boundaries, &num_words);
+    printf("  { bank_%d_frames, bank_%d_boundaries, %d, %d },\n",
+           bank, bank, num_frames, num_words);
+  }
+  printf("};\n");
+  printf("\n}  // namespace plaits\n");
+}
+
+bool SameFrame(const LPCSpeechSynth::Frame& a, const LPCSpeechSynth::Frame& b) {
+  return a.energy == b.energy && a.period == b.period &&
+      a.k0 == b.k0 && a.k1 == b.k1 && a.k2 == b.k2 && a.k3 == b.k3 &&
+      a.k4 == b.k4 && a.k5 == b.k5 && a.k6 == b.k6 && a.k7 == b.k7 &&
+      a.k8 == b.k8 && a.k9 == b.k9;
+}
+
+float DecodeTime(int bank) {
+  float fastest = 0.0f;
+  int num_words;
+  for (int batch = 0; batch < 5; ++batch) {
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; ++i) {
+      LPCSpeechSynthWordBank::Decode(
+          kBitstreams[bank], frames, word_boundaries, &num_words);
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    const float ns = std::chrono::duration<float, std::nano>(
+        t1 - t0).count() / 1000;
+    fastest = batch == 0 ? ns : std::min(fastest, ns);
+  }
+  return fastest;
+}
+
+int Check() {
+  int mismatches = 0;
+  for (int bank = 0; bank < LPC_SPEECH_SYNTH_NUM_WORD_BANKS; ++bank) {
+    const LPCSpeechSynthRawWordBankData& decoded = decoded_word_banks_[bank];
+    int num_words;
+    const int num_frames = LPCSpeechSynthWordBank::Decode(
+        kBitstreams[bank], frames, word_boundaries, &num_words);
+    if (num_frames != decoded.num_frames || num_words != decoded.num_words) {
+      printf("bank %d: %d frames, %d words in the bitstream, "
+             "%d frames, %d words in the table\n",
+             bank, num_frames, num_words,
+             decoded.num_frames, decoded.num_words);
+      ++mismatches;
+      continue;
+    }
+    for (int i = 0; i < num_frames; ++i) {
+      if (!SameFrame(frames[i], decoded.frames[i])) {
+        printf("bank %d: frame %d differs\n", bank, i);
+        ++mismatches;
+      }
+    }
+    for (int i = 0; i <= num_words; ++i) {
+      if (word_boundaries[i] != decoded.word_boundaries[i]) {
+        printf("bank %d: word boundary %d differs\n", bank, i);
+        ++mismatches;
+      }
+    }
+    printf("%d %4d %3d %9.1f\n", bank, num_frames, num_words, DecodeTime(bank));
+  }
+  if (mismatches) {
+    printf("FAILED: decoded_word_banks_ is stale, "
+           "run make decoded-speech-banks\n");
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  if (argc > 1 && !strcmp(argv[1], "--check")) {
+    return Check();
+  }
+  PrintTable();
+  return 0;
+}
@@ -0,0 +1,154 @@
+// Copyright 2026 Rubato Audio.
+//
+// Host check that Downsampler::Process, the block decimator, produces exactly
+// what the per-sample Accumulate/Read calls of the oversampled engines do:
+// same samples bit for bit (the sign of zeros included) and the same state
+// carried into the next block, for block sizes that do and do not fill the
+// vector loop, and when the two interfaces alternate on one filter state.
+// Also prints the cost of both on this host. Build from the repository root
+// with:
+//
+//   g++ -O2 -I. plaits/test/downsampler_test.cc plaits/resources.cc -o /tmp/dt
+//
+// and run /tmp/dt.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "plaits/dsp/downsampler/4x_downsampler.h"
+
+using namespace plaits;
+
+static int checks = 0;
+#define CHECK(cond) do { ++checks; if (!(cond)) { \
+  std::printf("FAIL line %d: %s\n", __LINE__, #cond); return 1; } } while (0)
+
+const size_t kMaxSize = 24;
+const int kNumBlocks = 2000;
+
+static bool Identical(float a, float b) {
+  return !memcmp(&a, &b, sizeof(float));
+}
+
+// Aliased test signal: a swept sine, with runs of +0 and -0 and a few large
+// values mixed in.
+static void Fill(float* in, size_t n, int block) {
+  for (size_t i = 0; i < n; ++i) {
+    const int t = block * int(n) + int(i);
+    float x = sinf(0.001f * float(t) * float(t % 977));
+    if (t % 61 < 5) {
+      x = (t & 1) ? -0.0f : 0.0f;
+    } else if (t % 127 == 0) {
+      x *= 1.0e4f;
+    }
+    in[i] = x;
+  }
+}
+
+static void RenderPerSample(float* state, const float* in, float* out,
+                            size_t size) {
+  Downsampler downsampler(state);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = 0; j < kOversampling; ++j) {
+      downsampler.Accumulate(j, in[i * kOversampling + j]);
+    }
+    out[i] = downsampler.Read();
+  }
+}
+
+static void RenderBlock(float* state, const float* in, float* out,
+                        size_t size) {
+  Downsampler downsampler(state);
+  downsampler.Process(in, out, size);
+}
+
+template<bool block>
+static float Time(size_t size) {
+  float in[kMaxSize * kOversampling];
+  float out[kMaxSize];
+  float state = 0.0f;
+  float sum = 0.0f;
+  Fill(in, size * kOversampling, 1);
+  float fastest = 0.0f;
+  for (int batch = 0; batch < 5; ++batch) {
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 100 * kNumBlocks; ++i) {
+      in[0] = float(i & 7);
+      if (block) {
+        RenderBlock(&state, in, out, size);
+      } else {
+        RenderPerSample(&state, in, out, size);
+      }
+      sum += out[size - 1];
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    const float ns = std::chrono::duration<float, std::nano>(
+        t1 - t0).count() / (100 * kNumBlocks);
+    fastest = batch == 0 ? ns : std::min(fastest, ns);
+  }
+  return sum == 1.0f ? 0.0f : fastest;
+}
+
+int main() {
+  float in[kMaxSize * kOversampling];
+  float per_sample[kMaxSize];
+  float block[kMaxSize];
+
+  const size_t sizes[] = { 1, 3, 4, 5, 12, 24 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    const size_t size = sizes[s];
+    float per_sample_state = 0.0f;
+    float block_state = 0.0f;
+    int differences = 0;
+    for (int i = 0; i < kNumBlocks; ++i) {
+      Fill(in, size * kOversampling, i);
+      RenderPerSample(&per_sample_state, in, per_sample, size);
+      RenderBlock(&block_state, in, block, size);
+      for (size_t j = 0; j < size; ++j) {
+        differences += !Identical(per_sample[j], block[j]);
+      }
+      differences += !Identical(per_sample_state, block_state);
+    }
+    if (differences) {
+      std::printf("block size %zu: %d differences\n", size, differences);
+    }
+    CHECK(differences == 0);
+  }
+
+  // Alternating interfaces on one state, as an engine switching from one to
+  // the other between blocks would.
+  float mixed_state = 0.0f;
+  float reference_state = 0.0f;
+  int differences = 0;
+  for (int i = 0; i < kNumBlocks; ++i) {
+    Fill(in, kMaxSize * kOversampling, i);
+    RenderPerSample(&reference_state, in, per_sample, kMaxSize);
+    if (i & 1) {
+      RenderBlock(&mixed_state, in, block, kMaxSize);
+    } else {
+      RenderPerSample(&mixed_state, in, block, kMaxSize);
+    }
+    for (size_t j = 0; j < kMaxSize; ++j) {
+      differences += !Identical(per_sample[j], block[j]);
+    }
+  }
+  CHECK(differences == 0);
+
+#ifndef PLAITS_DOWNSAMPLER_SIMD
+  std::printf("no vector loop on this host: Process is the scalar one\n");
+#endif
+  const size_t bench_sizes[] = { 12, 24 };
+  for (size_t s = 0; s < 2; ++s) {
+    const float per_sample_ns = Time<false>(bench_sizes[s]);
+    const float block_ns = Time<true>(bench_sizes[s]);
+    std::printf("%2zu samples: per-sample %6.1f ns, block %6.1f ns, %.2fx\n",
+                bench_sizes[s], per_sample_ns, block_ns,
+                per_sample_ns / block_ns);
+  }
+
+  std::printf("downsampler_test: %d checks passed\n", checks);
+  return 0;
+}
@@ -0,0 +1,248 @@
+// Every engine of the Plaits Lab catalog, by catalog id, for the host tools
+// that render or inspect the whole catalog (batch_render.cc, golden_render.cc).
+
+#ifndef PLAITS_TEST_ENGINE_CATALOG_H_
+#define PLAITS_TEST_ENGINE_CATALOG_H_
+
+#include <cstring>
+#include <vector>
+
+#include "plaits/dsp/engine/engine.h"
+#include "plaits/dsp/engine/additive_engine.h"
+#include "plaits/dsp/engine/bass_drum_engine.h"
+#include "plaits/dsp/engine/chord_engine.h"
+#include "plaits/dsp/engine/fm_engine.h"
+#include "plaits/dsp/engine/grain_engine.h"
+#include "plaits/dsp/engine/hi_hat_engine.h"
+#include "plaits/dsp/engine/modal_engine.h"
+#include "plaits/dsp/engine/noise_engine.h"
+#include "plaits/dsp/engine/particle_engine.h"
+#include "plaits/dsp/engine/snare_drum_engine.h"
+#include "plaits/dsp/engine/speech_engine.h"
+#include "plaits/dsp/engine/string_engine.h"
+#include "plaits/dsp/engine/swarm_engine.h"
+#include "plaits/dsp/engine/virtual_analog_crossfade_engine.h"
+#include "plaits/dsp/engine/virtual_analog_dual_engine.h"
+#include "plaits/dsp/engine/virtual_analog_engine.h"
+#include "plaits/dsp/engine/waveshaping_engine.h"
+#include "plaits/dsp/engine/wavetable_engine.h"
+#include "plaits/dsp/engine2/analog_percussion_engine.h"
+#include "plaits/dsp/engine2/attractor_engine.h"
+#include "plaits/dsp/engine2/blown_engine.h"
+#include "plaits/dsp/engine2/bowed_engine.h"
+#include "plaits/dsp/engine2/brass_engine.h"
+#include "plaits/dsp/engine2/buzz_engine.h"
+#include "plaits/dsp/engine2/bytebeat_engine.h"
+#include "plaits/dsp/engine2/chiptune_engine.h"
+#include "plaits/dsp/engine2/clap_engine.h"
+#include "plaits/dsp/engine2/csaw_engine.h"
+#include "plaits/dsp/engine2/cymbal_engine.h"
+#include "plaits/dsp/engine2/diatonic_chord_engine.h"
+#include "plaits/dsp/engine2/digital_modulation_engine.h"
+#include "plaits/dsp/engine2/dual_sync_engine.h"
+#include "plaits/dsp/engine2/fluted_engine.h"
+#include "plaits/dsp/engine2/fold_engine.h"
+#include "plaits/dsp/engine2/formant_speech_engine.h"
+#include "plaits/dsp/engine2/freshets_formant_engine.h"
+#include "plaits/dsp/engine2/gendy_engine.h"
+#include "plaits/dsp/engine2/glisson_engine.h"
+#include "plaits/dsp/engine2/granular_cloud_engine.h"
+#include "plaits/dsp/engine2/harmonics_engine.h"
+#include "plaits/dsp/engine2/helix_engine.h"
+#include "plaits/dsp/engine2/kick_engine.h"
+#include "plaits/dsp/engine2/lockstep_engine.h"
+#include "plaits/dsp/engine2/loopback_engine.h"
+#include "plaits/dsp/engine2/lpc_speech_engine.h"
+#include "plaits/dsp/engine2/morph_engine.h"
+#include "plaits/dsp/engine2/noise_bank_engine.h"
+#include "plaits/dsp/engine2/particle_burst_engine.h"
+#include "plaits/dsp/engine2/phase_distortion_engine.h"
+#include "plaits/dsp/engine2/phase_flock_engine.h"
+#include "plaits/dsp/engine2/phase_weave_engine.h"
+#include "plaits/dsp/engine2/plucked_engine.h"
+#include "plaits/dsp/engine2/pulsar_engine.h"
+#include "plaits/dsp/engine2/question_mark_engine.h"
+#include "plaits/dsp/engine2/raw_fm_engine.h"
+#include "plaits/dsp/engine2/reed_pipe_engine.h"
+#include "plaits/dsp/engine2/ring_mod_engine.h"
+#include "plaits/dsp/engine2/rulefield_engine.h"
+#include "plaits/dsp/engine2/saw_comb_engine.h"
+#include "plaits/dsp/engine2/saw_square_engine.h"
+#include "plaits/dsp/engine2/saw_swarm_engine.h"
+#include "plaits/dsp/engine2/scale_stack_engine.h"
+#include "plaits/dsp/engine2/scanned_engine.h"
+#include "plaits/dsp/engine2/shakers_engine.h"
+#include "plaits/dsp/engine2/sideband_engine.h"
+#include "plaits/dsp/engine2/six_op_engine.h"
+#include "plaits/dsp/engine2/snare_engine.h"
+#include "plaits/dsp/engine2/spectral_spiral_engine.h"
+#include "plaits/dsp/engine2/string_machine_engine.h"
+#include "plaits/dsp/engine2/struck_bell_engine.h"
+#include "plaits/dsp/engine2/struck_drum_engine.h"
+#include "plaits/dsp/engine2/sub_oscillator_engine.h"
+#include "plaits/dsp/engine2/tapfield_engine.h"
+#include "plaits/dsp/engine2/toy_engine.h"
+#include "plaits/dsp/engine2/triple_engine.h"
+#include "plaits/dsp/engine2/undertow_engine.h"
+#include "plaits/dsp/engine2/virtual_analog_vcf_engine.h"
+#include "plaits/dsp/engine2/vosim_engine.h"
+#include "plaits/dsp/engine2/vowel_engine.h"
+#include "plaits/dsp/engine2/vowel_fof_engine.h"
+#include "plaits/dsp/engine2/wave_paraphonic_engine.h"
+#include "plaits/dsp/engine2/wave_scan_engine.h"
+#include "plaits/dsp/engine2/wave_terrain_engine.h"
+#include "plaits/dsp/engine2/wavetable_chord_engine.h"
+#include "plaits/dsp/engine2/wavetable_scale_stack_engine.h"
+#include "plaits/dsp/engine2/z_filter_engine.h"
+#include "stmlib/utils/buffer_allocator.h"
+
+namespace plaits {
+
+struct EngineEntry {
+  const char* id;
+  size_t size;
+  Engine* (*create)(void* storage);
+  void (*destroy)(Engine* engine);
+  int user_data_bank;
+};
+
+// Engine has no virtual destructor, so each entry constructs and destroys its
+// own class in caller-provided storage (ConstructEngine and DestroyEngine, the
+// same functions EngineRegistry uses for overlay engines).
+#define CATALOG_ENGINE(Class, id, bank) \
+  { id, sizeof(Class), &ConstructEngine<Class>, &DestroyEngine<Class>, bank }
+
+// Catalog order (alt_firmwares/plaits_lab_catalog/catalog.json).
+const EngineEntry kEngines[] = {
+  CATALOG_ENGINE(VirtualAnalogEngine, "virtual-analog", -1),
+  CATALOG_ENGINE(VirtualAnalogDualEngine, "virtual-analog-dual", -1),
+  CATALOG_ENGINE(VirtualAnalogCrossfadeEngine, "virtual-analog-crossfade", -1),
+  CATALOG_ENGINE(WaveshapingEngine, "waveshaping", -1),
+  CATALOG_ENGINE(FMEngine, "two-op-fm", -1),
+  CATALOG_ENGINE(GrainEngine, "granular-formant", -1),
+  CATALOG_ENGINE(AdditiveEngine, "harmonic", -1),
+  CATALOG_ENGINE(WavetableEngine, "wavetable", -1),
+  CATALOG_ENGINE(ChordEngine, "chords", -1),
+  CATALOG_ENGINE(SpeechEngine, "speech", -1),
+  CATALOG_ENGINE(FormantSpeechEngine, "formant-speech", -1),
+  CATALOG_ENGINE(LPCSpeechEngine, "lpc-speech", -1),
+  CATALOG_ENGINE(SwarmEngine, "swarm", -1),
+  CATALOG_ENGINE(NoiseEngine, "filtered-noise", -1),
+  CATALOG_ENGINE(ParticleEngine, "particle-noise", -1),
+  CATALOG_ENGINE(StringEngine, "inharmonic-string", -1),
+  CATALOG_ENGINE(ModalEngine, "modal-resonator", -1),
+  CATALOG_ENGINE(BassDrumEngine, "analog-bass-drum", -1),
+  CATALOG_ENGINE(SnareDrumEngine, "analog-snare", -1),
+  CATALOG_ENGINE(HiHatEngine, "analog-hi-hat", -1),
+  CATALOG_ENGINE(VirtualAnalogVCFEngine, "virtual-analog-vcf", -1),
+  CATALOG_ENGINE(PhaseDistortionEngine, "phase-distortion", -1),
+  CATALOG_ENGINE(SixOpEngine, "dx7-bank-a", 0),
+  CATALOG_ENGINE(SixOpEngine, "dx7-bank-b", 1),
+  CATALOG_ENGINE(SixOpEngine, "dx7-bank-c", 2),
+  CATALOG_ENGINE(WaveTerrainEngine, "wave-terrain", -1),
+  CATALOG_ENGINE(StringMachineEngine, "string-machine", -1),
+  CATALOG_ENGINE(ChiptuneEngine, "chiptune", -1),
+  CATALOG_ENGINE(GlissonEngine, "glisson", -1),
+  CATALOG_ENGINE(GendyEngine, "gendy", -1),
+  CATALOG_ENGINE(ScannedEngine, "scanned", -1),
+  CATALOG_ENGINE(PulsarEngine, "pulsar", -1),
+  CATALOG_ENGINE(LoopbackEngine, "loopback", -1),
+  CATALOG_ENGINE(LockstepEngine, "lockstep", -1),
+  CATALOG_ENGINE(TapfieldEngine, "tapfield", -1),
+  CATALOG_ENGINE(PhaseWeaveEngine, "phase-weave", -1),
+  CATALOG_ENGINE(SidebandEngine, "sideband-bank", -1),
+  CATALOG_ENGINE(AttractorEngine, "attractor", -1),
+  CATALOG_ENGINE(UndertowEngine, "undertow", -1),
+  CATALOG_ENGINE(ReedPipeEngine, "reed-pipe", -1),
+  CATALOG_ENGINE(PhaseFlockEngine, "phase-flock", -1),
+  CATALOG_ENGINE(RulefieldEngine, "rulefield", -1),
+  CATALOG_ENGINE(SpectralSpiralEngine, "spectral-spiral", -1),
+  CATALOG_ENGINE(ZFilterEngine, "z-filter", -1),
+  CATALOG_ENGINE(ToyEngine, "toy", -1),
+  CATALOG_ENGINE(CSawEngine, "csaw", -1),
+  CATALOG_ENGINE(RingModEngine, "ring-mod", -1),
+  CATALOG_ENGINE(FoldEngine, "fold", -1),
+  CATALOG_ENGINE(BuzzEngine, "buzz", -1),
+  CATALOG_ENGINE(DualSyncEngine, "dual-sync", -1),
+  CATALOG_ENGINE(GranularCloudEngine, "granular-cloud", -1),
+  CATALOG_ENGINE(MorphEngine, "morph", -1),
+  CATALOG_ENGINE(NoiseBankEngine, "noise-bank", -1),
+  CATALOG_ENGINE(ParticleBurstEngine, "particle-burst", -1),
+  CATALOG_ENGINE(SawSquareEngine, "saw-square", -1),
+  CATALOG_ENGINE(SawSwarmEngine, "saw-swarm", -1),
+  CATALOG_ENGINE(VowelEngine, "vowel", -1),
+  CATALOG_ENGINE(HarmonicsEngine, "harmonics", -1),
+  CATALOG_ENGINE(VosimEngine, "vosim", -1),
+  CATALOG_ENGINE(PluckedEngine, "plucked", -1),
+  CATALOG_ENGINE(BlownEngine, "blown", -1),
+  CATALOG_ENGINE(StruckBellEngine, "struck-bell", -1),
+  CATALOG_ENGINE(StruckDrumEngine, "struck-drum", -1),
+  CATALOG_ENGINE(KickEngine, "kick", -1),
+  CATALOG_ENGINE(SnareEngine, "snare", -1),
+  CATALOG_ENGINE(CymbalEngine, "cymbal", -1),
+  CATALOG_ENGINE(WaveScanEngine, "wave-scan", -1),
+  CATALOG_ENGINE(WaveParaphonicEngine, "wave-paraphonic", -1),
+  CATALOG_ENGINE(FlutedEngine, "fluted", -1),
+  CATALOG_ENGINE(QuestionMarkEngine, "question-mark", -1),
+  CATALOG_ENGINE(BowedEngine, "bowed", -1),
+  CATALOG_ENGINE(SubOscillatorEngine, "sub-oscillator", -1),
+  CATALOG_ENGINE(DigitalModulationEngine, "digital-modulation", -1),
+  CATALOG_ENGINE(SawCombEngine, "saw-comb", -1),
+  CATALOG_ENGINE(VowelFofEngine, "vowel-fof", -1),
+  CATALOG_ENGINE(RawFmEngine, "raw-fm", -1),
+  CATALOG_ENGINE(TripleEngine, "triple", -1),
+  CATALOG_ENGINE(BytebeatEngine, "bytebeat", -1),
+  CATALOG_ENGINE(DiatonicChordEngine, "diatonic-chord", -1),
+  CATALOG_ENGINE(ScaleStackEngine, "scale-stack", -1),
+  CATALOG_ENGINE(WavetableChordEngine, "wavetable-chord", -1),
+  CATALOG_ENGINE(WavetableScaleStackEngine, "wavetable-scale-stack", -1),
+  CATALOG_ENGINE(ShakersEngine, "shakers", -1),
+  CATALOG_ENGINE(BrassEngine, "brass", -1),
+  CATALOG_ENGINE(HelixEngine, "helix", -1),
+  CATALOG_ENGINE(ClapEngine, "clap", -1),
+  CATALOG_ENGINE(AnalogPercussionEngine, "analog-percussion", -1),
+  CATALOG_ENGINE(FreshetsFormantEngine, "freshets-formant", -1),
+};
+
+const size_t kNumEngines = sizeof(kEngines) / sizeof(kEngines[0]);
+
+inline const EngineEntry* FindEngine(const char* id) {
+  for (size_t i = 0; i < kNumEngines; ++i) {
+    if (!strcmp(kEngines[i].id, id)) {
+      return &kEngines[i];
+    }
+  }
+  return NULL;
+}
+
+// Same arena as render_model.cc's preview renderer.
+const size_t kCatalogArenaSize = 16 * 1024;
+
+// What the catalog tools fill an engine's storage with before constructing
+// it: every float a NaN, every integer -1. On the module the arena holds
+// whatever the previous engine left in it. EngineRegistry::Activate() zeroes
+// the object itself, but here it stays dirty too, so that a member Init()
+// forgets shows up in the renders instead of hiding behind the zero.
+const uint64_t kCatalogDirtyWord = 0xffffffffffffffffULL;
+
+// Constructs and initializes the entry's engine in `storage`, which is resized
+// to hold the engine followed by its arena. 64-byte aligned blocks cover any
+// engine member's alignment. Release it with entry.destroy().
+inline Engine* CreateCatalogEngine(
+    const EngineEntry& entry,
+    std::vector<uint64_t>* storage) {
+  storage->assign(
+      (entry.size + kCatalogArenaSize) / 8 + 32, kCatalogDirtyWord);
+  char* base = reinterpret_cast<char*>(&(*storage)[0]);
+  Engine* engine = entry.create(
+      base + (64 - reinterpret_cast<uintptr_t>(base) % 64) % 64);
+  stmlib::BufferAllocator allocator(
+      reinterpret_cast<char*>(engine) + ((entry.size + 63) & ~size_t(63)),
+      kCatalogArenaSize);
+  engine->Init(&allocator);
+  return engine;
+}
+
+}  // namespace plaits
+
+#endif  // PLAITS_TEST_ENGINE_CATALOG_H_
@@ -0,0 +1,125 @@
+// Static RAM report: what each catalog engine costs when it is selected.
+//
+//   engine_memory_report [--json] [<catalog-id>...]
+//
+// prints, per engine, <id> <object bytes> <arena bytes>: sizeof the engine
+// class, and how much of the shared BufferAllocator arena its Init() takes.
+// The arena is the same 16 kB for every engine (shared_buffer in plaits.cc);
+// the objects are not. With the engine overlay (PLAITS_ENGINE_OVERLAY, see
+// EngineRegistry) only the largest object of the build's engine config is
+// paid for, and the report ends with that config's per-member sizes, the sum
+// it would cost with every engine resident, and sizeof(Voice) as built. These
+// are host sizes: pointers take 8 bytes here and 4 on the STM32, so they are an
+// upper bound of the firmware's. Run with `make engine-memory-report`
+// (ENGINES).
+//
+// --json prints only the per-engine figures, as the table the recipe
+// generator checks recipes against before anything is cross-compiled;
+// `make engine-memory-table` refreshes
+// alt_firmwares/plaits_lab_catalog/engine_memory.json.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "plaits/dsp/voice.h"
+#include "plaits/test/engine_catalog.h"
+
+using namespace plaits;
+using namespace stmlib;
+
+#if PLAITS_ENGINE_OVERLAY
+struct ConfigMember {
+  const char* name;
+  size_t size;
+};
+
+#define PLAITS_ENGINE_MEMBER(Class, member) { #member, sizeof(Class) },
+const ConfigMember kConfigMembers[] = { PLAITS_ENGINE_MEMBERS };
+#undef PLAITS_ENGINE_MEMBER
+const int kNumConfigMembers = sizeof(kConfigMembers) / sizeof(ConfigMember);
+#endif  // PLAITS_ENGINE_OVERLAY
+
+// Larger than the firmware's arena, so that an engine asking for more than
+// kCatalogArenaSize shows how much it wants instead of getting NULL.
+const size_t kMeasuringArenaSize = 4 * kCatalogArenaSize;
+
+// Constructs the engine, Init()s it on a fresh arena and returns the arena
+// bytes it allocated.
+size_t ArenaUse(const EngineEntry& entry) {
+  static char arena[kMeasuringArenaSize];
+  std::vector<uint64_t> storage(entry.size / 8 + 16, kCatalogDirtyWord);
+  char* base = reinterpret_cast<char*>(&storage[0]);
+  Engine* engine = entry.create(
+      base + (64 - reinterpret_cast<uintptr_t>(base) % 64) % 64);
+  BufferAllocator allocator(arena, kMeasuringArenaSize);
+  engine->Init(&allocator);
+  const size_t used = kMeasuringArenaSize - allocator.free();
+  entry.destroy(engine);
+  return used;
+}
+
+bool Selected(const EngineEntry& entry, int argc, char** argv) {
+  if (argc == 0) {
+    return true;
+  }
+  for (int i = 0; i < argc; ++i) {
+    if (!strcmp(argv[i], entry.id)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// The table generate_engine_config.py checks recipes against.
+void PrintJson(int argc, char** argv) {
+  printf("{\n");
+  printf("  \"schemaVersion\": 1,\n");
+  printf("  \"pointerBytes\": %zu,\n", sizeof(void*));
+  printf("  \"arenaBytes\": %zu,\n", kCatalogArenaSize);
+  printf("  \"engines\": {");
+  const char* separator = "\n";
+  for (size_t i = 0; i < kNumEngines; ++i) {
+    const EngineEntry& entry = kEngines[i];
+    if (Selected(entry, argc, argv)) {
+      printf("%s    \"%s\": { \"object\": %zu, \"arena\": %zu }",
+             separator, entry.id, entry.size, ArenaUse(entry));
+      separator = ",\n";
+    }
+  }
+  printf("\n  }\n}\n");
+}
+
+int main(int argc, char** argv) {
+  if (argc > 1 && !strcmp(argv[1], "--json")) {
+    PrintJson(argc - 2, argv + 2);
+    return 0;
+  }
+
+  printf("%-24s %8s %8s\n", "engine", "object", "arena");
+  for (size_t i = 0; i < kNumEngines; ++i) {
+    const EngineEntry& entry = kEngines[i];
+    if (Selected(entry, argc - 1, argv + 1)) {
+      printf("%-24s %8zu %8zu\n", entry.id, entry.size, ArenaUse(entry));
+    }
+  }
+
+#if PLAITS_ENGINE_OVERLAY
+  size_t sum = 0;
+  size_t largest = 0;
+  printf("\nengine config (overlay):\n");
+  for (int i = 0; i < kNumConfigMembers; ++i) {
+    printf("  %-32s %8zu\n", kConfigMembers[i].name, kConfigMembers[i].size);
+    sum += kConfigMembers[i].size;
+    largest = std::max(largest, kConfigMembers[i].size);
+  }
+  printf("  %-32s %8zu\n", "all resident", sum);
+  printf("  %-32s %8zu\n", "overlay", sizeof(EngineOverlayStorage));
+  printf("  %-32s %8zu (largest engine %zu)\n", "sizeof(Voice)",
+         sizeof(Voice), largest);
+#else
+  printf("\nengine config (resident): sizeof(Voice) %zu\n", sizeof(Voice));
+#endif  // PLAITS_ENGINE_OVERLAY
+  return 0;
+}
@@ -0,0 +1,339 @@
+// Golden-output store for byte-exact optimization work.
+//
+// Hoisting, caching and vectorizing an engine is only safe to do quickly if
+// every step can be shown to leave the output unchanged, bit for bit. This
+// tool renders every catalog engine through a fixed set of deterministic
+// scenarios and either records the result or checks the current tree against
+// the recording:
+//
+//   golden_render record <dir> [<catalog-id>...]
+//   golden_render check <dir> [<catalog-id>...]
+//
+// record writes, per engine, <dir>/<id>.hash -- one line per scenario,
+//   <scenario> <num_blocks> <fnv1a-64 of the raw float blocks>
+// -- and <dir>/<id>.f32, the blocks themselves (kBlockSize OUT samples then
+// kBlockSize AUX samples per block, scenarios in order). check renders again
+// and compares hashes; on a mismatch it reads the recorded samples back and
+// prints the first diverging block, its time, its max |error|, and the max
+// |error| and number of diverging blocks over the whole scenario. It exits
+// with 1 if any engine differs. The .f32 files are only needed to locate a
+// difference, so a store can be trimmed to the .hash files.
+//
+// Each scenario renders a freshly constructed engine with stmlib::Random
+// seeded, so the noise-driven engines are reproducible too. The recording is
+// only comparable with builds from the same compiler and flags: record on the
+// commit before the change, check after it. Build/run with
+// `make golden-record` and `make golden-check` (GOLDEN_DIR, ENGINES).
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+#include "plaits/dsp/dsp.h"
+#include "plaits/resources.h"
+#include "plaits/test/engine_catalog.h"
+#include "stmlib/utils/random.h"
+
+using namespace plaits;
+using namespace stmlib;
+
+// 2000 blocks of 12 samples: half a second per scenario.
+const int kScenarioBlocks = 2000;
+const int kGateBlocks = 500;
+const int kBlockFloats = 2 * kBlockSize;
+
+enum ScenarioKind {
+  SCENARIO_DRONE,
+  SCENARIO_SWEEP,
+  SCENARIO_GATES,
+  SCENARIO_STEREO_SWEEP
+};
+
+struct Scenario {
+  const char* name;
+  ScenarioKind kind;
+};
+
+// Append only: the order of the scenarios is the layout of the .f32 files.
+const Scenario kScenarios[] = {
+  { "drone", SCENARIO_DRONE },
+  { "sweep", SCENARIO_SWEEP },
+  { "gates", SCENARIO_GATES },
+  { "stereo-sweep", SCENARIO_STEREO_SWEEP },
+};
+
+const int kNumScenarios = sizeof(kScenarios) / sizeof(kScenarios[0]);
+
+// Triangle in [0, 1] with the given period in blocks.
+float Triangle(int block, int period) {
+  const float phase = static_cast<float>(block % period) / period;
+  return phase < 0.5f ? 2.0f * phase : 2.0f - 2.0f * phase;
+}
+
+void ScenarioParameters(
+    ScenarioKind kind,
+    int block,
+    EngineParameters* p) {
+  p->trigger = TRIGGER_UNPATCHED;
+  p->note = 48.0f;
+  p->timbre = p->morph = p->harmonics = p->macro = 0.5f;
+  p->accent = 0.8f;
+  p->chord_set_option = 0;
+  p->stereo = false;
+  p->frequency_offset = NULL;
+
+  switch (kind) {
+    case SCENARIO_DRONE:
+      break;
+
+    case SCENARIO_STEREO_SWEEP:
+      p->stereo = true;
+      // Fall through.
+    case SCENARIO_SWEEP:
+      // Co-prime periods, so the knobs reach many combinations, including
+      // both extremes of every axis.
+      p->note = 24.0f + 72.0f * Triangle(block, 1999);
+      p->harmonics = Triangle(block, 1307);
+      p->timbre = Triangle(block, 911);
+      p->morph = Triangle(block, 601);
+      p->macro = Triangle(block, 1103);
+      break;
+
+    case SCENARIO_GATES:
+      {
+        // One note every kGateBlocks, the knobs jumping to a new corner of
+        // the cube with each note, the gate high for a quarter of the note.
+        const int note = block / kGateBlocks;
+        const int phase = block % kGateBlocks;
+        p->trigger = phase < kGateBlocks / 4 ? TRIGGER_HIGH : TRIGGER_LOW;
+        if (phase == 0) {
+          p->trigger |= TRIGGER_RISING_EDGE;
+        }
+        p->note = 36.0f + 7.0f * note;
+        p->harmonics = note & 1 ? 1.0f : 0.0f;
+        p->timbre = note & 2 ? 1.0f : 0.0f;
+        p->morph = note & 1 ? 0.0f : 1.0f;
+        p->accent = note & 1 ? 1.0f : 0.2f;
+      }
+      break;
+  }
+}
+
+uint64_t Fnv1a(const void* data, size_t size, uint64_t hash) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+const uint64_t kFnv1aBasis = 0xcbf29ce484222325ULL;
+
+// Renders one scenario into `blocks` (kScenarioBlocks * kBlockFloats floats).
+void RenderScenario(
+    const EngineEntry& entry,
+    const Scenario& scenario,
+    std::vector<float>* blocks) {
+  std::vector<uint64_t> storage;
+  Random::Seed(0x71f00d);
+  Engine* engine = CreateCatalogEngine(entry, &storage);
+  engine->LoadUserData(
+      entry.user_data_bank >= 0 ? fm_patches_table[entry.user_data_bank] : NULL);
+  engine->Reset();
+
+  blocks->assign(kScenarioBlocks * kBlockFloats, 0.0f);
+  EngineParameters p;
+  for (int block = 0; block < kScenarioBlocks; ++block) {
+    ScenarioParameters(scenario.kind, block, &p);
+    float* out = &(*blocks)[block * kBlockFloats];
+    bool already_enveloped = false;
+    engine->Render(p, out, out + kBlockSize, kBlockSize, &already_enveloped);
+  }
+  entry.destroy(engine);
+}
+
+std::string StorePath(const char* dir, const char* id, const char* extension) {
+  return std::string(dir) + "/" + id + extension;
+}
+
+bool Record(const char* dir, const EngineEntry& entry) {
+  const std::string hash_path = StorePath(dir, entry.id, ".hash");
+  const std::string samples_path = StorePath(dir, entry.id, ".f32");
+  FILE* hashes = fopen(hash_path.c_str(), "w");
+  FILE* samples = hashes ? fopen(samples_path.c_str(), "wb") : NULL;
+  if (!samples) {
+    perror(hashes ? samples_path.c_str() : hash_path.c_str());
+    if (hashes) {
+      fclose(hashes);
+    }
+    return false;
+  }
+  std::vector<float> blocks;
+  for (int i = 0; i < kNumScenarios; ++i) {
+    RenderScenario(entry, kScenarios[i], &blocks);
+    const size_t size = blocks.size() * sizeof(float);
+    fprintf(hashes, "%s %d %016llx\n", kScenarios[i].name, kScenarioBlocks,
+            static_cast<unsigned long long>(
+                Fnv1a(&blocks[0], size, kFnv1aBasis)));
+    fwrite(&blocks[0], 1, size, samples);
+  }
+  fclose(samples);
+  fclose(hashes);
+  printf("%-24s recorded\n", entry.id);
+  return true;
+}
+
+// Reads the recorded hash of every scenario. Returns false if the engine has
+// no recording, or one made with other scenarios.
+bool ReadHashes(const char* dir, const EngineEntry& entry, uint64_t* hashes) {
+  FILE* fp = fopen(StorePath(dir, entry.id, ".hash").c_str(), "r");
+  if (!fp) {
+    return false;
+  }
+  int num_read = 0;
+  char name[64];
+  int num_blocks;
+  unsigned long long hash;
+  while (num_read < kNumScenarios &&
+         fscanf(fp, "%63s %d %llx", name, &num_blocks, &hash) == 3) {
+    if (strcmp(name, kScenarios[num_read].name) ||
+        num_blocks != kScenarioBlocks) {
+      break;
+    }
+    hashes[num_read++] = hash;
+  }
+  fclose(fp);
+  return num_read == kNumScenarios;
+}
+
+// Locates the difference between a scenario render and its recorded samples.
+void ReportDivergence(
+    const char* dir,
+    const EngineEntry& entry,
+    int scenario,
+    const std::vector<float>& blocks) {
+  std::vector<float> golden(blocks.size());
+  FILE* fp = fopen(StorePath(dir, entry.id, ".f32").c_str(), "rb");
+  bool found = fp != NULL;
+  if (fp) {
+    found = !fseek(fp, long(scenario) * long(golden.size() * sizeof(float)),
+                   SEEK_SET) &&
+        fread(&golden[0], sizeof(float), golden.size(), fp) == golden.size();
+    fclose(fp);
+  }
+  if (!found) {
+    printf("%-24s %s: DIFFERS (no recorded samples to locate it)\n",
+           entry.id, kScenarios[scenario].name);
+    return;
+  }
+
+  int first_block = -1;
+  int num_diverging = 0;
+  float first_error = 0.0f;
+  float max_error = 0.0f;
+  for (int block = 0; block < kScenarioBlocks; ++block) {
+    const float* a = &blocks[block * kBlockFloats];
+    const float* b = &golden[block * kBlockFloats];
+    if (!memcmp(a, b, kBlockFloats * sizeof(float))) {
+      continue;
+    }
+    float error = 0.0f;
+    for (int i = 0; i < kBlockFloats; ++i) {
+      const float e = std::fabs(a[i] - b[i]);
+      // A NaN on one side only is as far off as it gets.
+      error = std::isnan(e) ? INFINITY : std::fmax(error, e);
+    }
+    if (first_block < 0) {
+      first_block = block;
+      first_error = error;
+    }
+    max_error = std::fmax(max_error, error);
+    ++num_diverging;
+  }
+  printf("%-24s %s: DIFFERS from block %d (%.2f ms), max error %.3g there, "
+         "%.3g over %d/%d blocks\n",
+         entry.id, kScenarios[scenario].name, first_block,
+         1000.0f * first_block * kBlockSize / kSampleRate, first_error,
+         max_error, num_diverging, kScenarioBlocks);
+}
+
+// Returns 0 if identical, 1 if different, -1 if there is nothing to check.
+int Check(const char* dir, const EngineEntry& entry) {
+  uint64_t hashes[kNumScenarios];
+  if (!ReadHashes(dir, entry, hashes)) {
+    printf("%-24s not recorded\n", entry.id);
+    return -1;
+  }
+  bool identical = true;
+  std::vector<float> blocks;
+  for (int i = 0; i < kNumScenarios; ++i) {
+    RenderScenario(entry, kScenarios[i], &blocks);
+    if (Fnv1a(&blocks[0], blocks.size() * sizeof(float), kFnv1aBasis) !=
+        hashes[i]) {
+      ReportDivergence(dir, entry, i, blocks);
+      identical = false;
+    }
+  }
+  if (identical) {
+    printf("%-24s identical\n", entry.id);
+  }
+  return identical ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+  const bool record = argc >= 3 && !strcmp(argv[1], "record");
+  if (argc < 3 || (!record && strcmp(argv[1], "check"))) {
+    fprintf(stderr, "usage: %s record|check <dir> [<catalog-id>...]\n",
+            argv[0]);
+    return 2;
+  }
+#if defined(__SSE2__)
+  // The Cortex-M4 FPU flushes denormals in hardware.
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+
+  const char* dir = argv[2];
+  std::vector<const EngineEntry*> engines;
+  for (int i = 3; i < argc; ++i) {
+    const EngineEntry* entry = FindEngine(argv[i]);
+    if (!entry) {
+      fprintf(stderr, "unknown engine %s\n", argv[i]);
+      return 2;
+    }
+    engines.push_back(entry);
+  }
+  if (engines.empty()) {
+    for (size_t i = 0; i < kNumEngines; ++i) {
+      engines.push_back(&kEngines[i]);
+    }
+  }
+
+  int num_different = 0;
+  int num_checked = 0;
+  for (size_t i = 0; i < engines.size(); ++i) {
+    if (record) {
+      if (!Record(dir, *engines[i])) {
+        return 2;
+      }
+      continue;
+    }
+    const int result = Check(dir, *engines[i]);
+    if (result >= 0) {
+      ++num_checked;
+      num_different += result;
+    }
+    fflush(stdout);
+  }
+  if (!record) {
+    printf("%d engines checked, %d differ\n", num_checked, num_different);
+  }
+  return num_different ? 1 : 0;
+}
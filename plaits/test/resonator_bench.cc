@@ -0,0 +1,173 @@
+// Mode-count bench for the ResonatorSvf batches behind plaits::Resonator.
+//
+// Runs banks of 4 to kMaxBenchModes band-pass modes, tuned and damped like
+// Resonator::Process tunes them, over kBlockSize-sample blocks, once with the
+// scalar kernel the Cortex-M4 runs and once with the host vector kernel. Both
+// banks see the same excitation and their outputs must match sample for
+// sample; any difference is reported and fails the run. For every mode count
+// it prints
+//   <modes> <scalar_ns> <vector_ns> <scalar/vector>
+// and then how many modes each kernel renders for the cost of the stock
+// 24-mode bank on the scalar kernel. As in cpu_bench.cc the nanoseconds are
+// host numbers; the mode counts at equal cost are the useful result. Build/run
+// with `make resonator-bench`.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+#include "plaits/dsp/dsp.h"
+#include "plaits/dsp/physical_modelling/resonator.h"
+
+using namespace plaits;
+using namespace stmlib;
+
+const int kMaxBenchModes = 64;
+const int kNumBatches = kMaxBenchModes / kModeBatchSize;
+const int kNumBlocks = 20000;
+
+typedef ResonatorSvf<kModeBatchSize, ResonatorSvfScalarKernel<kModeBatchSize> >
+    ScalarBatch;
+typedef ResonatorSvf<kModeBatchSize> VectorBatch;
+
+ScalarBatch scalar_bank[kNumBatches];
+VectorBatch vector_bank[kNumBatches];
+
+float mode_f[kMaxBenchModes];
+float mode_q[kMaxBenchModes];
+float mode_a[kMaxBenchModes];
+
+// Harmonic series with mild stretching and a decreasing Q, clamped below
+// Nyquist the way Resonator::Process does it (structure 0.5, damping 0.7).
+void InitModes(float f0) {
+  float harmonic = f0;
+  float stretch_factor = 1.0f;
+  float stiffness = 0.01f;
+  float q = 500.0f * powf(2.0f, 0.7f * 79.7f / 12.0f);
+  for (int i = 0; i < kMaxBenchModes; ++i) {
+    float f = harmonic * stretch_factor;
+    if (f >= 0.499f) {
+      f = 0.499f;
+    }
+    mode_f[i] = f;
+    mode_q[i] = 1.0f + f * q;
+    mode_a[i] = 0.25f * cosf(0.1f * i) * (1.0f - f * 2.0f);
+    stretch_factor += stiffness;
+    stiffness *= 0.98f;
+    harmonic += f0;
+    q *= 0.9f;
+  }
+}
+
+// A strike every 400 blocks, silence in between: the modes ring out, so the
+// banks spend most of their time on the decaying tails.
+void Excitation(int block, float* in) {
+  for (size_t i = 0; i < kBlockSize; ++i) {
+    in[i] = (block % 400 == 0 && i == 0) ? 1.0f : 0.0f;
+  }
+}
+
+template<typename Batch>
+void RenderBlock(Batch* bank, int num_modes, const float* in, float* out) {
+  Batch::template ProcessBank<FILTER_MODE_BAND_PASS, false>(
+      bank, num_modes / kModeBatchSize, mode_f, mode_q, mode_a,
+      in, out, kBlockSize);
+}
+
+template<typename Batch>
+float Time(Batch* bank, int num_modes) {
+  float in[kBlockSize];
+  float out[kBlockSize];
+  for (int b = 0; b < kNumBatches; ++b) {
+    bank[b].Init();
+  }
+  auto t0 = std::chrono::high_resolution_clock::now();
+  for (int i = 0; i < kNumBlocks; ++i) {
+    Excitation(i, in);
+    RenderBlock(bank, num_modes, in, out);
+  }
+  auto t1 = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<float, std::nano>(t1 - t0).count() / kNumBlocks;
+}
+
+// Runs both banks side by side and returns the number of differing samples.
+int Compare(int num_modes) {
+  float in[kBlockSize];
+  float scalar_out[kBlockSize];
+  float vector_out[kBlockSize];
+  for (int b = 0; b < kNumBatches; ++b) {
+    scalar_bank[b].Init();
+    vector_bank[b].Init();
+  }
+  int mismatches = 0;
+  for (int i = 0; i < 2000; ++i) {
+    Excitation(i, in);
+    RenderBlock(scalar_bank, num_modes, in, scalar_out);
+    RenderBlock(vector_bank, num_modes, in, vector_out);
+    for (size_t j = 0; j < kBlockSize; ++j) {
+      if (scalar_out[j] != vector_out[j]) {
+        if (!mismatches) {
+          printf("%d modes: block %d sample %zu: scalar %.9g vector %.9g\n",
+                 num_modes, i, j, scalar_out[j], vector_out[j]);
+        }
+        ++mismatches;
+      }
+    }
+  }
+  return mismatches;
+}
+
+int main(void) {
+#if defined(__SSE2__)
+  // The Cortex-M4 FPU flushes denormals in hardware, see cpu_bench.cc.
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+#ifndef PLAITS_RESONATOR_SVF_SIMD
+  printf("no vector kernel on this host: both columns are the scalar one\n");
+#endif
+  InitModes(110.0f / kSampleRate);
+
+  int mismatches = 0;
+  for (int modes = kModeBatchSize; modes <= kMaxBenchModes;
+       modes += kModeBatchSize) {
+    mismatches += Compare(modes);
+  }
+
+  float scalar_ns[kNumBatches + 1] = { 0.0f };
+  float vector_ns[kNumBatches + 1] = { 0.0f };
+  for (int b = 1; b <= kNumBatches; ++b) {
+    const int modes = b * kModeBatchSize;
+    scalar_ns[b] = Time(scalar_bank, modes);
+    vector_ns[b] = Time(vector_bank, modes);
+    printf("%3d %9.1f %9.1f %6.2f\n",
+           modes, scalar_ns[b], vector_ns[b], scalar_ns[b] / vector_ns[b]);
+  }
+
+  const float budget = scalar_ns[kMaxNumModes / kModeBatchSize];
+  int scalar_modes = 0;
+  int vector_modes = 0;
+  for (int b = 1; b <= kNumBatches; ++b) {
+    if (scalar_ns[b] <= budget * 1.02f) {
+      scalar_modes = b * kModeBatchSize;
+    }
+    if (vector_ns[b] <= budget * 1.02f) {
+      vector_modes = b * kModeBatchSize;
+    }
+  }
+  printf("modes for the cost of %d scalar modes (%.1f ns): "
+         "scalar %d, vector %d%s\n",
+         kMaxNumModes, budget, scalar_modes, vector_modes,
+         vector_modes == kMaxBenchModes ? " or more" : "");
+
+  if (mismatches) {
+    printf("FAILED: %d samples differ between the kernels\n", mismatches);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,193 @@
+// Per-algorithm bench of the two ways of rendering the operators of a DX7
+// patch: the chain of RenderOperators calls compiled from the opcodes
+// (Algorithms::render_call), and the fused renderer specialised for the
+// algorithm (Algorithms::algorithm_fn) that fm::Voice uses.
+//
+// Every algorithm is run with both renderers on the same frequencies,
+// amplitude ramps and feedback amount, kBlockSize samples at a time. The
+// outputs, the operator phases and amplitudes and the feedback state must be
+// identical; any difference is reported and fails the run. For every
+// algorithm it prints
+//   <algorithm> <table_ns> <fused_ns> <table/fused>
+// with the time of one block, the fastest of a few batches. As in
+// cpu_bench.cc the nanoseconds are host numbers; the ratio is the useful
+// result. Build/run with `make six-op-algorithm-bench`.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+#include "plaits/dsp/dsp.h"
+#include "plaits/dsp/fm/algorithms.h"
+
+using namespace plaits;
+using namespace plaits::fm;
+
+const int kNumOperators = 6;
+const int kNumBlocks = 20000;
+const int kNumBatches = 5;
+
+Algorithms<kNumOperators> algorithms;
+
+struct State {
+  Operator ops[kNumOperators];
+  float fb_state[2];
+
+  void Init() {
+    for (int i = 0; i < kNumOperators; ++i) {
+      ops[i].Reset();
+    }
+    fb_state[0] = fb_state[1] = 0.0f;
+  }
+};
+
+// Inharmonic ratios on a low note, and amplitudes swept by a slow per-operator
+// LFO so that every block has a ramp to render. The feedback amount changes
+// with the algorithm. Computed ahead of the timed loops.
+const int kNumSweepBlocks = 1000;
+
+float frequency[kNumOperators];
+float amplitude[kNumSweepBlocks][kNumOperators];
+int feedback;
+
+void Prepare(int algorithm) {
+  const float f0 = 110.0f / kSampleRate;
+  for (int i = 0; i < kNumOperators; ++i) {
+    frequency[i] = f0 * (0.5f + float((algorithm * 7 + i * 5) % 11) * 0.73f);
+    for (int block = 0; block < kNumSweepBlocks; ++block) {
+      amplitude[block][i] = 1.2f + sinf(
+          0.01f * float(block) * float(i + 1));
+    }
+  }
+  feedback = algorithm % 8;
+}
+
+void RenderTable(int algorithm, State* s, int block, float* temp) {
+  float* buffers[4] = {
+    temp, temp + kBlockSize, temp + 2 * kBlockSize, temp + 2 * kBlockSize
+  };
+  std::fill(&temp[0], &temp[kBlockSize], 0.0f);
+  for (int i = 0; i < kNumOperators; ) {
+    const Algorithms<kNumOperators>::RenderCall& call = \
+        algorithms.render_call(algorithm, i);
+    (*call.render_fn)(
+        &s->ops[i],
+        &frequency[i],
+        &amplitude[block % kNumSweepBlocks][i],
+        s->fb_state,
+        feedback,
+        buffers[call.input_index],
+        buffers[call.output_index],
+        kBlockSize);
+    i += call.n;
+  }
+}
+
+void RenderFused(int algorithm, State* s, int block, float* out) {
+  std::fill(&out[0], &out[kBlockSize], 0.0f);
+  (*algorithms.algorithm_fn(algorithm))(
+      s->ops,
+      frequency,
+      amplitude[block % kNumSweepBlocks],
+      s->fb_state,
+      feedback,
+      out,
+      kBlockSize);
+}
+
+template<bool fused>
+float Time(int algorithm) {
+  State s;
+  float temp[3 * kBlockSize];
+  float fastest = 0.0f;
+  for (int batch = 0; batch < kNumBatches; ++batch) {
+    s.Init();
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kNumBlocks; ++i) {
+      if (fused) {
+        RenderFused(algorithm, &s, i, temp);
+      } else {
+        RenderTable(algorithm, &s, i, temp);
+      }
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    const float ns = std::chrono::duration<float, std::nano>(
+        t1 - t0).count() / kNumBlocks;
+    fastest = batch == 0 ? ns : std::min(fastest, ns);
+  }
+  return fastest;
+}
+
+// Runs both renderers side by side and returns the number of differing
+// samples and state variables.
+int Compare(int algorithm) {
+  State table;
+  State fused;
+  table.Init();
+  fused.Init();
+  float temp[3 * kBlockSize];
+  float out[kBlockSize];
+  int mismatches = 0;
+  for (int i = 0; i < 2 * kNumSweepBlocks; ++i) {
+    RenderTable(algorithm, &table, i, temp);
+    RenderFused(algorithm, &fused, i, out);
+    for (size_t j = 0; j < kBlockSize; ++j) {
+      if (temp[j] != out[j]) {
+        if (!mismatches) {
+          printf("algorithm %d: block %d sample %zu: table %.9g fused %.9g\n",
+                 algorithm + 1, i, j, temp[j], out[j]);
+        }
+        ++mismatches;
+      }
+    }
+    for (int j = 0; j < kNumOperators; ++j) {
+      if (table.ops[j].phase != fused.ops[j].phase ||
+          table.ops[j].amplitude != fused.ops[j].amplitude) {
+        ++mismatches;
+      }
+    }
+    if (table.fb_state[0] != fused.fb_state[0] ||
+        table.fb_state[1] != fused.fb_state[1]) {
+      ++mismatches;
+    }
+  }
+  return mismatches;
+}
+
+int main(void) {
+#if defined(__SSE2__)
+  // The Cortex-M4 FPU flushes denormals in hardware, see cpu_bench.cc.
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+  algorithms.Init();
+
+  int mismatches = 0;
+  float table_total = 0.0f;
+  float fused_total = 0.0f;
+  for (int i = 0; i < Algorithms<kNumOperators>::NUM_ALGORITHMS; ++i) {
+    Prepare(i);
+    mismatches += Compare(i);
+    const float table_ns = Time<false>(i);
+    const float fused_ns = Time<true>(i);
+    printf("%2d %9.1f %9.1f %6.2f\n",
+           i + 1, table_ns, fused_ns, table_ns / fused_ns);
+    table_total += table_ns;
+    fused_total += fused_ns;
+  }
+  printf("all %9.1f %9.1f %6.2f\n",
+         table_total, fused_total, table_total / fused_total);
+
+  if (mismatches) {
+    printf("FAILED: %d samples or states differ between the renderers\n",
+           mismatches);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,157 @@
+// Per-block cost of the LPC speech controller around word-bank changes.
+//
+// A bank change used to decode the whole TI bitstream of the new bank inside
+// the block that selected it. The controller now decodes at most
+// kLPCSpeechSynthLoadFramesPerBlock frames per block instead, and holds the
+// synth and any trigger until the bank is complete. This bench plays the same
+// sequence both ways: bank changes every 100 blocks in a cycle through the
+// five stock banks, the address swept back and forth, and a trigger every 20
+// blocks. "whole" loads each new bank at once before rendering the block, as
+// before; "streamed" leaves it to the controller. For both it prints
+//   <mode> <p50_ns> <p99_ns> <max_ns> <max/p50>
+// of kBlockSize-sample blocks, and how many blocks the streamed load of each
+// bank takes. Each block's time is the fastest of a few identical replays, so
+// that the max is the controller's own peak block rather than host scheduling
+// noise; as in cpu_bench.cc the nanoseconds are host numbers.
+//
+// It fails if a streamed load leaves different frames or word boundaries than
+// a whole one. Build/run with `make speech-bank-bench`.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+#include "plaits/dsp/dsp.h"
+#include "plaits/dsp/speech/lpc_speech_synth_words.h"
+#include "stmlib/utils/buffer_allocator.h"
+
+using namespace plaits;
+using namespace stmlib;
+
+const int kNumBlocks = 5000;
+const int kBlocksPerBankChange = 100;
+const int kBlocksPerTrigger = 20;
+const int kNumPasses = 5;
+
+char ram_block[16 * 1024];
+char reference_ram_block[16 * 1024];
+
+LPCSpeechSynthWordBank word_bank;
+LPCSpeechSynthController controller;
+
+// Returns the time of every block of the sequence.
+void Play(bool whole, std::vector<float>* ns) {
+  BufferAllocator allocator(ram_block, sizeof(ram_block));
+  word_bank.Init(word_banks_, LPC_SPEECH_SYNTH_NUM_WORD_BANKS, &allocator);
+  controller.Init(&word_bank);
+
+  float excitation[kBlockSize];
+  float output[kBlockSize];
+  for (int i = 0; i < kNumBlocks; ++i) {
+    const int bank = (i / kBlocksPerBankChange) % LPC_SPEECH_SYNTH_NUM_WORD_BANKS;
+    const float address = 0.5f + 0.5f * sinf(float(i) * 0.003f);
+    const bool trigger = i % kBlocksPerTrigger == 0;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    if (whole) {
+      word_bank.Load(bank);
+    }
+    controller.Render(
+        false, trigger, bank, 200.0f / kSampleRate, 0.5f, 0.5f, address,
+        0.5f, 1.0f, excitation, output, kBlockSize);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    (*ns)[i] = std::chrono::duration<float, std::nano>(t1 - t0).count();
+  }
+}
+
+void Report(const char* mode, bool whole) {
+  std::vector<float> fastest(kNumBlocks, 0.0f);
+  std::vector<float> ns(kNumBlocks);
+  for (int pass = 0; pass < kNumPasses; ++pass) {
+    Play(whole, &ns);
+    for (int i = 0; i < kNumBlocks; ++i) {
+      fastest[i] = pass == 0 ? ns[i] : std::min(fastest[i], ns[i]);
+    }
+  }
+  std::sort(fastest.begin(), fastest.end());
+  const float p50 = fastest[kNumBlocks / 2];
+  const float p99 = fastest[kNumBlocks * 99 / 100];
+  const float max = fastest[kNumBlocks - 1];
+  printf("%-8s %8.1f %8.1f %8.1f %6.1f\n", mode, p50, p99, max, max / p50);
+}
+
+// Loads every bank in steps, and compares it with the same bank loaded at
+// once. Returns the number of differences.
+int Compare() {
+  BufferAllocator allocator(ram_block, sizeof(ram_block));
+  BufferAllocator reference_allocator(
+      reference_ram_block, sizeof(reference_ram_block));
+  LPCSpeechSynthWordBank reference;
+  word_bank.Init(word_banks_, LPC_SPEECH_SYNTH_NUM_WORD_BANKS, &allocator);
+  reference.Init(
+      word_banks_, LPC_SPEECH_SYNTH_NUM_WORD_BANKS, &reference_allocator);
+
+  int differences = 0;
+  for (int bank = 0; bank < LPC_SPEECH_SYNTH_NUM_WORD_BANKS; ++bank) {
+    int blocks = 1;
+    word_bank.Load(bank, kLPCSpeechSynthLoadFramesPerBlock);
+    while (word_bank.loading()) {
+      word_bank.Load(bank, kLPCSpeechSynthLoadFramesPerBlock);
+      ++blocks;
+    }
+    reference.Load(bank);
+    printf("bank %d: %4d frames, loaded in %2d blocks\n",
+           bank, word_bank.num_frames(), blocks);
+
+    if (word_bank.num_frames() != reference.num_frames()) {
+      ++differences;
+      continue;
+    }
+    for (int i = 0; i < reference.num_frames(); ++i) {
+      const LPCSpeechSynth::Frame& a = word_bank.frames()[i];
+      const LPCSpeechSynth::Frame& b = reference.frames()[i];
+      if (a.energy != b.energy || a.period != b.period ||
+          a.k0 != b.k0 || a.k1 != b.k1 || a.k2 != b.k2 || a.k3 != b.k3 ||
+          a.k4 != b.k4 || a.k5 != b.k5 || a.k6 != b.k6 || a.k7 != b.k7 ||
+          a.k8 != b.k8 || a.k9 != b.k9) {
+        ++differences;
+      }
+    }
+    for (int i = 0; i < 64; ++i) {
+      const float address = (float(i) + 0.5f) / 64.0f;
+      int start, end, reference_start, reference_end;
+      word_bank.GetWordBoundaries(address, &start, &end);
+      reference.GetWordBoundaries(address, &reference_start, &reference_end);
+      if (start != reference_start || end != reference_end) {
+        ++differences;
+      }
+    }
+  }
+  return differences;
+}
+
+int main(void) {
+#if defined(__SSE2__)
+  // The Cortex-M4 FPU flushes denormals in hardware, see cpu_bench.cc.
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+
+  const int differences = Compare();
+  printf("%-8s %8s %8s %8s %6s\n", "mode", "p50", "p99", "max", "max/p50");
+  Report("whole", true);
+  Report("streamed", false);
+
+  if (differences) {
+    printf("FAILED: %d differences between streamed and whole banks\n",
+           differences);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,56 @@
+import importlib.util
+import pathlib
+import unittest
+
+
+TOOL = pathlib.Path(__file__).parents[1] / "tools" / "cpu_regression.py"
+SPEC = importlib.util.spec_from_file_location("cpu_regression", TOOL)
+cpu_regression = importlib.util.module_from_spec(SPEC)
+SPEC.loader.exec_module(cpu_regression)
+
+
+class CpuRegressionTest(unittest.TestCase):
+    OUTPUT = (
+        "virtual-analog          0.264    0.134    0.406\n"
+        "two-op-fm               0.996    1.004    1.005\n"
+        "wavetable               CRASHED    CRASHED    CRASHED\n"
+    )
+
+    def test_parses_ratios_and_failures(self):
+        ratios, failed = cpu_regression.parse_ratios(self.OUTPUT)
+        self.assertEqual(ratios["virtual-analog"],
+                         {"mono": 0.264, "stereo": 0.134, "worst": 0.406})
+        self.assertEqual(set(ratios), {"virtual-analog", "two-op-fm"})
+        self.assertEqual(failed, {"wavetable"})
+
+    def test_median_drops_engines_missing_from_a_run(self):
+        runs = [
+            {"a": {"mono": 1.0, "stereo": 2.0, "worst": 3.0},
+             "b": {"mono": 1.0, "stereo": 1.0, "worst": 1.0}},
+            {"a": {"mono": 3.0, "stereo": 2.0, "worst": 1.0}},
+            {"a": {"mono": 2.0, "stereo": 5.0, "worst": 9.0}},
+        ]
+        self.assertEqual(cpu_regression.median_of(runs),
+                         {"a": {"mono": 2.0, "stereo": 2.0, "worst": 3.0}})
+
+    def test_compare_applies_separate_worst_threshold(self):
+        baseline = {"a": {"mono": 0.4, "stereo": 0.4, "worst": 0.4}}
+        current = {"a": {"mono": 0.44, "stereo": 0.6, "worst": 0.56}}
+        regressions, _ = cpu_regression.compare(baseline, current, set(), 0.25, 0.5)
+        self.assertEqual(len(regressions), 1)
+        self.assertIn("a stereo", regressions[0])
+
+    def test_crash_of_a_baselined_engine_is_a_regression(self):
+        baseline = {"a": {"mono": 0.4, "stereo": 0.4, "worst": 0.4}}
+        regressions, _ = cpu_regression.compare(baseline, {}, {"a"}, 0.25, 0.5)
+        self.assertEqual(regressions, ["a: crashed or timed out"])
+
+    def test_tiny_ratios_are_not_compared(self):
+        baseline = {"a": {"mono": 0.01, "stereo": 0.01, "worst": 0.01}}
+        current = {"a": {"mono": 0.03, "stereo": 0.03, "worst": 0.03}}
+        regressions, notes = cpu_regression.compare(baseline, current, set(), 0.25, 0.5)
+        self.assertEqual((regressions, notes), ([], []))
+
+
+if __name__ == "__main__":
+    unittest.main()
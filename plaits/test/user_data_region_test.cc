@@ -3,7 +3,10 @@
 // Host checks for swappable FM bank regions (plaits/user_data.h): the bank-keyed
 // region lookup, the tag that separates a transferred bank from the baked one
 // sitting in the same flash, Save's refusal to touch a bank it does not own, and
-// the patch count a transferred bank declares.
+// the patch count a transferred bank declares. Also the banks laid out for
+// reading in place (UserDataLayout in plaits/user_data_region.h): what the
+// builder's packer writes is exactly what fm::Patch::Unpack makes of the same
+// voice, and anything else reads as packed data.
 //
 // The point of the feature is the case a single-region build cannot express:
 // two banks holding DIFFERENT transferred data at the same time, instead of one
@@ -12,6 +15,7 @@
 //   g++ -std=c++11 -DTEST -I<repo-root> plaits/test/user_data_region_test.cc \
 //       -o /tmp/udrt && /tmp/udrt
 
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
 #include <cstring>
@@ -41,6 +45,7 @@ static const int kNumUserDataRegions = 2;
 }  // namespace plaits
 
 #include "plaits/user_data.h"
+#include "plaits/dsp/fm/patch.h"
 
 using plaits::UserData;
 using plaits::bank_0;
@@ -86,6 +91,27 @@ int save_slot;
 
 void DoSave() { save_result = user_data.Save(payload, save_slot); }
 
+// One voice, packed[i] = (i * 37) & 0x7f, as written by
+// alt_firmwares/plaits_lab_builder/user_data_layout.py:
+//   lay_out_fm_bank(bytes((i * 37) & 0x7f for i in range(128)))
+// Several of its fields are out of range, so the record also pins the clamps.
+const uint8_t kLaidOutVoice[] = {
+  215, 1, 156, 1, 0, 37, 74, 99, 20, 57, 94, 3,
+  40, 77, 99, 3, 1, 4, 1, 0, 6, 1, 21, 80,
+  7, 99, 26, 63, 99, 9, 46, 83, 99, 29, 66, 99,
+  0, 3, 1, 2, 5, 99, 0, 16, 69, 6, 99, 15,
+  52, 89, 99, 35, 72, 99, 18, 55, 92, 1, 0, 6,
+  3, 2, 99, 1, 10, 58, 4, 95, 4, 41, 78, 99,
+  24, 61, 98, 7, 44, 81, 2, 1, 3, 0, 0, 99,
+  0, 5, 47, 3, 84, 99, 30, 67, 99, 13, 50, 87,
+  99, 33, 70, 3, 2, 0, 1, 5, 90, 1, 31, 36,
+  2, 73, 99, 19, 56, 93, 2, 39, 76, 99, 22, 59,
+  0, 0, 5, 2, 2, 79, 0, 26, 25, 0, 62, 99,
+  8, 45, 82, 99, 28, 65, 6, 3, 1, 48, 85, 99,
+  31, 0, 2, 4, 48, 14, 51, 88, 125, 34, 71, 108,
+  17, 54, 91, 63,
+};
+
 }  // namespace
 
 int main() {
@@ -173,7 +199,42 @@ int main() {
   assert(UserData::bank_length(bank) == 0x1000);
   assert(UserData::bank_length(NULL) == 0x1000);
 
+  // ---- A laid-out bank is read in place, and its record is what Unpack makes
+  // of the packed voice.
+  using plaits::UserDataLayout;
+  using plaits::fm::Patch;
+  assert(sizeof(Patch) == 156);
+  assert(sizeof(kLaidOutVoice) == UserDataLayout::HEADER_SIZE + sizeof(Patch));
+  uint8_t packed[Patch::SYX_SIZE];
+  for (int i = 0; i < Patch::SYX_SIZE; ++i) {
+    packed[i] = (i * 37) & 0x7f;
+  }
+  Patch unpacked;
+  unpacked.Unpack(packed);
+  int count = 0;
+  const uint8_t* records = UserDataLayout::records(
+      kLaidOutVoice, sizeof(Patch), &count);
+  assert(records == kLaidOutVoice + UserDataLayout::HEADER_SIZE);
+  assert(count == 1);
+  assert(!std::memcmp(records, &unpacked, sizeof(Patch)));
+
+  // A layout the firmware was not built for reads as packed data, not as
+  // records of the wrong shape.
+  uint8_t laid_out[sizeof(kLaidOutVoice)];
+  std::memcpy(laid_out, kLaidOutVoice, sizeof(laid_out));
+  laid_out[1] = UserDataLayout::VERSION + 1;
+  assert(!UserDataLayout::records(laid_out, sizeof(Patch), &count));
+  laid_out[1] = UserDataLayout::VERSION;
+  assert(!UserDataLayout::records(laid_out, sizeof(Patch) - 1, &count));
+  laid_out[3] = 0;
+  assert(!UserDataLayout::records(laid_out, sizeof(Patch), &count));
+  assert(!UserDataLayout::records(NULL, sizeof(Patch), &count));
+  // No packed bank starts with the magic: every packed byte is 7-bit.
+  assert(!UserDataLayout::records(packed, sizeof(Patch), &count));
+  assert(!UserDataLayout::records(bank, sizeof(Patch), &count));
+
   std::printf("user_data_region_test: 2 simultaneous regions, bank-keyed tags, "
-              "Save refusals, and declared patch counts validated\n");
+              "Save refusals, declared patch counts, and laid-out banks "
+              "validated\n");
   return 0;
 }
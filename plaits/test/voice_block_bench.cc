@@ -0,0 +1,286 @@
+// Per-block latency histogram for the complete Plaits voice.
+//
+// cpu_bench.cc times Engine::Render in a tight loop and divides by the number
+// of blocks, which hides exactly the heavy blocks the "stagger, don't
+// alternate" advice in PERFORMANCE.md is about. This harness drives the real
+// plaits::Voice::Render instead (trigger delay, LPG, limiter, hard-sync
+// fallback, model switching) one block at a time, from a recorded modulation
+// sequence, and times every block on its own. For each scenario and engine
+// slot it prints
+//   <scenario> <slot> <mean_ns> <p50_ns> <p99_ns> <max_ns> <stddev_ns>
+//   hist <bin_ns> <n0> ... <n15> <overflow>
+// where the histogram bins are bin_ns wide, starting at zero, and bin_ns is a
+// quarter of the slot's median block so shapes compare across engines. As in
+// cpu_bench.cc the nanoseconds are host numbers; the useful results are the
+// peak/mean ratio and the shape of the tail. Each block's time is the fastest
+// of a few identical replays (see Play), so the max is the voice's own peak
+// block rather than host scheduling noise.
+//
+// The built-in scenarios are synthesized recordings (a drone with moving
+// knobs, clocked gates with CV on TIMBRE/MORPH, LEVEL as a VCA, audio-rate
+// sync, and a model change every 100 ms through every slot, whose first blocks
+// are also reported one by one). A sequence captured elsewhere can be
+// replayed with `voice_block_bench <file>`: one block per line,
+//   <trigger> <note> <timbre> <morph> <harmonics> <level> <engine>
+// in the units of plaits::Modulations, '#' starting a comment, and an optional
+// "patched" line listing the jacks the recording had patched (any of trigger,
+// timbre, morph, level, frequency). Build/run with `make voice-block-bench`.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+#include "plaits/dsp/dsp.h"
+#include "plaits/dsp/voice.h"
+#include "stmlib/utils/buffer_allocator.h"
+
+using namespace plaits;
+using namespace stmlib;
+
+const int kNumHistogramBins = 16;
+const int kBlocksPerScenario = 8000;
+const int kNumPasses = 3;
+const int kBlocksPerModelChange = 400;
+
+char ram_block[16 * 1024];
+Voice voice;
+
+struct Recording {
+  std::vector<Modulations> blocks;
+  Patch patch;
+};
+
+void InitPatch(Patch* patch, int engine) {
+  memset(patch, 0, sizeof(*patch));
+  patch->engine = engine;
+  patch->note = 48.0f;
+  patch->harmonics = 0.5f;
+  patch->timbre = 0.5f;
+  patch->morph = 0.5f;
+  patch->decay = 0.5f;
+  patch->lpg_colour = 0.5f;
+  patch->timbre_modulation_amount = 0.5f;
+  patch->morph_modulation_amount = 0.5f;
+}
+
+inline float Triangle(int block, int period) {
+  float phase = static_cast<float>(block % period) / static_cast<float>(period);
+  return phase < 0.5f ? 2.0f * phase : 2.0f - 2.0f * phase;
+}
+
+// Synthesizes one of the built-in recordings. Periods are chosen coprime so
+// the knobs do not line up into a handful of repeating states.
+void Synthesize(const char* scenario, int num_blocks, Recording* recording) {
+  recording->blocks.clear();
+  for (int i = 0; i < num_blocks; ++i) {
+    Modulations m;
+    memset(&m, 0, sizeof(m));
+    if (!strcmp(scenario, "drone")) {
+      // CV and knob sum before the engine sees them, so CV stands in for
+      // a hand on the panel here.
+      m.timbre_patched = true;
+      m.morph_patched = true;
+      m.harmonics = Triangle(i, 1999) - 0.5f;
+      m.timbre = Triangle(i, 1433) - 0.5f;
+      m.morph = Triangle(i, 1031) - 0.5f;
+      m.note = 24.0f * Triangle(i, 2503) - 12.0f;
+    } else if (!strcmp(scenario, "clocked")) {
+      m.trigger_patched = true;
+      m.timbre_patched = true;
+      m.morph_patched = true;
+      m.trigger = (i % 200) < 20 ? 1.0f : 0.0f;
+      m.timbre = Triangle(i, 733) - 0.5f;
+      m.morph = Triangle(i, 1187) - 0.5f;
+    } else if (!strcmp(scenario, "level")) {
+      m.trigger_patched = true;
+      m.level_patched = true;
+      m.trigger = (i % 300) < 30 ? 1.0f : 0.0f;
+      m.level = Triangle(i, 300);
+    } else if (!strcmp(scenario, "sync")) {
+      // An edge every 37 samples: most blocks carry one, some none, so both
+      // the native and the two-piece fallback paths are exercised.
+      recording->patch.model_cv_option = 4;
+      for (size_t j = 0; j < kBlockSize; ++j) {
+        if ((i * kBlockSize + j) % 37 == 0) {
+          m.hard_sync |= 1u << j;
+        }
+      }
+    }
+    for (size_t j = 0; j < kMaxBlockSize; ++j) {
+      m.frequency_audio[j] = m.frequency;
+    }
+    recording->blocks.push_back(m);
+  }
+}
+
+bool Load(const char* path, Recording* recording) {
+  FILE* fp = fopen(path, "r");
+  if (!fp) {
+    fprintf(stderr, "Cannot open %s\n", path);
+    return false;
+  }
+  bool trigger_patched = false;
+  bool timbre_patched = false;
+  bool morph_patched = false;
+  bool level_patched = false;
+  bool frequency_patched = false;
+  char line[256];
+  recording->blocks.clear();
+  while (fgets(line, sizeof(line), fp)) {
+    if (line[0] == '#') {
+      continue;
+    }
+    if (!strncmp(line, "patched", 7)) {
+      trigger_patched = strstr(line, "trigger") != NULL;
+      timbre_patched = strstr(line, "timbre") != NULL;
+      morph_patched = strstr(line, "morph") != NULL;
+      level_patched = strstr(line, "level") != NULL;
+      frequency_patched = strstr(line, "frequency") != NULL;
+      continue;
+    }
+    Modulations m;
+    memset(&m, 0, sizeof(m));
+    if (sscanf(line, "%f %f %f %f %f %f %f",
+               &m.trigger, &m.note, &m.timbre, &m.morph,
+               &m.harmonics, &m.level, &m.engine) != 7) {
+      continue;
+    }
+    m.trigger_patched = trigger_patched;
+    m.timbre_patched = timbre_patched;
+    m.morph_patched = morph_patched;
+    m.level_patched = level_patched;
+    m.frequency_patched = frequency_patched;
+    for (size_t j = 0; j < kMaxBlockSize; ++j) {
+      m.frequency_audio[j] = m.frequency;
+    }
+    recording->blocks.push_back(m);
+  }
+  fclose(fp);
+  return !recording->blocks.empty();
+}
+
+void Report(const char* scenario, const char* slot, std::vector<float>* ns) {
+  double sum = 0.0;
+  for (size_t i = 0; i < ns->size(); ++i) {
+    sum += (*ns)[i];
+  }
+  double mean = sum / ns->size();
+  double variance = 0.0;
+  for (size_t i = 0; i < ns->size(); ++i) {
+    variance += ((*ns)[i] - mean) * ((*ns)[i] - mean);
+  }
+  double stddev = sqrt(variance / ns->size());
+
+  int histogram[kNumHistogramBins + 1] = { 0 };
+  std::vector<float> sorted(*ns);
+  std::sort(sorted.begin(), sorted.end());
+  double median = sorted[sorted.size() / 2];
+  double bin = std::max(median * 0.25, 1.0);
+  for (size_t i = 0; i < ns->size(); ++i) {
+    int b = static_cast<int>((*ns)[i] / bin);
+    ++histogram[std::min(b, kNumHistogramBins)];
+  }
+
+  printf("%-8s %-6s %9.1f %9.1f %9.1f %9.1f %9.1f\n",
+         scenario, slot, mean, median,
+         sorted[sorted.size() * 99 / 100], sorted.back(), stddev);
+  printf("hist %.1f", bin);
+  for (int i = 0; i <= kNumHistogramBins; ++i) {
+    printf(" %d", histogram[i]);
+  }
+  printf("\n");
+}
+
+// Plays the recording kNumPasses times from a freshly initialized voice and
+// keeps, for every block, the fastest of its timings. The voice is replayed
+// from the same state and inputs, so a block that is heavy because of what the
+// DSP does is heavy in every pass, while a block stretched by the host
+// scheduler or a page fault is not: the max below is the voice's own peak.
+void Play(
+    const Recording& recording,
+    Patch* patch,
+    bool switch_models,
+    std::vector<float>* ns) {
+  Voice::Frame frames[kBlockSize];
+  ns->assign(recording.blocks.size(), 1e30f);
+  for (int pass = 0; pass < kNumPasses; ++pass) {
+    BufferAllocator allocator(ram_block, sizeof(ram_block));
+    voice.Init(&allocator);
+    for (size_t i = 0; i < recording.blocks.size(); ++i) {
+      if (switch_models) {
+        patch->engine = (i / kBlocksPerModelChange) % kMaxEngines;
+      }
+      auto t0 = std::chrono::high_resolution_clock::now();
+      voice.Render(*patch, recording.blocks[i], frames, kBlockSize);
+      auto t1 = std::chrono::high_resolution_clock::now();
+      float t = std::chrono::duration<float, std::nano>(t1 - t0).count();
+      (*ns)[i] = std::min((*ns)[i], t);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+#if defined(__SSE2__)
+  // The Cortex-M4 FPU flushes denormals in hardware, see cpu_bench.cc.
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+  const char* scenarios[] = { "drone", "clocked", "level", "sync", NULL };
+  const char* file_scenario[] = { "file", NULL };
+  const char** names = argc > 1 ? file_scenario : scenarios;
+
+  Recording recording;
+  std::vector<float> ns;
+  char slot[16];
+  for (const char** scenario = names; *scenario; ++scenario) {
+    for (int engine = 0; engine < kMaxEngines; ++engine) {
+      InitPatch(&recording.patch, engine);
+      if (argc > 1) {
+        if (!Load(argv[1], &recording)) {
+          return 1;
+        }
+      } else {
+        Synthesize(*scenario, kBlocksPerScenario, &recording);
+      }
+      Play(recording, &recording.patch, false, &ns);
+      snprintf(slot, sizeof(slot), "%d", engine);
+      Report(*scenario, slot, &ns);
+    }
+  }
+
+  // Model changes pay for LoadUserData/Reset and a cold engine on top of the
+  // render itself; that spike lands in the voice, never in an engine bench.
+  // An overlay engine is also zeroed, constructed and Init()ed in that block,
+  // inside the audio interrupt. Every slot is switched to once, and its first
+  // block is reported against the median of its other blocks:
+  //   switch <slot> <first_block_ns> <median_ns> <first/median>
+  InitPatch(&recording.patch, 0);
+  Synthesize("clocked", kMaxEngines * kBlocksPerModelChange, &recording);
+  Play(recording, &recording.patch, true, &ns);
+  Report("switch", "all", &ns);
+  int heaviest = 0;
+  float heaviest_ns = 0.0f;
+  for (int engine = 0; engine < kMaxEngines; ++engine) {
+    std::vector<float>::const_iterator first =
+        ns.begin() + engine * kBlocksPerModelChange;
+    std::vector<float> others(first + 1, first + kBlocksPerModelChange);
+    std::sort(others.begin(), others.end());
+    const float median = others[others.size() / 2];
+    printf("switch   %-6d %9.1f %9.1f %8.2fx\n",
+           engine, *first, median, *first / median);
+    if (*first > heaviest_ns) {
+      heaviest = engine;
+      heaviest_ns = *first;
+    }
+  }
+  printf("heaviest switch: slot %d, %.1f ns\n", heaviest, heaviest_ns);
+  return 0;
+}
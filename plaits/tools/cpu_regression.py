@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""Fail when an engine's render cost grows against the stored baseline.
+
+Runs `plaits/test/cpu_bench --ratios`, which times every engine against the
+stock reference engine in the same process and prints three ratios per engine:
+flat mono, flat stereo, and the worst single block of the knob sweep. Host
+nanoseconds drift with the machine, the compiler and the load; the ratio to an
+engine that ran under the same conditions is what stays put across commits.
+The bench is repeated and every ratio keeps its median over the repeats. Each
+is compared with plaits/test/cpu_baseline.json, and the run fails if any grew
+by more than the threshold, or if an engine that had a cost now crashes or
+times out.
+
+    make -f plaits/test/makefile cpu-regression
+    make -f plaits/test/makefile cpu-baseline     # accept the current costs
+
+Refresh the baseline in the same commit as an intended cost change, and when
+the machine that runs the gate changes: the ratios are steadier than the
+nanoseconds, not independent of the host.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import platform
+import statistics
+import subprocess
+import sys
+from pathlib import Path
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+BASELINE_PATH = REPO_ROOT / "plaits/test/cpu_baseline.json"
+# Same reference as plaits_lab.cpu_reference_ratio(), so the numbers read the
+# same way as the SDK's `check` output. cpu_bench --ratios divides by it.
+REFERENCE_ENGINE = "two-op-fm"
+METRICS = ("mono", "stereo", "worst")
+# Between two gate runs (medians of three) on a busy single-core VM the flat
+# ratios moved by up to 17%, the one-block worst ratios by up to 38%. The
+# thresholds leave a margin above that; a quiet machine can pass tighter ones.
+DEFAULT_THRESHOLD = 0.25
+DEFAULT_WORST_THRESHOLD = 0.5
+DEFAULT_REPEATS = 3
+# Below this share of the reference, timer and loop overhead dominate the
+# measurement and a ratio can double without the engine changing.
+MIN_COMPARED_RATIO = 0.05
+
+
+def parse_ratios(text: str) -> tuple[dict[str, dict[str, float]], set[str]]:
+    """cpu_bench --ratios lines: <id> <mono> <stereo> <worst>, or
+    CRASHED/TIMEOUT in every column."""
+    ratios = {}
+    failed = set()
+    for line in text.splitlines():
+        fields = line.split()
+        if len(fields) != 1 + len(METRICS):
+            continue
+        try:
+            ratios[fields[0]] = dict(zip(METRICS, map(float, fields[1:])))
+        except ValueError:
+            failed.add(fields[0])
+    return ratios, failed
+
+
+def median_of(runs: list[dict[str, dict[str, float]]]) -> dict[str, dict[str, float]]:
+    """Per-engine, per-metric median over repeats; an engine missing from any
+    run is dropped, so an engine that crashed once does not get a clean figure."""
+    engines = set(runs[0]).intersection(*runs[1:])
+    return {engine_id: {metric: statistics.median(run[engine_id][metric] for run in runs)
+                        for metric in METRICS}
+            for engine_id in engines}
+
+
+def compare(
+    baseline: dict[str, dict[str, float]],
+    current: dict[str, dict[str, float]],
+    failed: set[str],
+    threshold: float,
+    worst_threshold: float,
+) -> tuple[list[str], list[str]]:
+    """Returns (regressions, notes), one line each."""
+    regressions = []
+    notes = []
+    for engine_id, expected in sorted(baseline.items()):
+        if engine_id in failed:
+            regressions.append(f"{engine_id}: crashed or timed out")
+            continue
+        if engine_id not in current:
+            notes.append(f"{engine_id}: not measured")
+            continue
+        for metric in METRICS:
+            if metric not in expected or metric not in current[engine_id]:
+                continue
+            old = expected[metric]
+            new = current[engine_id][metric]
+            if max(old, new) < MIN_COMPARED_RATIO:
+                continue
+            change = new / old - 1.0 if old > 0 else float("inf")
+            line = f"{engine_id} {metric}: {old:.3f}x -> {new:.3f}x ({100 * change:+.0f}%)"
+            allowed = worst_threshold if metric == "worst" else threshold
+            if change > allowed:
+                regressions.append(line)
+            elif change < -allowed:
+                notes.append(line + ", faster: refresh the baseline to lock it in")
+    for engine_id in sorted(set(current) - set(baseline)):
+        notes.append(f"{engine_id}: not in the baseline")
+    return regressions, notes
+
+
+def run_bench(bench: str, *args: str) -> str:
+    result = subprocess.run(
+        [bench, *args], text=True, capture_output=True, check=False)
+    if result.returncode:
+        raise RuntimeError(f"{bench} {' '.join(args)} exited {result.returncode}")
+    return result.stdout
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser()
+    parser.add_argument("engines", nargs="*",
+                        help="catalog ids to measure (default: all)")
+    parser.add_argument("--bench", default="./cpu_bench",
+                        help="cpu_bench binary to run")
+    parser.add_argument("--ratios", type=Path, action="append", default=[],
+                        help="saved cpu_bench --ratios output to use instead of "
+                             "running it (repeatable)")
+    parser.add_argument("--repeats", type=int, default=DEFAULT_REPEATS,
+                        help="runs of the bench, median kept")
+    parser.add_argument("--baseline", type=Path, default=BASELINE_PATH)
+    parser.add_argument("--threshold", type=float, default=DEFAULT_THRESHOLD,
+                        help="allowed growth of the mono and stereo ratios, 0.25 = 25%%")
+    parser.add_argument("--worst-threshold", type=float, default=DEFAULT_WORST_THRESHOLD,
+                        help="allowed growth of the worst-block ratio")
+    parser.add_argument("--update", action="store_true",
+                        help="write the current ratios as the new baseline")
+    args = parser.parse_args()
+    if args.repeats < 1:
+        parser.error("--repeats must be at least 1")
+
+    if args.ratios:
+        outputs = [path.read_text(encoding="utf-8") for path in args.ratios]
+    else:
+        outputs = [run_bench(args.bench, "--ratios", *args.engines)
+                   for _ in range(args.repeats)]
+    failed = set()
+    runs = []
+    for text in outputs:
+        ratios, crashed = parse_ratios(text)
+        runs.append(ratios)
+        failed |= crashed
+    current = median_of(runs)
+
+    if args.update:
+        if args.engines and args.baseline.exists():
+            # Refresh only the engines that were measured.
+            stored = json.loads(args.baseline.read_text(encoding="utf-8"))
+            current = dict(stored["engines"], **current)
+        args.baseline.write_text(json.dumps({
+            "reference": REFERENCE_ENGINE,
+            "host": f"{platform.machine()} {platform.system()}",
+            "engines": {engine_id: {metric: round(value, 4) for metric, value in ratios.items()}
+                        for engine_id, ratios in current.items()},
+        }, indent=2, sort_keys=True) + "\n", encoding="utf-8")
+        print(f"{len(current)} engines written to {args.baseline}")
+        for engine_id in sorted(failed):
+            print(f"{engine_id}: crashed or timed out, left out of the baseline")
+        return 0
+
+    stored = json.loads(args.baseline.read_text(encoding="utf-8"))
+    if stored.get("reference") != REFERENCE_ENGINE:
+        print(f"{args.baseline} is normalized to {stored.get('reference')}, "
+              f"not {REFERENCE_ENGINE}: refresh it with --update")
+        return 1
+    baseline = stored["engines"]
+    if args.engines:
+        baseline = {k: v for k, v in baseline.items() if k in args.engines}
+    regressions, notes = compare(
+        baseline, current, failed, args.threshold, args.worst_threshold)
+    for line in notes:
+        print(line)
+    if regressions:
+        print(f"\n{len(regressions)} cost regressions over {100 * args.threshold:.0f}% "
+              f"({100 * args.worst_threshold:.0f}% worst block) against "
+              f"{args.baseline.name}, ratios to {REFERENCE_ENGINE}:")
+        for line in regressions:
+            print(f"  {line}")
+        return 1
+    print(f"{len(current)} engines within {100 * args.threshold:.0f}% of the baseline")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
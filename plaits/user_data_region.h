@@ -22,7 +22,8 @@
 //
 // -----------------------------------------------------------------------------
 //
-// Swappable user-data region descriptor.
+// Swappable user-data region descriptor, and the layout of banks read in
+// place.
 //
 // Its own header because the generated engine_config.h defines the region TABLE
 // and is force-included ahead of everything else, while user_data.h — which
@@ -60,6 +61,48 @@ struct UserDataRegion {
   int bank;
 };
 
+// A baked bank laid out ahead of time in an engine's own record format, so
+// that the engine reads it in place instead of unpacking it into RAM on every
+// model switch.
+//
+//   0      0xd7         magic
+//   1      version      UserDataLayout::VERSION
+//   2      record size  sizeof() of the engine's record (fm::Patch: 156)
+//   3      count        1..255 records
+//   4...   the records
+//
+// The magic can never start a packed DX7 bank, whose bytes are all 7-bit, so a
+// transferred bank and a baked packed bank keep reading as packed data. A
+// version or record size this firmware was not built for also reads as
+// packed: the generator only lays out banks for the firmware it builds, and a
+// stale layout is refused rather than misread. Laid-out banks are never
+// regions: a transfer always carries packed bytes, so a bank that can be
+// replaced stays packed. user_data_layout.py in the builder writes this format.
+struct UserDataLayout {
+  enum {
+    MAGIC = 0xd7,
+    VERSION = 1,
+    HEADER_SIZE = 4
+  };
+
+  // The first record of a bank laid out with `record_size`-byte records, or
+  // NULL if `data` is not one.
+  static inline const uint8_t* records(
+      const uint8_t* data,
+      size_t record_size,
+      int* count) {
+    if (!data ||
+        data[0] != MAGIC ||
+        data[1] != VERSION ||
+        static_cast<size_t>(data[2]) != record_size ||
+        data[3] == 0) {
+      return NULL;
+    }
+    *count = data[3];
+    return data + HEADER_SIZE;
+  }
+};
+
 }  // namespace plaits
 
 #endif  // PLAITS_USER_DATA_REGION_H_
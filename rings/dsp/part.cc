@@ -89,11 +89,9 @@ void Part::ConfigureResonators() {
   switch (model_) {
     case RESONATOR_MODEL_MODAL:
       {
-        int32_t resolution = 64 / polyphony_ - 4;
-        for (int32_t i = 0; i < polyphony_; ++i) {
-          resonator_[i].Init();
-          resonator_[i].set_resolution(resolution);
-        }
+        resonator_.Init();
+        resonator_.set_num_voices(polyphony_);
+        resonator_.set_resolution(64 / polyphony_ - 4);
       }
       break;
     
@@ -440,7 +438,7 @@ void Part::ComputeSympatheticStringsNotes(
   }
 }
 
-void Part::RenderModalVoice(
+void Part::ConfigureModalVoice(
     int32_t voice,
     const PerformanceState& performance_state,
     const Patch& patch,
@@ -458,21 +456,20 @@ void Part::RenderModalVoice(
   
   // Process through filter.
   excitation_filter_[voice].Process<FILTER_MODE_LOW_PASS>(
-      resonator_input_, resonator_input_, size);
+      resonator_input_, modal_input_[voice], size);
 
-  Resonator& r = resonator_[voice];
-  r.set_frequency(frequency);
+  Resonator& r = resonator_;
+  r.set_frequency(voice, frequency);
   if (update_patch) {
-    r.set_structure(patch.structure);
-    r.set_brightness(patch.brightness * patch.brightness);
+    r.set_structure(voice, patch.structure);
+    r.set_brightness(voice, patch.brightness * patch.brightness);
     if (PositionRepurposed(performance_state)) {
-      r.set_position(0.0f);
+      r.set_position(voice, 0.0f);
     } else {
-      r.set_position(patch.position);
+      r.set_position(voice, patch.position);
     }
-    r.set_damping(patch.damping);
+    r.set_damping(voice, patch.damping);
   }
-  r.Process(resonator_input_, out_buffer_, aux_buffer_, size);
 }
 
 void Part::RenderFMVoice(
@@ -727,8 +724,10 @@ void Part::Process(
     }
 
     if (model_ == RESONATOR_MODEL_MODAL) {
-      RenderModalVoice(
+      // The modes of all voices are rendered together after this loop.
+      ConfigureModalVoice(
           voice, performance_state, patch, update_patch, frequency, filter_cutoff, size);
+      continue;
     } else if (model_ == RESONATOR_MODEL_FM_VOICE) {
       RenderFMVoice(
           voice, performance_state, patch, update_patch, frequency, filter_cutoff, size);
@@ -736,21 +735,13 @@ void Part::Process(
       RenderStringVoice(
           voice, performance_state, patch, update_patch, frequency, filter_cutoff, size);
     }
-    
-    // TODO: should this be an option? to dispatch odd/even voices individually vs
-    //   odd/even harmonics regardless of polyphony setting?
-    if (polyphony_ == 1) {
-      // Send the two sets of harmonics / pickups to individual outputs.
-      for (size_t i = 0; i < size; ++i) {
-        out[i] += out_buffer_[i];
-        aux[i] += aux_buffer_[i];
-      }
-    } else {
-      // Dispatch odd/even voices to individual outputs.
-      float* destination = voice & 1 ? aux : out;
-      for (size_t i = 0; i < size; ++i) {
-        destination[i] += out_buffer_[i] - aux_buffer_[i];
-      }
+    DispatchVoice(voice, out_buffer_, aux_buffer_, out, aux, size);
+  }
+  
+  if (model_ == RESONATOR_MODEL_MODAL) {
+    resonator_.Process(modal_input_, modal_out_, modal_aux_, size);
+    for (int32_t voice = 0; voice < polyphony_; ++voice) {
+      DispatchVoice(voice, modal_out_[voice], modal_aux_[voice], out, aux, size);
     }
   }
   
@@ -811,6 +802,30 @@ void Part::Process(
   }
 }
 
+void Part::DispatchVoice(
+    int32_t voice,
+    const float* voice_out,
+    const float* voice_aux,
+    float* out,
+    float* aux,
+    size_t size) {
+  // TODO: should this be an option? to dispatch odd/even voices individually vs
+  //   odd/even harmonics regardless of polyphony setting?
+  if (polyphony_ == 1) {
+    // Send the two sets of harmonics / pickups to individual outputs.
+    for (size_t i = 0; i < size; ++i) {
+      out[i] += voice_out[i];
+      aux[i] += voice_aux[i];
+    }
+  } else {
+    // Dispatch odd/even voices to individual outputs.
+    float* destination = voice & 1 ? aux : out;
+    for (size_t i = 0; i < size; ++i) {
+      destination[i] += voice_out[i] - voice_aux[i];
+    }
+  }
+}
+
 void Part::FillExciterBuffer(
     const PerformanceState& performance_state,
     const Patch& patch,
@@ -41,35 +41,44 @@ using namespace stmlib;
 
 void Resonator::Init() {
   for (int32_t i = 0; i < kMaxModes; ++i) {
-    f_[i].Init();
+    for (int32_t v = 0; v < kMaxResonatorVoices; ++v) {
+      // Silent filters: the vector kernel runs the unused columns too.
+      g_[i][v] = r_[i][v] = h_[i][v] = 0.0f;
+      state_1_[i][v] = state_2_[i][v] = 0.0f;
+    }
   }
 
-  set_frequency(220.0f / kSampleRate);
-  set_structure(0.25f);
-  set_brightness(0.5f);
-  set_damping(0.3f);
-  set_position(0.999f);
-  previous_position_ = 0.0f;
+  for (int32_t v = 0; v < kMaxResonatorVoices; ++v) {
+    set_frequency(v, 220.0f / kSampleRate);
+    set_structure(v, 0.25f);
+    set_brightness(v, 0.5f);
+    set_damping(v, 0.3f);
+    set_position(v, 0.999f);
+    previous_position_[v] = 0.0f;
+  }
+  set_num_voices(1);
   set_resolution(kMaxModes);
 }
 
-int32_t Resonator::ComputeFilters() {
-  float stiffness = Interpolate(lut_stiffness, structure_, 256.0f);
-  float harmonic = frequency_;
+int32_t Resonator::ComputeFilters(int32_t voice) {
+  const float structure = structure_[voice];
+  float stiffness = Interpolate(lut_stiffness, structure, 256.0f);
+  float harmonic = frequency_[voice];
   float stretch_factor = 1.0f; 
   float q = 500.0f * Interpolate(
       lut_4_decades,
-      damping_,
+      damping_[voice],
       256.0f);
-  float brightness_attenuation = 1.0f - structure_;
+  float brightness_attenuation = 1.0f - structure;
   // Reduces the range of brightness when structure is very low, to prevent
   // clipping.
   brightness_attenuation *= brightness_attenuation;
   brightness_attenuation *= brightness_attenuation;
   brightness_attenuation *= brightness_attenuation;
-  float brightness = brightness_ * (1.0f - 0.2f * brightness_attenuation);
+  float brightness = brightness_[voice] * (
+      1.0f - 0.2f * brightness_attenuation);
   float q_loss = brightness * (2.0f - brightness) * 0.85f + 0.15f;
-  float q_loss_damping_rate = structure_ * (2.0f - structure_) * 0.1f;
+  float q_loss_damping_rate = structure * (2.0f - structure) * 0.1f;
   int32_t num_modes = 0;
   for (int32_t i = 0; i < min(kMaxModes, resolution_); ++i) {
     float partial_frequency = harmonic * stretch_factor;
@@ -78,9 +87,12 @@ int32_t Resonator::ComputeFilters() {
     } else {
       num_modes = i + 1;
     }
-    f_[i].set_f_q<FREQUENCY_FAST>(
-        partial_frequency,
-        1.0f + partial_frequency * q);
+    // Same coefficients as Svf::set_f_q<FREQUENCY_FAST>.
+    const float g = OnePole::tan<FREQUENCY_FAST>(partial_frequency);
+    const float r = 1.0f / (1.0f + partial_frequency * q);
+    g_[i][voice] = g;
+    r_[i][voice] = r;
+    h_[i][voice] = 1.0f / (1.0f + r * g + g * g);
     stretch_factor += stiffness;
     if (stiffness < 0.0f) {
       // Make sure that the partials do not fold back into negative frequencies.
@@ -91,32 +103,226 @@ int32_t Resonator::ComputeFilters() {
     }
     // This prevents the highest partials from decaying too fast.
     q_loss += q_loss_damping_rate * (1.0f - q_loss);
-    harmonic += frequency_;
+    harmonic += frequency_[voice];
     q *= q_loss;
   }
   
   return num_modes;
 }
 
-void Resonator::Process(const float* in, float* out, float* aux, size_t size) {
-  int32_t num_modes = ComputeFilters();
+void Resonator::ProcessScalar(
+    const float (*in)[kMaxBlockSize],
+    float (*out)[kMaxBlockSize],
+    float (*aux)[kMaxBlockSize],
+    size_t size) {
+  for (int32_t v = 0; v < num_voices_; ++v) {
+    int32_t num_modes = ComputeFilters(v);
+  
+    ParameterInterpolator position(&previous_position_[v], position_[v], size);
+    for (size_t n = 0; n < size; ++n) {
+      CosineOscillator amplitudes;
+      amplitudes.Init<COSINE_OSCILLATOR_APPROXIMATE>(position.Next());
+      
+      float input = in[v][n] * 0.125f;
+      float odd = 0.0f;
+      float even = 0.0f;
+      amplitudes.Start();
+      for (int32_t i = 0; i < num_modes;) {
+        odd += amplitudes.Next() * BandPass(input, i++, v);
+        even += amplitudes.Next() * BandPass(input, i++, v);
+      }
+      out[v][n] = odd;
+      aux[v][n] = even;
+    }
+  }
+}
+
+#ifdef RINGS_RESONATOR_SIMD
+
+#if defined(__SSE2__)
+
+typedef __m128 Lanes;
+typedef __m128 LaneMask;
+
+static inline Lanes Load(const float* p) { return _mm_loadu_ps(p); }
+static inline void Store(float* p, Lanes x) { _mm_storeu_ps(p, x); }
+static inline Lanes Splat(float x) { return _mm_set1_ps(x); }
+static inline Lanes Add(Lanes a, Lanes b) { return _mm_add_ps(a, b); }
+static inline Lanes Sub(Lanes a, Lanes b) { return _mm_sub_ps(a, b); }
+static inline Lanes Mul(Lanes a, Lanes b) { return _mm_mul_ps(a, b); }
+static inline LaneMask Below(const int32_t* limits, int32_t x) {
+  return _mm_castsi128_ps(_mm_cmpgt_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(limits)),
+      _mm_set1_epi32(x)));
+}
+static inline Lanes Select(LaneMask mask, Lanes a, Lanes b) {
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+#else
+
+typedef float32x4_t Lanes;
+typedef uint32x4_t LaneMask;
+
+static inline Lanes Load(const float* p) { return vld1q_f32(p); }
+static inline void Store(float* p, Lanes x) { vst1q_f32(p, x); }
+static inline Lanes Splat(float x) { return vdupq_n_f32(x); }
+static inline Lanes Add(Lanes a, Lanes b) { return vaddq_f32(a, b); }
+static inline Lanes Sub(Lanes a, Lanes b) { return vsubq_f32(a, b); }
+static inline Lanes Mul(Lanes a, Lanes b) { return vmulq_f32(a, b); }
+static inline LaneMask Below(const int32_t* limits, int32_t x) {
+  return vcgtq_s32(vld1q_s32(limits), vdupq_n_s32(x));
+}
+static inline Lanes Select(LaneMask mask, Lanes a, Lanes b) {
+  return vbslq_f32(mask, a, b);
+}
+
+#endif  // __SSE2__
+
+// Same as CosineOscillator::InitApproximate, one voice at a time: the vector
+// kernel runs the oscillator recurrence itself, in all lanes at once.
+static inline float AmplitudeCoefficient(float frequency) {
+  float sign = 16.0f;
+  frequency -= 0.25f;
+  if (frequency < 0.0f) {
+    frequency = -frequency;
+  } else {
+    if (frequency > 0.5f) {
+      frequency -= 0.5f;
+    } else {
+      sign = -16.0f;
+    }
+  }
+  return sign * frequency * (1.0f - 2.0f * frequency);
+}
+
+// BandPass on the 4 columns of a row. Masked-out columns keep their state.
+template<bool masked>
+static inline Lanes BandPassRow(
+    Lanes in,
+    const float* g_row,
+    const float* r_row,
+    const float* h_row,
+    float* state_1_row,
+    float* state_2_row,
+    LaneMask mask) {
+  const Lanes g = Load(g_row);
+  const Lanes state_1 = Load(state_1_row);
+  const Lanes state_2 = Load(state_2_row);
+  const Lanes hp = Mul(
+      Sub(Sub(Sub(in, Mul(Load(r_row), state_1)), Mul(g, state_1)), state_2),
+      Load(h_row));
+  const Lanes g_hp = Mul(g, hp);
+  const Lanes bp = Add(g_hp, state_1);
+  const Lanes g_bp = Mul(g, bp);
+  const Lanes lp = Add(g_bp, state_2);
+  if (masked) {
+    Store(state_1_row, Select(mask, Add(g_hp, bp), state_1));
+    Store(state_2_row, Select(mask, Add(g_bp, lp), state_2));
+  } else {
+    Store(state_1_row, Add(g_hp, bp));
+    Store(state_2_row, Add(g_bp, lp));
+  }
+  return bp;
+}
+
+void Resonator::ProcessVector(
+    const float (*in)[kMaxBlockSize],
+    float (*out)[kMaxBlockSize],
+    float (*aux)[kMaxBlockSize],
+    size_t size) {
+  if (num_voices_ == 1) {
+    // Nothing to interleave.
+    ProcessScalar(in, out, aux, size);
+    return;
+  }
   
-  ParameterInterpolator position(&previous_position_, position_, size);
-  while (size--) {
-    CosineOscillator amplitudes;
-    amplitudes.Init<COSINE_OSCILLATOR_APPROXIMATE>(position.Next());
+  // The scalar kernel renders the modes of a voice in pairs: the rows a
+  // column takes part in. Unused columns are silent and run unmasked.
+  int32_t num_rows[kMaxResonatorVoices];
+  int32_t min_rows = kMaxModes;
+  int32_t max_rows = 0;
+  float coefficient[kMaxBlockSize][kMaxResonatorVoices];
+  for (int32_t v = 0; v < kMaxResonatorVoices; ++v) {
+    if (v < num_voices_) {
+      int32_t num_modes = ComputeFilters(v);
+      num_rows[v] = num_modes + (num_modes & 1);
+      ParameterInterpolator position(
+          &previous_position_[v], position_[v], size);
+      for (size_t n = 0; n < size; ++n) {
+        coefficient[n][v] = AmplitudeCoefficient(position.Next());
+      }
+    } else {
+      num_rows[v] = kMaxModes;
+      for (size_t n = 0; n < size; ++n) {
+        coefficient[n][v] = 0.0f;
+      }
+    }
+    min_rows = min(min_rows, num_rows[v]);
+    max_rows = max(max_rows, v < num_voices_ ? num_rows[v] : 0);
+  }
+  
+  const Lanes half = Splat(0.5f);
+  for (size_t n = 0; n < size; ++n) {
+    float input[kMaxResonatorVoices] = { 0.0f };
+    for (int32_t v = 0; v < num_voices_; ++v) {
+      input[v] = in[v][n] * 0.125f;
+    }
+    const Lanes x = Load(input);
+    
+    // CosineOscillator::Start and Next, for all the columns.
+    const Lanes c = Load(coefficient[n]);
+    Lanes y1 = Mul(c, Splat(0.25f));
+    Lanes y0 = half;
     
-    float input = *in++ * 0.125f;
-    float odd = 0.0f;
-    float even = 0.0f;
-    amplitudes.Start();
-    for (int32_t i = 0; i < num_modes;) {
-      odd += amplitudes.Next() * f_[i++].Process<FILTER_MODE_BAND_PASS>(input);
-      even += amplitudes.Next() * f_[i++].Process<FILTER_MODE_BAND_PASS>(input);
+    Lanes odd = Splat(0.0f);
+    Lanes even = odd;
+    int32_t i = 0;
+    for (; i < min_rows; i += 2) {
+      Lanes a = Add(y0, half);
+      Lanes y = Sub(Mul(c, y0), y1);
+      y1 = y0;
+      y0 = y;
+      odd = Add(odd, Mul(a, BandPassRow<false>(
+          x, g_[i], r_[i], h_[i], state_1_[i], state_2_[i], LaneMask())));
+      
+      a = Add(y0, half);
+      y = Sub(Mul(c, y0), y1);
+      y1 = y0;
+      y0 = y;
+      even = Add(even, Mul(a, BandPassRow<false>(
+          x, g_[i + 1], r_[i + 1], h_[i + 1], state_1_[i + 1],
+          state_2_[i + 1], LaneMask())));
+    }
+    for (; i < max_rows; i += 2) {
+      const LaneMask active = Below(num_rows, i);
+      Lanes a = Add(y0, half);
+      Lanes y = Sub(Mul(c, y0), y1);
+      y1 = y0;
+      y0 = y;
+      odd = Select(active, Add(odd, Mul(a, BandPassRow<true>(
+          x, g_[i], r_[i], h_[i], state_1_[i], state_2_[i], active))), odd);
+      
+      a = Add(y0, half);
+      y = Sub(Mul(c, y0), y1);
+      y1 = y0;
+      y0 = y;
+      even = Select(active, Add(even, Mul(a, BandPassRow<true>(
+          x, g_[i + 1], r_[i + 1], h_[i + 1], state_1_[i + 1],
+          state_2_[i + 1], active))), even);
+    }
+    
+    float odd_sum[kMaxResonatorVoices];
+    float even_sum[kMaxResonatorVoices];
+    Store(odd_sum, odd);
+    Store(even_sum, even);
+    for (int32_t v = 0; v < num_voices_; ++v) {
+      out[v][n] = odd_sum[v];
+      aux[v][n] = even_sum[v];
     }
-    *out++ = odd;
-    *aux++ = even;
   }
 }
 
+#endif  // RINGS_RESONATOR_SIMD
+
 }  // namespace rings
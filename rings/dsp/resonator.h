@@ -37,40 +37,84 @@
 #include "stmlib/dsp/filter.h"
 #include "stmlib/dsp/delay_line.h"
 
+// Host builds advance the same mode of 4 voices in one vector register. The
+// firmware (Cortex-M4, no SIMD unit) renders the voices one after the other
+// with the scalar kernel, which stays the reference: the vector kernel
+// performs the same operations in the same order, so the two produce
+// identical samples.
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define RINGS_RESONATOR_SIMD
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define RINGS_RESONATOR_SIMD
+#endif
+
 namespace rings {
 
 const int32_t kMaxModes = 64;
+const int32_t kMaxResonatorVoices = 4;
 
+// The modal resonators of all the voices of a part. Mode i of voice v is
+// stored in row i, column v of the filter arrays, so that a row holds the same
+// mode of every voice.
 class Resonator {
  public:
   Resonator() { }
   ~Resonator() { }
   
   void Init();
-  void Process(
-      const float* in,
-      float* out,
-      float* aux,
+  
+  // in, out and aux hold one block per voice.
+  inline void Process(
+      const float (*in)[kMaxBlockSize],
+      float (*out)[kMaxBlockSize],
+      float (*aux)[kMaxBlockSize],
+      size_t size) {
+#ifdef RINGS_RESONATOR_SIMD
+    ProcessVector(in, out, aux, size);
+#else
+    ProcessScalar(in, out, aux, size);
+#endif  // RINGS_RESONATOR_SIMD
+  }
+  
+  // The kernels are public so that the bench can check one against the
+  // other.
+  void ProcessScalar(
+      const float (*in)[kMaxBlockSize],
+      float (*out)[kMaxBlockSize],
+      float (*aux)[kMaxBlockSize],
+      size_t size);
+#ifdef RINGS_RESONATOR_SIMD
+  void ProcessVector(
+      const float (*in)[kMaxBlockSize],
+      float (*out)[kMaxBlockSize],
+      float (*aux)[kMaxBlockSize],
       size_t size);
+#endif  // RINGS_RESONATOR_SIMD
   
-  inline void set_frequency(float frequency) {
-    frequency_ = frequency;
+  inline void set_num_voices(int32_t num_voices) {
+    num_voices_ = std::min(num_voices, kMaxResonatorVoices);
   }
   
-  inline void set_structure(float structure) {
-    structure_ = structure;
+  inline void set_frequency(int32_t voice, float frequency) {
+    frequency_[voice] = frequency;
   }
   
-  inline void set_brightness(float brightness) {
-    brightness_ = brightness;
+  inline void set_structure(int32_t voice, float structure) {
+    structure_[voice] = structure;
   }
   
-  inline void set_damping(float damping) {
-    damping_ = damping;
+  inline void set_brightness(int32_t voice, float brightness) {
+    brightness_[voice] = brightness;
   }
   
-  inline void set_position(float position) {
-    position_ = position;
+  inline void set_damping(int32_t voice, float damping) {
+    damping_[voice] = damping;
+  }
+  
+  inline void set_position(int32_t voice, float position) {
+    position_[voice] = position;
   }
   
   inline void set_resolution(int32_t resolution) {
@@ -79,17 +123,37 @@ class Resonator {
   }
   
  private:
-  int32_t ComputeFilters();
-  float frequency_;
-  float structure_;
-  float brightness_;
-  float position_;
-  float previous_position_;
-  float damping_;
+  int32_t ComputeFilters(int32_t voice);
+  
+  // Same as stmlib::Svf::Process<FILTER_MODE_BAND_PASS>.
+  inline float BandPass(float in, int32_t mode, int32_t voice) {
+    const float g = g_[mode][voice];
+    const float state_1 = state_1_[mode][voice];
+    const float state_2 = state_2_[mode][voice];
+    const float hp = (in - r_[mode][voice] * state_1 - g * state_1 - state_2) *
+        h_[mode][voice];
+    const float bp = g * hp + state_1;
+    state_1_[mode][voice] = g * hp + bp;
+    const float lp = g * bp + state_2;
+    state_2_[mode][voice] = g * bp + lp;
+    return bp;
+  }
+  
+  float frequency_[kMaxResonatorVoices];
+  float structure_[kMaxResonatorVoices];
+  float brightness_[kMaxResonatorVoices];
+  float position_[kMaxResonatorVoices];
+  float previous_position_[kMaxResonatorVoices];
+  float damping_[kMaxResonatorVoices];
   
+  int32_t num_voices_;
   int32_t resolution_;
   
-  stmlib::Svf f_[kMaxModes];
+  float g_[kMaxModes][kMaxResonatorVoices];
+  float r_[kMaxModes][kMaxResonatorVoices];
+  float h_[kMaxModes][kMaxResonatorVoices];
+  float state_1_[kMaxModes][kMaxResonatorVoices];
+  float state_2_[kMaxModes][kMaxResonatorVoices];
   
   DISALLOW_COPY_AND_ASSIGN(Resonator);
 };
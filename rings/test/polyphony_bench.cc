@@ -0,0 +1,243 @@
+// Copyright 2026 Rubato Audio.
+//
+// Cost of the modal resonator against polyphony.
+//
+// Part gives each of its 1 to 4 voices 64 / polyphony - 4 modes and renders
+// them all in one Resonator. This bench runs the resonator at every
+// polyphony, once with the scalar kernel the Cortex-M4 runs and once with the
+// host vector kernel, on the same strikes: one voice at a time, in turn, as
+// Part excites them, with the knobs slowly moving. Both must produce the same
+// samples; any difference is reported and fails the run. It then times a whole
+// Part in the modal model at the same polyphony. For every polyphony it prints
+//   <voices> <modes> <scalar_ns> <vector_ns> <part_ns> <part/1-voice> <hash>
+// where modes is the number of modes per voice, the times are those of one
+// kMaxBlockSize block, the fastest of a few batches, and hash is an FNV-1a
+// hash of the output of the part, so that a change to the resonator can be
+// checked for bit-identical output. As in the plaits benches the nanoseconds
+// are host numbers; how the cost scales with the polyphony is the useful
+// result. Build/run with `make polyphony-bench`.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+#include "stmlib/dsp/units.h"
+
+#include "rings/dsp/dsp.h"
+#include "rings/dsp/part.h"
+#include "rings/dsp/resonator.h"
+
+using namespace rings;
+using namespace stmlib;
+
+const int kNumBlocks = 20000;
+const int kNumBatches = 3;
+const int kStrikePeriod = 150;
+
+const float kNotes[] = { 48.0f, 55.0f, 60.0f, 64.0f, 67.0f, 72.0f, 79.0f };
+const int kNumNotes = sizeof(kNotes) / sizeof(kNotes[0]);
+
+uint16_t reverb_buffer[65536];
+
+Resonator scalar_resonator;
+Resonator vector_resonator;
+
+float in[kMaxResonatorVoices][kMaxBlockSize];
+float scalar_out[kMaxResonatorVoices][kMaxBlockSize];
+float scalar_aux[kMaxResonatorVoices][kMaxBlockSize];
+float vector_out[kMaxResonatorVoices][kMaxBlockSize];
+float vector_aux[kMaxResonatorVoices][kMaxBlockSize];
+
+enum Kernel {
+  KERNEL_SCALAR,
+  KERNEL_VECTOR
+};
+
+uint32_t Hash(uint32_t hash, const float* data, size_t size) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(
+      static_cast<const void*>(data));
+  for (size_t i = 0; i < size * sizeof(float); ++i) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+void InitResonator(Resonator* resonator, int32_t num_voices) {
+  resonator->Init();
+  resonator->set_num_voices(num_voices);
+  resonator->set_resolution(64 / num_voices - 4);
+}
+
+// Strikes voice block / kStrikePeriod (modulo the polyphony) at the start of
+// its period, tunes it to the next note, and moves the knobs of every voice.
+void Excite(int block, int32_t num_voices, Resonator* resonator) {
+  const int strike = block / kStrikePeriod;
+  const int32_t struck = strike % num_voices;
+  for (int32_t v = 0; v < num_voices; ++v) {
+    std::fill(&in[v][0], &in[v][kMaxBlockSize], 0.0f);
+  }
+  if (block % kStrikePeriod == 0) {
+    in[struck][0] = 1.0f;
+  }
+  const float sweep = static_cast<float>(block % 1000) / 1000.0f;
+  for (int32_t v = 0; v < num_voices; ++v) {
+    const int note = (strike - (struck - v + num_voices) % num_voices);
+    const float midi_note = kNotes[(note + kNumNotes * 4) % kNumNotes];
+    resonator->set_frequency(v, SemitonesToRatio(midi_note - 69.0f) * a3);
+    resonator->set_structure(v, 0.2f + 0.3f * sweep);
+    resonator->set_brightness(v, 0.5f);
+    resonator->set_damping(v, 0.8f);
+    resonator->set_position(v, 0.3f + 0.4f * sweep);
+  }
+}
+
+void Render(Kernel kernel, Resonator* resonator) {
+#ifdef RINGS_RESONATOR_SIMD
+  if (kernel == KERNEL_VECTOR) {
+    resonator->ProcessVector(in, vector_out, vector_aux, kMaxBlockSize);
+    return;
+  }
+#endif  // RINGS_RESONATOR_SIMD
+  if (kernel == KERNEL_VECTOR) {
+    resonator->ProcessScalar(in, vector_out, vector_aux, kMaxBlockSize);
+  } else {
+    resonator->ProcessScalar(in, scalar_out, scalar_aux, kMaxBlockSize);
+  }
+}
+
+// Runs both kernels side by side and returns the number of differing samples.
+int Compare(int32_t num_voices) {
+  InitResonator(&scalar_resonator, num_voices);
+  InitResonator(&vector_resonator, num_voices);
+  int mismatches = 0;
+  for (int block = 0; block < 4000; ++block) {
+    Excite(block, num_voices, &scalar_resonator);
+    Excite(block, num_voices, &vector_resonator);
+    Render(KERNEL_SCALAR, &scalar_resonator);
+    Render(KERNEL_VECTOR, &vector_resonator);
+    for (int32_t v = 0; v < num_voices; ++v) {
+      for (size_t i = 0; i < kMaxBlockSize; ++i) {
+        if (scalar_out[v][i] != vector_out[v][i] ||
+            scalar_aux[v][i] != vector_aux[v][i]) {
+          if (!mismatches) {
+            printf("%d voices: block %d voice %d sample %zu: "
+                   "scalar %.9g %.9g vector %.9g %.9g\n",
+                   num_voices, block, v, i,
+                   scalar_out[v][i], scalar_aux[v][i],
+                   vector_out[v][i], vector_aux[v][i]);
+          }
+          ++mismatches;
+        }
+      }
+    }
+  }
+  return mismatches;
+}
+
+float TimeResonator(Kernel kernel, int32_t num_voices) {
+  Resonator* resonator = kernel == KERNEL_VECTOR
+      ? &vector_resonator
+      : &scalar_resonator;
+  float fastest = 0.0f;
+  for (int batch = 0; batch < kNumBatches; ++batch) {
+    InitResonator(resonator, num_voices);
+    float ns = 0.0f;
+    for (int block = 0; block < kNumBlocks; ++block) {
+      Excite(block, num_voices, resonator);
+      auto t0 = std::chrono::high_resolution_clock::now();
+      Render(kernel, resonator);
+      auto t1 = std::chrono::high_resolution_clock::now();
+      ns += std::chrono::duration<float, std::nano>(t1 - t0).count();
+    }
+    ns /= kNumBlocks;
+    fastest = batch == 0 ? ns : std::min(fastest, ns);
+  }
+  return fastest;
+}
+
+// A whole part, driven as its CV inputs would: a strum every kStrikePeriod
+// blocks on the next note, the internal exciter, the knobs slowly moving.
+float TimePart(int32_t polyphony, uint32_t* hash) {
+  float fastest = 0.0f;
+  for (int batch = 0; batch < kNumBatches; ++batch) {
+    Part* part = new Part;
+    part->Init(reverb_buffer);
+    part->set_polyphony(polyphony);
+    part->set_model(RESONATOR_MODEL_MODAL);
+
+    Patch patch;
+    patch.structure = 0.3f;
+    patch.brightness = 0.6f;
+    patch.damping = 0.8f;
+    patch.position = 0.3f;
+
+    PerformanceState performance;
+    memset(&performance, 0, sizeof(performance));
+    performance.internal_exciter = true;
+
+    float silence[kMaxBlockSize] = { 0.0f };
+    float out[kMaxBlockSize];
+    float aux[kMaxBlockSize];
+    *hash = 2166136261u;
+    float ns = 0.0f;
+    for (int block = 0; block < kNumBlocks; ++block) {
+      performance.strum = block % kStrikePeriod == 0;
+      performance.note = kNotes[(block / kStrikePeriod) % kNumNotes];
+      patch.position = 0.3f + 0.4f * static_cast<float>(block % 1000) / 1000.0f;
+      auto t0 = std::chrono::high_resolution_clock::now();
+      part->Process(performance, patch, silence, out, aux, kMaxBlockSize);
+      auto t1 = std::chrono::high_resolution_clock::now();
+      ns += std::chrono::duration<float, std::nano>(t1 - t0).count();
+      *hash = Hash(*hash, out, kMaxBlockSize);
+      *hash = Hash(*hash, aux, kMaxBlockSize);
+    }
+    delete part;
+    ns /= kNumBlocks;
+    fastest = batch == 0 ? ns : std::min(fastest, ns);
+  }
+  return fastest;
+}
+
+int main(void) {
+#if defined(__SSE2__)
+  // The Cortex-M4 FPU flushes denormals in hardware.
+  _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+  _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#endif
+#ifndef RINGS_RESONATOR_SIMD
+  printf("no vector kernel on this host: both columns are the scalar one\n");
+#endif
+  int mismatches = 0;
+  for (int32_t num_voices = 1; num_voices <= kMaxResonatorVoices;
+       ++num_voices) {
+    mismatches += Compare(num_voices);
+  }
+
+  printf("voices modes scalar_ns vector_ns part_ns part/1-voice hash\n");
+  float part_ns_1 = 0.0f;
+  for (int32_t num_voices = 1; num_voices <= kMaxResonatorVoices;
+       ++num_voices) {
+    const float scalar_ns = TimeResonator(KERNEL_SCALAR, num_voices);
+    const float vector_ns = TimeResonator(KERNEL_VECTOR, num_voices);
+    uint32_t hash;
+    const float part_ns = TimePart(num_voices, &hash);
+    if (num_voices == 1) {
+      part_ns_1 = part_ns;
+    }
+    printf("%d %5d %9.0f %9.0f %9.0f %6.2f %08x\n",
+           num_voices, (64 / num_voices - 4) & ~1,
+           scalar_ns, vector_ns, part_ns, part_ns / part_ns_1, hash);
+  }
+
+  if (mismatches) {
+    printf("FAILED: %d samples differ between the kernels\n", mismatches);
+    return 1;
+  }
+  return 0;
+}